@@ -0,0 +1,1180 @@
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+#include <boost/math/special_functions.hpp>
+#include "special.hpp"
+
+// Not a test: prints nanoseconds per element for the scalar wrappers next to
+// the batch entry points that replace them in hot loops.
+
+namespace {
+    constexpr std::size_t count = 1 << 16;
+
+    double volatile sink;
+
+    template<class Fn>
+    double ns_per_element(std::size_t const elements, Fn fn) {
+        using clock = std::chrono::steady_clock;
+        fn(); // warm up
+        int reps = 0;
+        auto const start = clock::now();
+        auto elapsed = clock::duration{};
+        do {
+            fn();
+            ++reps;
+            elapsed = clock::now() - start;
+        } while (elapsed < std::chrono::milliseconds{200});
+        return std::chrono::duration<double, std::nano>(elapsed).count() / (double(reps) * elements);
+    }
+
+    template<class T>
+    std::vector<T> linspace(T const lo, T const hi, std::size_t const n = count) {
+        std::vector<T> v(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            v[i] = lo + (hi - lo) * static_cast<T>(i) / static_cast<T>(n - 1);
+        }
+        return v;
+    }
+
+    template<class T, class Scalar, class Batch>
+    void compare(char const* const name, unsigned const n, std::vector<T> const& x, Scalar scalar, Batch batch) {
+        std::vector<T> y(x.size());
+        auto const s = ns_per_element(x.size(), [&] {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                y[i] = scalar(n, x[i]);
+            }
+            sink = y[x.size() / 2];
+        });
+        auto const b = ns_per_element(x.size(), [&] {
+            (void) batch(n, x.data(), x.data() + x.size(), y.data());
+            sink = y[x.size() / 2];
+        });
+        std::printf("%-20s %6u %12.2f %12.2f %8.1fx\n", name, n, s, b, s / b);
+    }
+
+    void orthogonal_polynomials() {
+        std::printf("%-20s %6s %12s %12s %9s\n", "polynomial (ns/x)", "degree", "scalar", "batch", "speedup");
+        auto const unit = linspace(-1.0, 1.0);
+        auto const unitf = linspace(-1.0f, 1.0f);
+        auto const half_line = linspace(0.0, 20.0);
+        auto const line = linspace(-5.0, 5.0);
+        for (unsigned const n : {1u, 2u, 5u, 10u, 50u, 100u, 500u, 1000u}) {
+            compare("legendre", n, unit,
+                [](unsigned l, double x) { return std::legendre(l, x); },
+                [](unsigned l, double const* f, double const* e, double* d) { return std::legendre_batch(l, f, e, d); });
+            compare("legendref", n, unitf,
+                [](unsigned l, float x) { return std::legendref(l, x); },
+                [](unsigned l, float const* f, float const* e, float* d) { return std::legendre_batch(l, f, e, d); });
+            compare("hermite", n, line,
+                [](unsigned k, double x) { return std::hermite(k, x); },
+                [](unsigned k, double const* f, double const* e, double* d) { return std::hermite_batch(k, f, e, d); });
+            compare("laguerre", n, half_line,
+                [](unsigned k, double x) { return std::laguerre(k, x); },
+                [](unsigned k, double const* f, double const* e, double* d) { return std::laguerre_batch(k, f, e, d); });
+        }
+    }
+
+    void hermite_functions() {
+        std::printf("\n%-20s %6s %12s %12s %9s\n", "psi_n (ns/x)", "degree", "scalar", "batch", "speedup");
+        auto const line = linspace(-100.0, 100.0, 4096);
+        for (unsigned const n : {10u, 100u, 1000u, 5000u}) {
+            compare("hermite_function", n, line,
+                [](unsigned k, double x) { return std::hermite_function(k, x); },
+                [](unsigned k, double const* f, double const* e, double* d) {
+                    return std::hermite_function_batch(k, f, e, d);
+                });
+        }
+
+        std::vector<double> psi(5001);
+        auto const per_term = ns_per_element(line.size() * psi.size(), [&] {
+            for (double const x : line) {
+                std::hermite_function_sequence(5000, x, psi.data());
+            }
+            sink = psi[2500];
+        });
+        std::printf("%-20s %6u %12.2f ns per term\n", "sequence", 5000u, per_term);
+    }
+
+    // what callers did before hermite_transform: rebuild the matrix from std::hermite,
+    // which overflows past n ~ 150, on every transform
+    void naive_forward(std::vector<double> const& values, std::vector<double>& coefficients) {
+        unsigned const size = static_cast<unsigned>(values.size());
+        auto const rule = std::gauss_hermite_rule(size);
+        for (unsigned n = 0; n < size; ++n) {
+            double const norm = std::sqrt(std::ldexp(std::tgamma(n + 1.0), n) * std::sqrt(3.14159265358979323846));
+            double sum = 0;
+            for (unsigned i = 0; i < size; ++i) {
+                double const x = rule.nodes[i];
+                sum += rule.weights[i] * std::exp(x * x / 2) * std::hermite(n, x) / norm * values[i];
+            }
+            coefficients[n] = sum;
+        }
+    }
+
+    void hermite_transforms() {
+        using clock = std::chrono::steady_clock;
+        std::printf("\n%-20s %6s %10s %12s %12s %12s %9s\n", "hermite transform", "N", "plan (ms)",
+            "naive (us)", "1 vec (us)", "256 (us/vec)", "GFLOP/s");
+        for (unsigned const size : {128u, 512u, 2048u}) {
+            auto const start = clock::now();
+            std::hermite_transform const plan(size);
+            auto const build = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+
+            std::size_t const many = 256;
+            std::vector<double> values(many * size);
+            for (std::size_t k = 0; k < values.size(); ++k) {
+                values[k] = std::cos(0.01 * k);
+            }
+            std::vector<double> coefficients(values.size());
+            std::vector<double> one(values.begin(), values.begin() + size);
+            std::vector<double> one_out(size);
+            double naive = 0;
+            if (size <= 128) {
+                naive = ns_per_element(1, [&] { naive_forward(one, one_out); sink = one_out[0]; }) / 1000;
+            }
+            auto const single = ns_per_element(1, [&] {
+                plan.forward(values.data(), coefficients.data());
+                sink = coefficients[0];
+            }) / 1000;
+            auto const batched = ns_per_element(many, [&] {
+                plan.forward(values.data(), coefficients.data(), many);
+                sink = coefficients[0];
+            }) / 1000;
+            double const flops = 2.0 * size * size / (batched * 1000);
+            if (size <= 128) {
+                std::printf("%-20s %6u %10.2f %12.2f %12.2f %12.2f %9.2f\n", "forward", size, build, naive, single, batched, flops);
+            } else {
+                std::printf("%-20s %6u %10.2f %12s %12.2f %12.2f %9.2f\n", "forward", size, build, "-", single, batched, flops);
+            }
+        }
+    }
+
+    void laguerre_sequences() {
+        std::printf("\n%-20s %6s %12s %12s %9s\n", "all n <= N (ns/x)", "N", "N+1 calls", "sequence", "speedup");
+        auto const half_line = linspace(0.0, 40.0, 1024);
+        for (unsigned const n : {10u, 50u, 200u}) {
+            std::vector<double> out(n + 1);
+            auto const calls = ns_per_element(half_line.size(), [&] {
+                for (double const x : half_line) {
+                    for (unsigned k = 0; k <= n; ++k) {
+                        out[k] = std::assoc_laguerre(k, 7, x);
+                    }
+                }
+                sink = out[n];
+            });
+            auto const sequence = ns_per_element(half_line.size(), [&] {
+                for (double const x : half_line) {
+                    std::assoc_laguerre_sequence(n, 7, x, out.data());
+                }
+                sink = out[n];
+            });
+            std::printf("%-20s %6u %12.2f %12.2f %8.1fx\n", "assoc_laguerre m=7", n, calls, sequence, calls / sequence);
+        }
+    }
+
+    void laguerre_gauss_beams() {
+        // per-pixel std::assoc_laguerre, pow, and exp, as callers did before laguerre_gauss_modes
+        unsigned const side = 512;
+        unsigned const orders = 20;
+        int const charge = 3;
+        double const w = 1.0;
+        auto const axis = linspace(-4.0, 4.0, side);
+        std::vector<std::complex<double>> modes(std::size_t{orders} * side * side);
+        auto const naive = ns_per_element(1, [&] {
+            for (unsigned p = 0; p < orders; ++p) {
+                double const norm = std::sqrt(2 * std::tgamma(p + 1.0) / (3.14159265358979323846 * std::tgamma(p + charge + 1.0))) / w;
+                for (unsigned j = 0; j < side; ++j) {
+                    for (unsigned i = 0; i < side; ++i) {
+                        double const r2 = axis[i] * axis[i] + axis[j] * axis[j];
+                        double const u = 2 * r2 / (w * w);
+                        double const radial = norm * std::pow(std::sqrt(u), charge) * std::assoc_laguerre(p, charge, u) * std::exp(-u / 2);
+                        modes[(std::size_t{p} * side + j) * side + i] = std::polar(radial, charge * std::atan2(axis[j], axis[i]));
+                    }
+                }
+            }
+            sink = modes[side].real();
+        }) / 1e6;
+        auto const batched = ns_per_element(1, [&] {
+            std::laguerre_gauss_modes(orders - 1, charge, w, axis.data(), axis.data() + side,
+                axis.data(), axis.data() + side, modes.data());
+            sink = modes[side].real();
+        }) / 1e6;
+        std::printf("\n%-20s %12s %12s %12s %9s\n", "laguerre-gauss (ms)", "grid", "per pixel", "batch", "speedup");
+        std::printf("%-20s %8ux%-3u %12.2f %12.2f %8.1fx\n", "p < 20, l = 3", side, side, naive, batched, naive / batched);
+    }
+
+    template<unsigned N, class T, class Scalar, class Fixed>
+    void compare_fixed(char const* const name, std::vector<T> const& x, Scalar scalar, Fixed fixed) {
+        std::vector<T> y(x.size());
+        auto const s = ns_per_element(x.size(), [&] {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                y[i] = scalar(N, x[i]);
+            }
+            sink = y[x.size() / 2];
+        });
+        auto const f = ns_per_element(x.size(), [&] {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                y[i] = fixed(x[i]);
+            }
+            sink = y[x.size() / 2];
+        });
+        std::printf("%-20s %6u %12.2f %12.2f %8.1fx\n", name, N, s, f, s / f);
+    }
+
+    void fixed_degree_polynomials() {
+        std::printf("\n%-20s %6s %12s %12s %9s\n", "polynomial (ns/x)", "degree", "scalar", "fixed", "speedup");
+        auto const unit = linspace(-1.0, 1.0);
+        auto const line = linspace(-5.0, 5.0);
+        auto const half_line = linspace(0.0, 20.0);
+        compare_fixed<4>("hermite", line, [](unsigned n, double x) { return std::hermite(n, x); },
+            [](double x) { return std::hermite<4>(x); });
+        compare_fixed<12>("hermite", line, [](unsigned n, double x) { return std::hermite(n, x); },
+            [](double x) { return std::hermite<12>(x); });
+        compare_fixed<6>("legendre", unit, [](unsigned n, double x) { return std::legendre(n, x); },
+            [](double x) { return std::legendre<6>(x); });
+        compare_fixed<12>("legendre", unit, [](unsigned n, double x) { return std::legendre(n, x); },
+            [](double x) { return std::legendre<12>(x); });
+        compare_fixed<8>("laguerre", half_line, [](unsigned n, double x) { return std::laguerre(n, x); },
+            [](double x) { return std::laguerre<8>(x); });
+        compare_fixed<8>("assoc_laguerre m=2", half_line, [](unsigned n, double x) { return std::assoc_laguerre(n, 2, x); },
+            [](double x) { return std::assoc_laguerre<8, 2>(x); });
+    }
+
+    template<class T, class Scalar, class Both, class Batch>
+    void compare_derivative(char const* const name, unsigned const n, std::vector<T> const& x,
+        Scalar scalar, Both both, Batch batch) {
+        std::vector<T> v(x.size());
+        std::vector<T> d(x.size());
+        auto const s = ns_per_element(x.size(), [&] {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                v[i] = scalar(n, x[i]);
+                d[i] = n * scalar(n - 1, x[i]); // stand-in for a second recurrence
+            }
+            sink = v[x.size() / 2] + d[x.size() / 2];
+        });
+        auto const c = ns_per_element(x.size(), [&] {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                auto const r = both(n, x[i]);
+                v[i] = r.value;
+                d[i] = r.derivative;
+            }
+            sink = v[x.size() / 2] + d[x.size() / 2];
+        });
+        auto const b = ns_per_element(x.size(), [&] {
+            batch(n, x.data(), x.data() + x.size(), v.data(), d.data());
+            sink = v[x.size() / 2] + d[x.size() / 2];
+        });
+        std::printf("%-20s %6u %12.2f %12.2f %12.2f\n", name, n, s, c, b);
+    }
+
+    void values_and_derivatives() {
+        std::printf("\n%-20s %6s %12s %12s %12s\n", "value+slope (ns/x)", "degree", "2 scalars", "combined", "batch");
+        auto const unit = linspace(-1.0, 1.0);
+        auto const line = linspace(-5.0, 5.0);
+        auto const half_line = linspace(0.0, 20.0);
+        for (unsigned const n : {2u, 10u, 100u, 1000u}) {
+            compare_derivative("legendre", n, unit,
+                [](unsigned l, double x) { return std::legendre(l, x); },
+                [](unsigned l, double x) { return std::legendre_and_derivative(l, x); },
+                [](unsigned l, double const* f, double const* e, double* v, double* d) {
+                    std::legendre_and_derivative_batch(l, f, e, v, d);
+                });
+            compare_derivative("assoc_legendre m=2", n, unit,
+                [](unsigned l, double x) { return std::assoc_legendre(l, 2, x); },
+                [](unsigned l, double x) { return std::assoc_legendre_and_derivative(l, 2, x); },
+                [](unsigned l, double const* f, double const* e, double* v, double* d) {
+                    std::assoc_legendre_and_derivative_batch(l, 2, f, e, v, d);
+                });
+            compare_derivative("hermite", n, line,
+                [](unsigned k, double x) { return std::hermite(k, x); },
+                [](unsigned k, double x) { return std::hermite_and_derivative(k, x); },
+                [](unsigned k, double const* f, double const* e, double* v, double* d) {
+                    std::hermite_and_derivative_batch(k, f, e, v, d);
+                });
+            compare_derivative("laguerre", n, half_line,
+                [](unsigned k, double x) { return std::laguerre(k, x); },
+                [](unsigned k, double x) { return std::laguerre_and_derivative(k, x); },
+                [](unsigned k, double const* f, double const* e, double* v, double* d) {
+                    std::laguerre_and_derivative_batch(k, f, e, v, d);
+                });
+        }
+    }
+
+    // what callers did before gauss_legendre_rule: Newton's method on std::legendre,
+    // with P_n' from P_n and P_{n-1}
+    double newton_legendre_rule(unsigned const n) {
+        double sum = 0;
+        for (unsigned k = 1; k <= n; ++k) {
+            double x = std::cos(3.14159265358979323846 * (k - 0.25) / (n + 0.5));
+            double dp = 1;
+            for (int iter = 0; iter < 100; ++iter) {
+                double const p = std::legendre(n, x);
+                dp = n * (x * p - std::legendre(n - 1, x)) / (x * x - 1);
+                double const step = p / dp;
+                x -= step;
+                if (std::abs(step) <= 1e-15) {
+                    break;
+                }
+            }
+            sum += 2 / ((1 - x * x) * dp * dp);
+        }
+        return sum;
+    }
+
+    void quadrature_rules() {
+        using clock = std::chrono::steady_clock;
+        std::printf("\n%-20s %8s %14s %14s %14s\n", "gauss-legendre (ms)", "points", "newton", "first call", "cached (ns)");
+        for (unsigned const n : {1000u, 10000u, 100000u, 1000000u}) {
+            double newton = 0;
+            if (n <= 10000) {
+                auto const start = clock::now();
+                sink = newton_legendre_rule(n);
+                newton = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+            }
+            auto const start = clock::now();
+            sink = std::gauss_legendre_rule(n).weights[0];
+            auto const first = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+            auto const cached = ns_per_element(1, [n] { sink = std::gauss_legendre_rule(n).weights[0]; });
+            if (n <= 10000) {
+                std::printf("%-20s %8u %14.2f %14.3f %14.1f\n", "", n, newton, first, cached);
+            } else {
+                std::printf("%-20s %8u %14s %14.3f %14.1f\n", "", n, "-", first, cached);
+            }
+        }
+    }
+
+    template<class Rule>
+    void time_rule(char const* const name, unsigned const n, Rule rule) {
+        using clock = std::chrono::steady_clock;
+        auto const start = clock::now();
+        sink = rule(n).weights[0];
+        auto const first = std::chrono::duration<double, std::milli>(clock::now() - start).count();
+        auto const cached = ns_per_element(1, [&] { sink = rule(n).weights[0]; });
+        std::printf("%-20s %8u %14.3f %14.1f\n", name, n, first, cached);
+    }
+
+    void unbounded_quadrature_rules() {
+        std::printf("\n%-20s %8s %14s %14s\n", "gauss rule (ms)", "points", "first call", "cached (ns)");
+        for (unsigned const n : {20u, 100u, 500u, 2000u}) {
+            time_rule("hermite", n, [](unsigned k) { return std::gauss_hermite_rule(k); });
+            time_rule("laguerre", n, [](unsigned k) { return std::gauss_laguerre_rule(k); });
+            time_rule("laguerre alpha=2.5", n, [](unsigned k) { return std::gauss_laguerre_rule(k, 2.5); });
+        }
+    }
+
+    void elliptic_integrals() {
+        std::printf("\n%-20s %12s %12s %12s\n", "K and E (ns/k)", "two calls", "one pass", "batch");
+        for (double const hi : {0.5, 0.99, 0.999999}) {
+            auto const k = linspace(0.0, hi);
+            std::vector<double> first(k.size());
+            std::vector<double> second(k.size());
+            auto const separate = ns_per_element(k.size(), [&] {
+                for (std::size_t i = 0; i < k.size(); ++i) {
+                    first[i] = std::comp_ellint_1(k[i]);
+                    second[i] = std::comp_ellint_2(k[i]);
+                }
+                sink = first[k.size() / 2] + second[k.size() / 2];
+            });
+            auto const combined = ns_per_element(k.size(), [&] {
+                for (std::size_t i = 0; i < k.size(); ++i) {
+                    auto const both = std::comp_ellint_1_2(k[i]);
+                    first[i] = both.first_kind;
+                    second[i] = both.second_kind;
+                }
+                sink = first[k.size() / 2] + second[k.size() / 2];
+            });
+            auto const batch = ns_per_element(k.size(), [&] {
+                std::comp_ellint_1_2_batch(k.data(), k.data() + k.size(), first.data(), second.data());
+                sink = first[k.size() / 2] + second[k.size() / 2];
+            });
+            char name[32];
+            std::snprintf(name, sizeof(name), "k in [0, %g]", hi);
+            std::printf("%-20s %12.2f %12.2f %12.2f\n", name, separate, combined, batch);
+        }
+
+        std::printf("\n%-20s %12s %12s %12s\n", "F, E, Pi (ns/phi)", "three calls", "one pass", "");
+        for (double const k : {0.5, 0.99}) {
+            auto const phi = linspace(-10.0, 10.0);
+            std::vector<double> first(phi.size());
+            std::vector<double> second(phi.size());
+            std::vector<double> third(phi.size());
+            auto const separate = ns_per_element(phi.size(), [&] {
+                for (std::size_t i = 0; i < phi.size(); ++i) {
+                    first[i] = std::ellint_1(k, phi[i]);
+                    second[i] = std::ellint_2(k, phi[i]);
+                    third[i] = std::ellint_3(k, 0.25, phi[i]);
+                }
+                sink = first[phi.size() / 2] + second[phi.size() / 2] + third[phi.size() / 2];
+            });
+            auto const combined = ns_per_element(phi.size(), [&] {
+                for (std::size_t i = 0; i < phi.size(); ++i) {
+                    auto const all = std::ellint_1_2_3(k, 0.25, phi[i]);
+                    first[i] = all.first_kind;
+                    second[i] = all.second_kind;
+                    third[i] = all.third_kind;
+                }
+                sink = first[phi.size() / 2] + second[phi.size() / 2] + third[phi.size() / 2];
+            });
+            char name[32];
+            std::snprintf(name, sizeof(name), "k = %g", k);
+            std::printf("%-20s %12.2f %12.2f\n", name, separate, combined);
+        }
+
+        std::printf("\n%-20s %12s %12s %12s %12s\n", "F, E (ns/pair)", "F scalar", "F batch", "E scalar",
+            "E batch");
+        for (double const hi : {1.5, 20.0}) {
+            auto const k = linspace(-0.95, 0.95);
+            auto const phi = linspace(-hi, hi);
+            std::vector<double> out(k.size());
+            auto const scalar_f = ns_per_element(k.size(), [&] {
+                for (std::size_t i = 0; i < k.size(); ++i) {
+                    out[i] = std::ellint_1(k[i], phi[i]);
+                }
+                sink = out[k.size() / 2];
+            });
+            auto const batch_f = ns_per_element(k.size(), [&] {
+                std::ellint_1_batch(k.data(), k.data() + k.size(), phi.data(), out.data());
+                sink = out[k.size() / 2];
+            });
+            auto const scalar_e = ns_per_element(k.size(), [&] {
+                for (std::size_t i = 0; i < k.size(); ++i) {
+                    out[i] = std::ellint_2(k[i], phi[i]);
+                }
+                sink = out[k.size() / 2];
+            });
+            auto const batch_e = ns_per_element(k.size(), [&] {
+                std::ellint_2_batch(k.data(), k.data() + k.size(), phi.data(), out.data());
+                sink = out[k.size() / 2];
+            });
+            char name[32];
+            std::snprintf(name, sizeof(name), "|phi| <= %g", hi);
+            std::printf("%-20s %12.2f %12.2f %12.2f %12.2f\n", name, scalar_f, batch_f, scalar_e, batch_e);
+        }
+
+        std::printf("\n%-20s %12s %12s %12s %12s\n", "fixed k (ns/phi)", "F batch", "F plan", "E batch",
+            "E plan");
+        for (double const hi : {1.5, 20.0}) {
+            std::vector<double> const k(count, 0.8);
+            auto const phi = linspace(-hi, hi);
+            std::vector<double> out(phi.size());
+            std::elliptic_plan const plan(0.8);
+            auto const batch_f = ns_per_element(phi.size(), [&] {
+                std::ellint_1_batch(k.data(), k.data() + k.size(), phi.data(), out.data());
+                sink = out[phi.size() / 2];
+            });
+            auto const plan_f = ns_per_element(phi.size(), [&] {
+                plan.first_kind(phi.data(), phi.data() + phi.size(), out.data());
+                sink = out[phi.size() / 2];
+            });
+            auto const batch_e = ns_per_element(phi.size(), [&] {
+                std::ellint_2_batch(k.data(), k.data() + k.size(), phi.data(), out.data());
+                sink = out[phi.size() / 2];
+            });
+            auto const plan_e = ns_per_element(phi.size(), [&] {
+                plan.second_kind(phi.data(), phi.data() + phi.size(), out.data());
+                sink = out[phi.size() / 2];
+            });
+            char name[32];
+            std::snprintf(name, sizeof(name), "|phi| <= %g", hi);
+            std::printf("%-20s %12.2f %12.2f %12.2f %12.2f\n", name, batch_f, plan_f, batch_e, plan_e);
+        }
+
+        std::printf("\n%-20s %12s %12s %12s %12s\n", "am(u, k) (ns/u)", "bisection", "scalar", "batch", "plan");
+        for (double const k : {0.5, 0.999}) {
+            auto const u = linspace(-10.0, 10.0);
+            std::vector<double> const modulus(u.size(), k);
+            std::vector<double> out(u.size());
+            auto const bisection = ns_per_element(u.size() / 64, [&] {
+                // the generic root-finder this replaces: F(k, phi) <= |u| bounds phi by |u|
+                for (std::size_t i = 0; i < u.size(); i += 64) {
+                    double lo = 0;
+                    double hi = std::fabs(u[i]);
+                    for (int step = 0; step < 52; ++step) {
+                        double const mid = (lo + hi) / 2;
+                        (std::ellint_1(k, mid) < std::fabs(u[i]) ? lo : hi) = mid;
+                    }
+                    out[i] = std::copysign((lo + hi) / 2, u[i]);
+                }
+                sink = out[0];
+            });
+            auto const scalar = ns_per_element(u.size(), [&] {
+                for (std::size_t i = 0; i < u.size(); ++i) {
+                    out[i] = std::ellint_1_inverse(k, u[i]);
+                }
+                sink = out[u.size() / 2];
+            });
+            auto const batch = ns_per_element(u.size(), [&] {
+                std::ellint_1_inverse_batch(modulus.data(), modulus.data() + modulus.size(), u.data(), out.data());
+                sink = out[u.size() / 2];
+            });
+            std::elliptic_plan const plan(k);
+            auto const planned = ns_per_element(u.size(), [&] {
+                plan.amplitude(u.data(), u.data() + u.size(), out.data());
+                sink = out[u.size() / 2];
+            });
+            char name[32];
+            std::snprintf(name, sizeof(name), "k = %g", k);
+            std::printf("%-20s %12.2f %12.2f %12.2f %12.2f\n", name, bisection, scalar, batch, planned);
+        }
+
+        std::printf("\n%-20s %12s %12s %12s\n", "Pi(nu, k) (ns/nu)", "scalar", "sweep", "");
+        for (double const k : {0.5, 0.999}) {
+            for (double const lo : {-10.0, 0.999}) {
+                auto const nu = linspace(lo, lo < 0 ? 0.9 : 1 - 1e-12);
+                std::vector<double> out(nu.size());
+                auto const scalar = ns_per_element(nu.size(), [&] {
+                    for (std::size_t i = 0; i < nu.size(); ++i) {
+                        out[i] = std::comp_ellint_3(k, nu[i]);
+                    }
+                    sink = out[nu.size() / 2];
+                });
+                auto const sweep = ns_per_element(nu.size(), [&] {
+                    std::comp_ellint_3_batch(k, nu.data(), nu.data() + nu.size(), out.data());
+                    sink = out[nu.size() / 2];
+                });
+                char name[32];
+                std::snprintf(name, sizeof(name), "k = %g, nu %s", k, lo < 0 ? "< 0.9" : "~ 1");
+                std::printf("%-20s %12.2f %12.2f\n", name, scalar, sweep);
+            }
+        }
+
+        std::printf("\n%-20s %12s %12s %12s\n", "Carlson (ns/call)", "scalar", "batch", "");
+        {
+            auto const x = linspace(0.0, 4.0);
+            auto const y = linspace(0.5, 2.0);
+            auto const z = linspace(1.0, 9.0);
+            std::vector<double> out(x.size());
+            auto const scalar_rf = ns_per_element(x.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    out[i] = std::carlson_rf(x[i], y[i], z[i]);
+                }
+                sink = out[x.size() / 2];
+            });
+            auto const batch_rf = ns_per_element(x.size(), [&] {
+                std::carlson_rf_batch(x.data(), x.data() + x.size(), y.data(), z.data(), out.data());
+                sink = out[x.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f\n", "R_F", scalar_rf, batch_rf);
+            auto const scalar_rj = ns_per_element(x.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    out[i] = std::carlson_rj(x[i], y[i], z[i], y[i]);
+                }
+                sink = out[x.size() / 2];
+            });
+            auto const batch_rj = ns_per_element(x.size(), [&] {
+                std::carlson_rj_batch(x.data(), x.data() + x.size(), y.data(), z.data(), y.data(), out.data());
+                sink = out[x.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f\n", "R_J", scalar_rj, batch_rj);
+        }
+    }
+
+    void zeta_regions() {
+        std::printf("\n%-20s %12s %12s %12s\n", "zeta(s) (ns/s)", "double", "batch", "float");
+        struct region {
+            char const* name;
+            std::vector<double> s;
+        };
+        std::vector<double> integers;
+        std::vector<double> halves;
+        for (std::size_t i = 0; i < count; ++i) {
+            int const n = static_cast<int>(i % 119) - 59;
+            integers.push_back(n < 1 ? n : n + 1.0); // skipping the pole
+            halves.push_back(static_cast<double>(i % 53) + 0.5);
+        }
+        region const regions[] = {
+            {"integers", integers},
+            {"s = n + 1/2 > 0", halves},
+            {"0 < s < 2", linspace(0.001, 1.999)},
+            {"-1 < s < 0", linspace(-0.999, -0.001)},
+            {"-170 < s < -1", linspace(-169.9, -1.1)},
+            {"-340 < s < -170", linspace(-339.9, -170.1)},
+            {"2 < s < 53", linspace(2.1, 52.9)},
+        };
+        for (auto const& r : regions) {
+            std::vector<float> const sf(r.s.begin(), r.s.end());
+            std::vector<double> out(r.s.size());
+            std::vector<float> outf(r.s.size());
+            auto const d = ns_per_element(r.s.size(), [&] {
+                for (std::size_t i = 0; i < r.s.size(); ++i) {
+                    out[i] = std::riemann_zeta(r.s[i]);
+                }
+                sink = out[r.s.size() / 2];
+            });
+            auto const batch = ns_per_element(r.s.size(), [&] {
+                std::riemann_zeta_batch(r.s.data(), r.s.data() + r.s.size(), out.data());
+                sink = out[r.s.size() / 2];
+            });
+            auto const f = ns_per_element(sf.size(), [&] {
+                for (std::size_t i = 0; i < sf.size(); ++i) {
+                    outf[i] = std::riemann_zetaf(sf[i]);
+                }
+                sink = outf[sf.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f %12.2f\n", r.name, d, batch, f);
+        }
+    }
+
+    void exponential_integrals() {
+        std::printf("\n%-20s %12s %12s %12s %12s\n", "Ei(x) (ns/x)", "double", "batch", "float", "float batch");
+        struct region {
+            char const* name;
+            std::vector<double> x;
+        };
+        std::vector<double> mixed;
+        for (std::size_t i = 0; i < count; ++i) { // neighbours land in different regions
+            mixed.push_back(-59.9 + 119.8 * static_cast<double>(i * 61 % count) / count);
+        }
+        region const regions[] = {
+            {"-60 < x < -1", linspace(-59.9, -1.1)},
+            {"-1 < x < 0", linspace(-0.999, -0.001)},
+            {"0 < x < 6", linspace(0.001, 5.999)},
+            {"6 < x < 22", linspace(6.1, 21.9)},
+            {"22 < x < 80", linspace(22.1, 79.9)},
+            {"mixed |x| < 60", mixed},
+        };
+        for (auto const& r : regions) {
+            std::vector<float> const xf(r.x.begin(), r.x.end());
+            std::vector<double> out(r.x.size());
+            std::vector<float> outf(r.x.size());
+            auto const d = ns_per_element(r.x.size(), [&] {
+                for (std::size_t i = 0; i < r.x.size(); ++i) {
+                    out[i] = std::expint(r.x[i]);
+                }
+                sink = out[r.x.size() / 2];
+            });
+            auto const batch = ns_per_element(r.x.size(), [&] {
+                std::expint_batch(r.x.data(), r.x.data() + r.x.size(), out.data());
+                sink = out[r.x.size() / 2];
+            });
+            auto const f = ns_per_element(xf.size(), [&] {
+                for (std::size_t i = 0; i < xf.size(); ++i) {
+                    outf[i] = std::expintf(xf[i]);
+                }
+                sink = outf[xf.size() / 2];
+            });
+            auto const batch_f = ns_per_element(xf.size(), [&] {
+                std::expint_batch(xf.data(), xf.data() + xf.size(), outf.data());
+                sink = outf[xf.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f %12.2f %12.2f\n", r.name, d, batch, f, batch_f);
+        }
+    }
+
+    void exponential_integral_orders() {
+        // E_1(x), ..., E_32(x) at each x by the recurrence up from -Ei(-x) that callers wrote by
+        // hand, which loses accuracy once x exceeds n, against the sequence; then E_32 alone,
+        // which by hand still takes the whole recurrence, against the batch
+        constexpr unsigned orders = 32;
+        std::printf("\n%-20s %12s %12s %12s %12s\n", "E_n(x)", "by hand", "sequence", "E_32 hand", "E_32 batch");
+        std::printf("%-20s %12s %12s %12s %12s\n", "", "ns/value", "ns/value", "ns/x", "ns/x");
+        for (auto const& [name, lo, hi] : {std::tuple{"0 < x < 1", 0.001, 0.999}, {"1 < x < 40", 1.001, 39.9},
+                 {"40 < x < 600", 40.1, 599.9}}) {
+            auto const x = linspace(lo, hi, count / orders);
+            std::vector<double> out(x.size() * orders);
+            auto const by_hand = ns_per_element(out.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    double const decay = std::exp(-x[i]);
+                    double en = -std::expint(-x[i]);
+                    out[i * orders] = en;
+                    for (unsigned n = 1; n < orders; ++n) {
+                        en = (decay - x[i] * en) / n;
+                        out[i * orders + n] = en;
+                    }
+                }
+                sink = out[out.size() / 2];
+            });
+            auto const sequence = ns_per_element(out.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    std::expint_n_sequence(orders, x[i], out.data() + i * orders);
+                }
+                sink = out[out.size() / 2];
+            });
+            auto const single_by_hand = ns_per_element(x.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    double const decay = std::exp(-x[i]);
+                    double en = -std::expint(-x[i]);
+                    for (unsigned n = 1; n < orders; ++n) {
+                        en = (decay - x[i] * en) / n;
+                    }
+                    out[i] = en;
+                }
+                sink = out[x.size() / 2];
+            });
+            auto const batch = ns_per_element(x.size(), [&] {
+                std::expint_n_batch(orders, x.data(), x.data() + x.size(), out.data());
+                sink = out[x.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f %12.2f %12.2f\n", name, by_hand, sequence, single_by_hand, batch);
+        }
+
+        // e^-x Ei(x); past x = 709 the product by hand overflows to inf * 0
+        std::printf("\n%-20s %12s %12s %12s\n", "e^-x Ei(x) (ns/x)", "by hand", "scaled", "batch");
+        for (auto const& [name, lo, hi] : {std::tuple{"-60 < x < 60", -59.9, 59.9}, {"60 < x < 700", 60.1, 699.9},
+                 {"700 < x < 1e6", 700.1, 1e6}}) {
+            auto const x = linspace(lo, hi);
+            std::vector<double> out(x.size());
+            auto const by_hand = ns_per_element(x.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    out[i] = std::exp(-x[i]) * std::expint(x[i]);
+                }
+                sink = out[x.size() / 2];
+            });
+            auto const scaled = ns_per_element(x.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    out[i] = std::expint_scaled(x[i]);
+                }
+                sink = out[x.size() / 2];
+            });
+            auto const batch = ns_per_element(x.size(), [&] {
+                std::expint_scaled_batch(x.data(), x.data() + x.size(), out.data());
+                sink = out[x.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f %12.2f\n", name, by_hand, scaled, batch);
+        }
+    }
+
+    void log_beta() {
+        // log B(a, b) as log(beta), which underflows once a + b passes a few hundred, and as the
+        // lgamma difference, which cancels, against lbeta, its batch, and the batch against
+        // the fixed a at the middle of each range
+        std::printf("\n%-20s %12s %12s %12s %12s %12s\n", "log B(a, b) (ns/ab)", "log(beta)", "lgamma diff",
+            "lbeta", "batch", "fixed a");
+        for (auto const& [name, lo, hi, halves] : {std::tuple{"0 < a, b < 10", 0.013, 9.97, false},
+                 {"half-integers", 0.5, 80.0, true}, {"10 < a, b < 1000", 10.3, 999.7, false}}) {
+            auto a = linspace(lo, hi);
+            if (halves) {
+                for (double& x : a) {
+                    x = std::round(2 * x) / 2;
+                }
+            }
+            std::vector<double> const b(a.rbegin(), a.rend());
+            std::vector<double> out(a.size());
+            auto const by_beta = ns_per_element(a.size(), [&] {
+                for (std::size_t i = 0; i < a.size(); ++i) {
+                    out[i] = std::log(std::beta(a[i], b[i]));
+                }
+                sink = out[a.size() / 2];
+            });
+            auto const by_lgamma = ns_per_element(a.size(), [&] {
+                for (std::size_t i = 0; i < a.size(); ++i) {
+                    out[i] = std::lgamma(a[i]) + std::lgamma(b[i]) - std::lgamma(a[i] + b[i]);
+                }
+                sink = out[a.size() / 2];
+            });
+            auto const scalar = ns_per_element(a.size(), [&] {
+                for (std::size_t i = 0; i < a.size(); ++i) {
+                    out[i] = std::lbeta(a[i], b[i]);
+                }
+                sink = out[a.size() / 2];
+            });
+            auto const batch = ns_per_element(a.size(), [&] {
+                std::lbeta_batch(a.data(), a.data() + a.size(), b.data(), out.data());
+                sink = out[a.size() / 2];
+            });
+            auto const fixed = ns_per_element(a.size(), [&] {
+                std::lbeta_batch(a[a.size() / 2], b.data(), b.data() + b.size(), out.data());
+                sink = out[a.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f %12.2f %12.2f %12.2f\n", name, by_beta, by_lgamma, scalar, batch, fixed);
+        }
+    }
+
+    template<class Double, class Float>
+    void float_against_double(char const* const name, double const lo, double const hi, Double wide,
+                              Float narrow) {
+        auto const x = linspace(lo, hi);
+        auto const xf = linspace(static_cast<float>(lo), static_cast<float>(hi));
+        std::vector<double> y(x.size());
+        std::vector<float> yf(xf.size());
+        auto const d = ns_per_element(x.size(), [&] {
+            wide(x, y);
+            sink = y[x.size() / 2];
+        });
+        auto const f = ns_per_element(xf.size(), [&] {
+            narrow(xf, yf);
+            sink = yf[xf.size() / 2];
+        });
+        std::printf("%-28s %12.2f %12.2f %11.2fx\n", name, d, f, d / f);
+    }
+
+    template<class Fn>
+    auto each(Fn fn) {
+        return [fn](auto const& x, auto& y) {
+            for (std::size_t i = 0; i < x.size(); ++i) {
+                y[i] = fn(x[i]);
+            }
+        };
+    }
+
+    void float_kernels() {
+        // the float forms that stop their Carlson duplication or take their complete integrals,
+        // Ei, J_0, and J_1 from fits at float accuracy, against the double forms over the same
+        // arguments
+        std::printf("\n%-28s %12s %12s %12s\n", "float vs double (ns/x)", "double", "float", "speedup");
+        float_against_double("comp_ellint_1(k)", -0.99, 0.99,
+            each([](double k) { return std::comp_ellint_1(k); }), each([](float k) { return std::comp_ellint_1f(k); }));
+        float_against_double("comp_ellint_2(k)", -0.99, 0.99,
+            each([](double k) { return std::comp_ellint_2(k); }), each([](float k) { return std::comp_ellint_2f(k); }));
+        float_against_double("ellint_1(0.5, phi)", -6.0, 6.0,
+            each([](double phi) { return std::ellint_1(0.5, phi); }),
+            each([](float phi) { return std::ellint_1f(0.5f, phi); }));
+        float_against_double("ellint_2(0.5, phi)", -6.0, 6.0,
+            each([](double phi) { return std::ellint_2(0.5, phi); }),
+            each([](float phi) { return std::ellint_2f(0.5f, phi); }));
+        float_against_double("ellint_3(0.5, 0.3, phi)", -1.5, 1.5,
+            each([](double phi) { return std::ellint_3(0.5, 0.3, phi); }),
+            each([](float phi) { return std::ellint_3f(0.5f, 0.3f, phi); }));
+        float_against_double("carlson_rf(x, 1, 50)", 0.001, 100.0,
+            each([](double x) { return std::carlson_rf(x, 1.0, 50.0); }),
+            each([](float x) { return std::carlson_rf(x, 1.0f, 50.0f); }));
+        float_against_double("carlson_rd(x, 1, 50)", 0.001, 100.0,
+            each([](double x) { return std::carlson_rd(x, 1.0, 50.0); }),
+            each([](float x) { return std::carlson_rd(x, 1.0f, 50.0f); }));
+        float_against_double("carlson_rj(x, 1, 50, 2)", 0.001, 100.0,
+            each([](double x) { return std::carlson_rj(x, 1.0, 50.0, 2.0); }),
+            each([](float x) { return std::carlson_rj(x, 1.0f, 50.0f, 2.0f); }));
+        float_against_double("expint(x)", -60.0, 80.0,
+            each([](double x) { return std::expint(x); }), each([](float x) { return std::expintf(x); }));
+        float_against_double("cyl_bessel_j(0, x)", 0.001, 100.0,
+            each([](double x) { return std::cyl_bessel_j(0.0, x); }),
+            each([](float x) { return std::cyl_bessel_jf(0.0f, x); }));
+        float_against_double("cyl_bessel_j(1, x)", 0.001, 100.0,
+            each([](double x) { return std::cyl_bessel_j(1.0, x); }),
+            each([](float x) { return std::cyl_bessel_jf(1.0f, x); }));
+        float_against_double("cyl_bessel_j(1, x), x > 8", 8.0, 1.0e4,
+            each([](double x) { return std::cyl_bessel_j(1.0, x); }),
+            each([](float x) { return std::cyl_bessel_jf(1.0f, x); }));
+
+        // the batch forms share the duplication, and zeta's Euler-Maclaurin tail stops at float
+        // accuracy, so that a float block runs fewer steps for every lane
+        std::vector<double> const ones(count, 1.0);
+        std::vector<double> const fifties(count, 50.0);
+        std::vector<float> const ones_f(count, 1.0f);
+        std::vector<float> const fifties_f(count, 50.0f);
+        std::vector<double> const halves(count, 0.5);
+        std::vector<float> const halves_f(count, 0.5f);
+        float_against_double("carlson_rf_batch(x, 1, 50)", 0.001, 100.0,
+            [&](auto const& x, auto& y) {
+                std::carlson_rf_batch(x.data(), x.data() + x.size(), ones.data(), fifties.data(), y.data());
+            },
+            [&](auto const& x, auto& y) {
+                std::carlson_rf_batch(x.data(), x.data() + x.size(), ones_f.data(), fifties_f.data(), y.data());
+            });
+        float_against_double("ellint_1_batch(0.5, phi)", -6.0, 6.0,
+            [&](auto const& phi, auto& y) {
+                std::ellint_1_batch(halves.data(), halves.data() + phi.size(), phi.data(), y.data());
+            },
+            [&](auto const& phi, auto& y) {
+                std::ellint_1_batch(halves_f.data(), halves_f.data() + phi.size(), phi.data(), y.data());
+            });
+        float_against_double("riemann_zeta_batch(s)", 1.5, 40.0,
+            [](auto const& s, auto& y) { std::riemann_zeta_batch(s.data(), s.data() + s.size(), y.data()); },
+            [](auto const& s, auto& y) { std::riemann_zeta_batch(s.data(), s.data() + s.size(), y.data()); });
+    }
+
+    void batch_isas() {
+        // each batch function under every instruction set this processor runs; SMF_BATCH_ISA
+        // picks the one the rest of this program runs on
+        std::printf("\n%-28s %12s %12s %12s\n", "batch isa (ns/x)", "scalar", "avx2", "avx512");
+        auto const unit = linspace(-0.99, 0.99);
+        auto const positive = linspace(0.25, 30.0);
+        auto const wide = linspace(-20.0, 20.0);
+        std::vector<double> const ones(count, 1.0);
+        std::vector<double> y(count);
+        std::vector<double> z(count);
+        auto const initial = std::current_batch_isa();
+        auto const row = [&](char const* const name, auto batch) {
+            std::printf("%-28s", name);
+            for (auto const isa : {std::batch_isa::scalar, std::batch_isa::avx2, std::batch_isa::avx512}) {
+                if (!std::set_batch_isa(isa)) {
+                    std::printf(" %12s", "-");
+                    continue;
+                }
+
+                std::printf(" %12.2f", ns_per_element(count, [&] {
+                    batch();
+                    sink = y[count / 2];
+                }));
+            }
+            std::printf("\n");
+        };
+        row("carlson_rf_batch", [&] {
+            std::carlson_rf_batch(positive.data(), positive.data() + count, ones.data(), positive.data(), y.data());
+        });
+        row("ellint_2_batch", [&] { std::ellint_2_batch(unit.data(), unit.data() + count, wide.data(), y.data()); });
+        row("comp_ellint_1_2_batch", [&] {
+            std::comp_ellint_1_2_batch(unit.data(), unit.data() + count, y.data(), z.data());
+        });
+        row("legendre_batch(7)", [&] { std::legendre_batch(7, unit.data(), unit.data() + count, y.data()); });
+        row("hermite_function_batch(12)", [&] {
+            std::hermite_function_batch(12, wide.data(), wide.data() + count, y.data());
+        });
+        row("laguerre_batch(5)", [&] { std::laguerre_batch(5, positive.data(), positive.data() + count, y.data()); });
+        row("expint_batch", [&] { std::expint_batch(wide.data(), wide.data() + count, y.data()); });
+        row("lbeta_batch", [&] { std::lbeta_batch(positive.data(), positive.data() + count, ones.data(), y.data()); });
+        row("riemann_zeta_batch", [&] { std::riemann_zeta_batch(wide.data(), wide.data() + count, y.data()); });
+        std::set_batch_isa(initial);
+    }
+
+#if _HAS_CXX20
+    void array_form_threads() {
+        // the parallel array forms over 2^20 elements at 1 to 64 threads; the chunks, and so the
+        // results, are the same at every count
+        std::size_t const elements = std::size_t{1} << 20;
+        std::printf("\n%-28s", "par_unseq threads (ns/x)");
+        unsigned const thread_counts[] = {1, 2, 4, 8, 16, 32, 64};
+        for (unsigned const threads : thread_counts) {
+            std::printf(" %8u", threads);
+        }
+        std::printf("   (%u hardware)\n", std::thread::hardware_concurrency());
+        auto const unit = linspace(-0.99, 0.99, elements);
+        auto const positive = linspace(0.25, 30.0, elements);
+        auto const wide = linspace(-20.0, 20.0, elements);
+        std::vector<double> const ones(elements, 1.0);
+        std::vector<double> y(elements);
+        auto const row = [&](char const* const name, auto array_form) {
+            std::printf("%-28s", name);
+            for (unsigned const threads : thread_counts) {
+                std::set_parallel_threads(threads);
+                std::printf(" %8.2f", ns_per_element(elements, [&] {
+                    array_form(std::span<double>{y});
+                    sink = y[elements / 2];
+                }));
+            }
+            std::printf("\n");
+        };
+        auto const par = std::execution::par_unseq;
+        row("legendre(7, x)", [&](auto out) { std::legendre(par, 7, unit, out); });
+        row("ellint_2(k, phi)", [&](auto out) { std::ellint_2(par, unit, wide, out); });
+        row("carlson_rf(x, 1, x)", [&](auto out) { std::carlson_rf(par, positive, ones, positive, out); });
+        row("expint(x)", [&](auto out) { std::expint(par, wide, out); });
+        row("riemann_zeta(s)", [&](auto out) { std::riemann_zeta(par, wide, out); });
+        row("cyl_bessel_j(nu, x)", [&](auto out) { std::cyl_bessel_j(par, unit, positive, out); });
+        row("sph_legendre(3, 2, theta)", [&](auto out) { std::sph_legendre(par, 3, 2, positive, out); });
+        std::set_parallel_threads(0);
+    }
+#endif /* _HAS_CXX20 */
+
+    void call_site_loops() {
+        // loops that call a wrapper per element, as callers write them, against the batch entry
+        // point and against the same polynomial written at the call site; only a build that
+        // inlines across translation units (SMF_WHOLE_PROGRAM) lets the first approach the last
+#ifdef SMF_WHOLE_PROGRAM
+        char const* const build = "whole program";
+#else
+        char const* const build = "separate";
+#endif
+        std::printf("\n%-20s %12s %12s %12s   (%s)\n", "call site (ns/x)", "per call", "batch", "inline", build);
+        auto const unit = linspace(-1.0, 1.0);
+        auto const positive = linspace(0.0, 20.0);
+        std::vector<double> y(count);
+        auto const run = [&](char const* const name, std::vector<double> const& x, auto per_call, auto batch,
+                             auto inline_form) {
+            auto const p = ns_per_element(x.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    y[i] = per_call(x[i]);
+                }
+                sink = y[x.size() / 2];
+            });
+            auto const b = ns_per_element(x.size(), [&] {
+                batch(x.data(), x.data() + x.size(), y.data());
+                sink = y[x.size() / 2];
+            });
+            auto const i = ns_per_element(x.size(), [&] {
+                for (std::size_t j = 0; j < x.size(); ++j) {
+                    y[j] = inline_form(x[j]);
+                }
+                sink = y[x.size() / 2];
+            });
+            std::printf("%-20s %12.2f %12.2f %12.2f\n", name, p, b, i);
+        };
+        run("legendre(5, x)", unit,
+            [](double x) { return std::legendre(5, x); },
+            [](double const* f, double const* l, double* d) { std::legendre_batch(5, f, l, d); },
+            [](double x) { double const x2 = x * x; return ((63 * x2 - 70) * x2 + 15) * x / 8; });
+        run("hermite(4, x)", unit,
+            [](double x) { return std::hermite(4, x); },
+            [](double const* f, double const* l, double* d) { std::hermite_batch(4, f, l, d); },
+            [](double x) { double const x2 = x * x; return (16 * x2 - 48) * x2 + 12; });
+        run("laguerre(3, x)", positive,
+            [](double x) { return std::laguerre(3, x); },
+            [](double const* f, double const* l, double* d) { std::laguerre_batch(3, f, l, d); },
+            [](double x) { return ((-x + 9) * x - 18) * x / 6 + 1; });
+    }
+
+    // the policy special_math.cpp passes to Boost, under which nothing throws
+    using errno_policy = boost::math::policies::policy<
+        boost::math::policies::domain_error<boost::math::policies::errno_on_error>,
+        boost::math::policies::pole_error<boost::math::policies::errno_on_error>,
+        boost::math::policies::overflow_error<boost::math::policies::ignore_error>,
+        boost::math::policies::evaluation_error<boost::math::policies::errno_on_error>,
+        boost::math::policies::rounding_error<boost::math::policies::errno_on_error>>;
+
+    // the wrappers as they were: a NaN test per argument, then Boost under its default
+    // policy in a frame that turns rounding and evaluation errors into domain_error
+    template<class Fn, class... Args>
+    double through_handler(Fn fn, Args const... args) {
+        for (double const arg : {static_cast<double>(args)...}) {
+            if (std::isnan(arg)) {
+                return arg;
+            }
+        }
+
+        try {
+            return fn(args...);
+        } catch (boost::math::rounding_error&) {
+            throw std::domain_error("rounding_error");
+        } catch (boost::math::evaluation_error&) {
+            throw std::domain_error("evaluation_error");
+        }
+    }
+
+    // constant arguments read back through a volatile, so that no path folds them into Boost
+    template<class T>
+    T unfolded(T const value) {
+        T volatile copy = value;
+        return copy;
+    }
+
+    // each path through a pointer the optimizer cannot see through, so that all three pay the
+    // same call and none is inlined into the loop
+    void overhead(char const* const name, std::vector<double> const& x, double (*const old)(double),
+        double (*const wrapper)(double), double (*const bare)(double)) {
+        std::vector<double> y(x.size());
+        auto const run = [&](double (*const fn)(double)) {
+            double (*volatile const opaque)(double) = fn;
+            return ns_per_element(x.size(), [&] {
+                for (std::size_t i = 0; i < x.size(); ++i) {
+                    y[i] = opaque(x[i]);
+                }
+                sink = y[x.size() / 2];
+            });
+        };
+        double const o = run(old);
+        double const w = run(wrapper);
+        double const b = run(bare);
+        std::printf("%-28s %12.2f %12.2f %12.2f %12.2f\n", name, o, w, b, w - b);
+    }
+
+    void call_overhead() {
+        // each wrapper that goes straight to Boost, against the try/catch path it replaced
+        // and against Boost called bare with the same policy, so that the last column is
+        // the cost of the wrapper itself; arguments are where Boost is cheapest
+        std::printf("\n%-28s %12s %12s %12s %12s\n", "call overhead (ns/call)", "try/catch", "wrapper", "bare Boost",
+            "difference");
+        auto const unit = linspace(-0.99, 0.99);
+        auto const positive = linspace(0.1, 20.0);
+        auto const angle = linspace(0.0, 1.5);
+        overhead("assoc_laguerre(3, 2, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::laguerre(a...); }, unfolded(3u), unfolded(2u), x); },
+            [](double x) { return std::assoc_laguerre(unfolded(3), unfolded(2), x); },
+            [](double x) { return boost::math::laguerre(unfolded(3u), unfolded(2u), x, errno_policy()); });
+        overhead("assoc_legendre(3, 2, x)", unit,
+            [](double x) { return through_handler([](auto... a) { return boost::math::legendre_p(a...); }, unfolded(3), unfolded(2), x); },
+            [](double x) { return std::assoc_legendre(unfolded(3), unfolded(2), x); },
+            [](double x) { return boost::math::legendre_p(unfolded(3), unfolded(2), x, errno_policy()); });
+        overhead("beta(x, 2.5)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::beta(a...); }, x, unfolded(2.5)); },
+            [](double x) { return std::beta(x, unfolded(2.5)); },
+            [](double x) { return boost::math::beta(x, unfolded(2.5), errno_policy()); });
+        overhead("comp_ellint_1(k)", unit,
+            [](double k) { return through_handler([](auto... a) { return boost::math::ellint_1(a...); }, k); },
+            [](double k) { return std::comp_ellint_1(k); },
+            [](double k) { return boost::math::ellint_1(k, errno_policy()); });
+        overhead("comp_ellint_2(k)", unit,
+            [](double k) { return through_handler([](auto... a) { return boost::math::ellint_2(a...); }, k); },
+            [](double k) { return std::comp_ellint_2(k); },
+            [](double k) { return boost::math::ellint_2(k, errno_policy()); });
+        overhead("comp_ellint_3(0.5, nu)", unit,
+            [](double nu) { return through_handler([](auto... a) { return boost::math::ellint_3(a...); }, unfolded(0.5), nu); },
+            [](double nu) { return std::comp_ellint_3(unfolded(0.5), nu); },
+            [](double nu) { return boost::math::ellint_3(unfolded(0.5), nu, errno_policy()); });
+        overhead("cyl_bessel_i(2.5, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::cyl_bessel_i(a...); }, unfolded(2.5), x); },
+            [](double x) { return std::cyl_bessel_i(unfolded(2.5), x); },
+            [](double x) { return boost::math::cyl_bessel_i(unfolded(2.5), x, errno_policy()); });
+        overhead("cyl_bessel_j(2.5, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::cyl_bessel_j(a...); }, unfolded(2.5), x); },
+            [](double x) { return std::cyl_bessel_j(unfolded(2.5), x); },
+            [](double x) { return boost::math::cyl_bessel_j(unfolded(2.5), x, errno_policy()); });
+        overhead("cyl_bessel_k(2.5, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::cyl_bessel_k(a...); }, unfolded(2.5), x); },
+            [](double x) { return std::cyl_bessel_k(unfolded(2.5), x); },
+            [](double x) { return boost::math::cyl_bessel_k(unfolded(2.5), x, errno_policy()); });
+        overhead("cyl_neumann(2.5, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::cyl_neumann(a...); }, unfolded(2.5), x); },
+            [](double x) { return std::cyl_neumann(unfolded(2.5), x); },
+            [](double x) { return boost::math::cyl_neumann(unfolded(2.5), x, errno_policy()); });
+        overhead("ellint_1(0.5, phi)", angle,
+            [](double phi) { return through_handler([](auto... a) { return boost::math::ellint_1(a...); }, unfolded(0.5), phi); },
+            [](double phi) { return std::ellint_1(unfolded(0.5), phi); },
+            [](double phi) { return boost::math::ellint_1(unfolded(0.5), phi, errno_policy()); });
+        overhead("ellint_2(0.5, phi)", angle,
+            [](double phi) { return through_handler([](auto... a) { return boost::math::ellint_2(a...); }, unfolded(0.5), phi); },
+            [](double phi) { return std::ellint_2(unfolded(0.5), phi); },
+            [](double phi) { return boost::math::ellint_2(unfolded(0.5), phi, errno_policy()); });
+        overhead("ellint_3(0.5, 0.3, phi)", angle,
+            [](double phi) { return through_handler([](auto... a) { return boost::math::ellint_3(a...); }, unfolded(0.5), unfolded(0.3), phi); },
+            [](double phi) { return std::ellint_3(unfolded(0.5), unfolded(0.3), phi); },
+            [](double phi) { return boost::math::ellint_3(unfolded(0.5), unfolded(0.3), phi, errno_policy()); });
+        overhead("expint(x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::expint(a...); }, x); },
+            [](double x) { return std::expint(x); },
+            [](double x) { return boost::math::expint(x, errno_policy()); });
+        overhead("hermite(5, x)", unit,
+            [](double x) { return through_handler([](auto... a) { return boost::math::hermite(a...); }, unfolded(5u), x); },
+            [](double x) { return std::hermite(unfolded(5), x); },
+            [](double x) { return boost::math::hermite(unfolded(5u), x, errno_policy()); });
+        overhead("laguerre(5, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::laguerre(a...); }, unfolded(5u), x); },
+            [](double x) { return std::laguerre(unfolded(5), x); },
+            [](double x) { return boost::math::laguerre(unfolded(5u), x, errno_policy()); });
+        overhead("legendre(5, x)", unit,
+            [](double x) { return through_handler([](auto... a) { return boost::math::legendre_p(a...); }, unfolded(5), x); },
+            [](double x) { return std::legendre(unfolded(5), x); },
+            [](double x) { return boost::math::legendre_p(unfolded(5), x, errno_policy()); });
+        overhead("sph_bessel(3, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::sph_bessel(a...); }, unfolded(3u), x); },
+            [](double x) { return std::sph_bessel(unfolded(3), x); },
+            [](double x) { return boost::math::sph_bessel(unfolded(3u), x, errno_policy()); });
+        overhead("sph_legendre(3, 2, theta)", angle,
+            [](double t) { return through_handler([](auto... a) { return boost::math::spherical_harmonic_r(a...); }, unfolded(3u), unfolded(2), t, unfolded(0.0)); },
+            [](double t) { return std::sph_legendre(unfolded(3), unfolded(2), t); },
+            [](double t) { return boost::math::spherical_harmonic_r(unfolded(3u), unfolded(2), t, unfolded(0.0), errno_policy()); });
+        overhead("sph_neumann(3, x)", positive,
+            [](double x) { return through_handler([](auto... a) { return boost::math::sph_neumann(a...); }, unfolded(3u), x); },
+            [](double x) { return std::sph_neumann(unfolded(3), x); },
+            [](double x) { return boost::math::sph_neumann(unfolded(3u), x, errno_policy()); });
+    }
+} // unnamed namespace
+
+int main() {
+    orthogonal_polynomials();
+    hermite_functions();
+    hermite_transforms();
+    laguerre_sequences();
+    laguerre_gauss_beams();
+    fixed_degree_polynomials();
+    values_and_derivatives();
+    quadrature_rules();
+    unbounded_quadrature_rules();
+    elliptic_integrals();
+    zeta_regions();
+    exponential_integrals();
+    exponential_integral_orders();
+    log_beta();
+    float_kernels();
+    batch_isas();
+#if _HAS_CXX20
+    array_form_threads();
+#endif /* _HAS_CXX20 */
+    call_site_loops();
+    call_overhead();
+}
@@ -1,7 +1,15 @@
 #pragma once
 
 #include <cmath>
+#include <complex>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
+#include <vector>
+#if _HAS_CXX20
+#include <execution>
+#include <span>
+#endif /* _HAS_CXX20 */
 
 // For AppVeyor
 #ifndef _NODISCARD
@@ -12,6 +20,160 @@ enum { PM_TEST_PASS = 0, PM_TEST_FAIL = 1 };
 
 _STD_BEGIN
 #if _HAS_CXX17
+		// compile-time degree polynomials: P_{k+1} = (A_k x + B_k)P_k - C_k P_{k-1} is either
+		// unrolled with its factors folded to constants, or, for low degrees of polynomials
+		// with definite parity where the monomial form is as accurate, expanded during
+		// translation and evaluated by Horner's rule in x^2
+template<unsigned _Degree>
+	struct _Monomial_coefficients
+	{	// _Coef[_Idx] multiplies x^_Idx
+	long double _Coef[_Degree + 1];
+	};
+
+template<class _Terms,
+	unsigned _Degree>
+	constexpr _Monomial_coefficients<_Degree> _Recurrence_coefficients()
+	{	// expand the recurrence in long double, the widest type we evaluate in
+	_Monomial_coefficients<_Degree> _Prev{};
+	_Monomial_coefficients<_Degree> _Cur{};
+	_Cur._Coef[0] = 1;
+	for (unsigned _Kx = 0; _Kx < _Degree; ++_Kx)
+		{
+		_Monomial_coefficients<_Degree> _Next{};
+		for (unsigned _Jx = 0; _Jx <= _Kx + 1; ++_Jx)
+			{
+			if (_Jx > 0)
+				{
+				_Next._Coef[_Jx] += _Terms::_A(_Kx) * _Cur._Coef[_Jx - 1];
+				}
+
+			if (_Jx <= _Kx)
+				{
+				_Next._Coef[_Jx] += _Terms::_B(_Kx) * _Cur._Coef[_Jx];
+				}
+
+			if (_Kx > 0 && _Jx < _Kx)
+				{
+				_Next._Coef[_Jx] -= _Terms::_C(_Kx) * _Prev._Coef[_Jx];
+				}
+			}
+
+		_Prev = _Cur;
+		_Cur = _Next;
+		}
+
+	return (_Cur);
+	}
+
+template<class _Terms,
+	unsigned _Degree>
+	inline constexpr _Monomial_coefficients<_Degree> _Recurrence_coefficients_v =
+		_Recurrence_coefficients<_Terms, _Degree>();
+
+template<class _Terms,
+	unsigned _Kx,
+	class _Ty>
+	constexpr void _Recurrence_step(const _Ty _Value, _Ty& _Prev, _Ty& _Cur)
+	{	// advance (P_{k-1}, P_k) to (P_k, P_{k+1})
+	constexpr _Ty _Ak = static_cast<_Ty>(_Terms::_A(_Kx));
+	constexpr _Ty _Bk = static_cast<_Ty>(_Terms::_B(_Kx));
+	constexpr _Ty _Ck = static_cast<_Ty>(_Terms::_C(_Kx));
+	const _Ty _Next = (_Ak * _Value + _Bk) * _Cur - _Ck * _Prev;
+	_Prev = _Cur;
+	_Cur = _Next;
+	}
+
+template<class _Terms,
+	class _Ty,
+	unsigned... _Kx>
+	constexpr _Ty _Unrolled_recurrence(const _Ty _Value, integer_sequence<unsigned, _Kx...>)
+	{
+	_Ty _Prev = 0;
+	_Ty _Cur = 1;
+	(_Recurrence_step<_Terms, _Kx>(_Value, _Prev, _Cur), ...);
+	return (_Cur);
+	}
+
+template<class _Terms,
+	unsigned _Degree,
+	class _Ty>
+	constexpr _Ty _Fixed_polynomial(const _Ty _Value)
+	{	// evaluate the degree _Degree member of the _Terms family at _Value
+	static_assert(is_floating_point_v<_Ty>);
+	if (_Value != _Value)
+		{	// NaN propagates, as in the runtime-degree wrappers
+		return (_Value);
+		}
+
+	if constexpr (_Degree <= _Terms::_Horner_max)
+		{
+		constexpr auto& _Coef = _Recurrence_coefficients_v<_Terms, _Degree>._Coef;
+		const _Ty _Square = _Value * _Value;
+		_Ty _Result = static_cast<_Ty>(_Coef[_Degree]);
+		for (unsigned _Idx = _Degree; _Idx >= 2; _Idx -= 2)
+			{
+			_Result = _Result * _Square + static_cast<_Ty>(_Coef[_Idx - 2]);
+			}
+
+		if constexpr (_Degree % 2 != 0)
+			{
+			_Result *= _Value;
+			}
+
+		return (_Result);
+		}
+	else
+		{
+		return (_Unrolled_recurrence<_Terms>(_Value, make_integer_sequence<unsigned, _Degree>{}));
+		}
+	}
+
+template<class _Ty>
+	using _Fixed_float_t = conditional_t<is_integral_v<_Ty>, double, _Ty>;
+
+template<unsigned _Order>
+	struct _Assoc_laguerre_terms
+	{	// (k+1)L_{k+1}^m(x) = (2k+m+1-x)L_k^m(x) - (k+m)L_{k-1}^m(x)
+	static constexpr unsigned _Horner_max = 0;	// no definite parity
+
+	static constexpr long double _A(const unsigned _Kx)
+		{
+		return (-1.0L / (_Kx + 1));
+		}
+
+	static constexpr long double _B(const unsigned _Kx)
+		{
+		return (static_cast<long double>(2 * _Kx + _Order + 1) / (_Kx + 1));
+		}
+
+	static constexpr long double _C(const unsigned _Kx)
+		{
+		return (static_cast<long double>(_Kx + _Order) / (_Kx + 1));
+		}
+	};
+
+template<class _Ty>
+	struct value_and_derivative
+	{	// result of the *_and_derivative functions
+	_Ty value;
+	_Ty derivative;
+	};
+
+template<class _Ty>
+	struct complete_elliptic_integrals
+	{	// result of comp_ellint_1_2
+	_Ty first_kind;
+	_Ty second_kind;
+	};
+
+template<class _Ty>
+	struct incomplete_elliptic_integrals
+	{	// result of ellint_1_2_3
+	_Ty first_kind;
+	_Ty second_kind;
+	_Ty third_kind;
+	};
+
 _NODISCARD double assoc_laguerre(unsigned _Degree, unsigned _Order, double _Value);
 _NODISCARD float assoc_laguerref(unsigned _Degree, unsigned _Order, float _Value);
 _NODISCARD inline long double assoc_laguerrel(const unsigned _Degree, const unsigned _Order,
@@ -20,6 +182,67 @@ _NODISCARD inline long double assoc_laguerrel(const unsigned _Degree, const unsi
 	return (_STD assoc_laguerre(_Degree, _Order, static_cast<double>(_Value)));
 	}
 
+	// compute L_n^m(x) and its derivative in one pass of the recurrence
+_NODISCARD value_and_derivative<double> assoc_laguerre_and_derivative(unsigned _Degree, unsigned _Order,
+	double _Value);
+_NODISCARD value_and_derivative<float> assoc_laguerre_and_derivative(unsigned _Degree, unsigned _Order,
+	float _Value);
+_NODISCARD inline value_and_derivative<long double> assoc_laguerre_and_derivative(const unsigned _Degree,
+	const unsigned _Order, const long double _Value)
+	{
+	const auto _Result = _STD assoc_laguerre_and_derivative(_Degree, _Order, static_cast<double>(_Value));
+	return {_Result.value, _Result.derivative};
+	}
+
+	// evaluate L_n^m(x) and its derivative for each x in [_First, _Last)
+void assoc_laguerre_and_derivative_batch(unsigned _Degree, unsigned _Order, const double * _First,
+	const double * _Last, double * _Values, double * _Derivatives);
+void assoc_laguerre_and_derivative_batch(unsigned _Degree, unsigned _Order, const float * _First,
+	const float * _Last, float * _Values, float * _Derivatives);
+void assoc_laguerre_and_derivative_batch(unsigned _Degree, unsigned _Order, const long double * _First,
+	const long double * _Last, long double * _Values, long double * _Derivatives);
+
+	// store L_0^m(x), ..., L_N^m(x) at _Dest from one pass of the recurrence, returning
+	// the end of the sequence
+double * assoc_laguerre_sequence(unsigned _Max_degree, unsigned _Order, double _Value, double * _Dest);
+float * assoc_laguerre_sequence(unsigned _Max_degree, unsigned _Order, float _Value, float * _Dest);
+long double * assoc_laguerre_sequence(unsigned _Max_degree, unsigned _Order, long double _Value,
+	long double * _Dest);
+
+	// store L_n^m(x) for m = 0, ..., M and n = 0, ..., N at _Dest[m * (N + 1) + n],
+	// returning the end of the table
+double * assoc_laguerre_table(unsigned _Max_degree, unsigned _Max_order, double _Value, double * _Dest);
+float * assoc_laguerre_table(unsigned _Max_degree, unsigned _Max_order, float _Value, float * _Dest);
+long double * assoc_laguerre_table(unsigned _Max_degree, unsigned _Max_order, long double _Value,
+	long double * _Dest);
+
+template<unsigned _Degree,
+	unsigned _Order,
+	class _Ty,
+	enable_if_t<is_arithmetic_v<_Ty>, int> = 0>
+	_NODISCARD constexpr _Fixed_float_t<_Ty> assoc_laguerre(const _Ty _Value)
+	{	// compute L_n^m(x) for n and m fixed at compile time
+	return (_Fixed_polynomial<_Assoc_laguerre_terms<_Order>, _Degree>(
+		static_cast<_Fixed_float_t<_Ty>>(_Value)));
+	}
+
+	// Laguerre-Gauss beam modes at the waist w, normalized to unit power:
+	// LG_{p,l}(r, phi) = R_p^{|l|}(r) e^{i l phi}, where
+	// R_p^m(r) = sqrt(2 p! / (pi (p + m)!)) / w (sqrt(2) r / w)^m L_p^m(2r^2/w^2) e^{-r^2/w^2};
+	// w <= 0 and r < 0 are domain errors
+
+	// store R_p^m for p = 0, ..., _Max_radial at each r in [_First, _Last), each p in turn,
+	// returning the end of the profiles
+double * laguerre_gauss_radial(unsigned _Max_radial, unsigned _Order, double _Waist,
+	const double * _First, const double * _Last, double * _Dest);
+
+	// store LG_{p,l} for p = 0, ..., _Max_radial on the grid of x in [_X_first, _X_last) by
+	// y in [_Y_first, _Y_last), each p in turn as rows of constant y; pixels with the same
+	// |x| and |y|, in either order, share their radial values
+void laguerre_gauss_modes(unsigned _Max_radial, int _Charge, double _Waist,
+	const double * _X_first, const double * _X_last, const double * _Y_first, const double * _Y_last,
+	complex<double> * _Dest);
+
 _NODISCARD double assoc_legendre(unsigned _Degree, unsigned _Order, double _Value);
 _NODISCARD float assoc_legendref(unsigned _Degree, unsigned _Order, float _Value);
 _NODISCARD inline long double assoc_legendrel(const unsigned _Degree, const unsigned _Order,
@@ -28,6 +251,26 @@ _NODISCARD inline long double assoc_legendrel(const unsigned _Degree, const unsi
 	return (_STD assoc_legendre(_Degree, _Order, static_cast<double>(_Value)));
 	}
 
+	// compute P_l^m(x) and its derivative in one pass of the recurrence
+_NODISCARD value_and_derivative<double> assoc_legendre_and_derivative(unsigned _Degree, unsigned _Order,
+	double _Value);
+_NODISCARD value_and_derivative<float> assoc_legendre_and_derivative(unsigned _Degree, unsigned _Order,
+	float _Value);
+_NODISCARD inline value_and_derivative<long double> assoc_legendre_and_derivative(const unsigned _Degree,
+	const unsigned _Order, const long double _Value)
+	{
+	const auto _Result = _STD assoc_legendre_and_derivative(_Degree, _Order, static_cast<double>(_Value));
+	return {_Result.value, _Result.derivative};
+	}
+
+	// evaluate P_l^m(x) and its derivative for each x in [_First, _Last)
+void assoc_legendre_and_derivative_batch(unsigned _Degree, unsigned _Order, const double * _First,
+	const double * _Last, double * _Values, double * _Derivatives);
+void assoc_legendre_and_derivative_batch(unsigned _Degree, unsigned _Order, const float * _First,
+	const float * _Last, float * _Values, float * _Derivatives);
+void assoc_legendre_and_derivative_batch(unsigned _Degree, unsigned _Order, const long double * _First,
+	const long double * _Last, long double * _Values, long double * _Derivatives);
+
 _NODISCARD double beta(double _Arg1, double _Arg2);
 _NODISCARD float betaf(float _Arg1, float _Arg2);
 _NODISCARD inline long double betal(const long double _Arg1, const long double _Arg2)
@@ -35,6 +278,82 @@ _NODISCARD inline long double betal(const long double _Arg1, const long double _
 	return (_STD beta(static_cast<double>(_Arg1), static_cast<double>(_Arg2)));
 	}
 
+	// log B(a, b), finite where B(a, b) underflows; integer and half-integer a, b, and
+	// a + b up to 171.5 take exact Gamma values from a table
+_NODISCARD double lbeta(double _Arg1, double _Arg2);
+_NODISCARD float lbetaf(float _Arg1, float _Arg2);
+_NODISCARD inline long double lbetal(const long double _Arg1, const long double _Arg2)
+	{
+	return (_STD lbeta(static_cast<double>(_Arg1), static_cast<double>(_Arg2)));
+	}
+
+	// evaluate log B(a, b) for each a in [_First_a, _Last_a) and the b beside it
+double * lbeta_batch(const double * _First_a, const double * _Last_a, const double * _First_b,
+	double * _Dest);
+float * lbeta_batch(const float * _First_a, const float * _Last_a, const float * _First_b,
+	float * _Dest);
+long double * lbeta_batch(const long double * _First_a, const long double * _Last_a,
+	const long double * _First_b, long double * _Dest);
+
+	// evaluate log B(a, b) for one a and each b in [_First_b, _Last_b), the terms that
+	// depend on a alone computed once
+double * lbeta_batch(double _Arg1, const double * _First_b, const double * _Last_b,
+	double * _Dest);
+float * lbeta_batch(float _Arg1, const float * _First_b, const float * _Last_b, float * _Dest);
+long double * lbeta_batch(long double _Arg1, const long double * _First_b,
+	const long double * _Last_b, long double * _Dest);
+
+	// Carlson's symmetric integrals R_D(x, y, z), R_F(x, y, z), and R_J(x, y, z, p)
+_NODISCARD double carlson_rd(double _Xx, double _Yy, double _Zz);
+_NODISCARD float carlson_rd(float _Xx, float _Yy, float _Zz);
+_NODISCARD inline long double carlson_rd(const long double _Xx, const long double _Yy,
+	const long double _Zz)
+	{
+	return (_STD carlson_rd(static_cast<double>(_Xx), static_cast<double>(_Yy),
+		static_cast<double>(_Zz)));
+	}
+
+	// evaluate R_D(x[i], y[i], z[i]) for each x in [_First_x, _Last_x), storing the results at _Dest
+double * carlson_rd_batch(const double * _First_x, const double * _Last_x,
+	const double * _First_y, const double * _First_z, double * _Dest);
+float * carlson_rd_batch(const float * _First_x, const float * _Last_x,
+	const float * _First_y, const float * _First_z, float * _Dest);
+long double * carlson_rd_batch(const long double * _First_x, const long double * _Last_x,
+	const long double * _First_y, const long double * _First_z, long double * _Dest);
+
+_NODISCARD double carlson_rf(double _Xx, double _Yy, double _Zz);
+_NODISCARD float carlson_rf(float _Xx, float _Yy, float _Zz);
+_NODISCARD inline long double carlson_rf(const long double _Xx, const long double _Yy,
+	const long double _Zz)
+	{
+	return (_STD carlson_rf(static_cast<double>(_Xx), static_cast<double>(_Yy),
+		static_cast<double>(_Zz)));
+	}
+
+double * carlson_rf_batch(const double * _First_x, const double * _Last_x,
+	const double * _First_y, const double * _First_z, double * _Dest);
+float * carlson_rf_batch(const float * _First_x, const float * _Last_x,
+	const float * _First_y, const float * _First_z, float * _Dest);
+long double * carlson_rf_batch(const long double * _First_x, const long double * _Last_x,
+	const long double * _First_y, const long double * _First_z, long double * _Dest);
+
+_NODISCARD double carlson_rj(double _Xx, double _Yy, double _Zz, double _Pp);
+_NODISCARD float carlson_rj(float _Xx, float _Yy, float _Zz, float _Pp);
+_NODISCARD inline long double carlson_rj(const long double _Xx, const long double _Yy,
+	const long double _Zz, const long double _Pp)
+	{
+	return (_STD carlson_rj(static_cast<double>(_Xx), static_cast<double>(_Yy),
+		static_cast<double>(_Zz), static_cast<double>(_Pp)));
+	}
+
+double * carlson_rj_batch(const double * _First_x, const double * _Last_x,
+	const double * _First_y, const double * _First_z, const double * _First_p, double * _Dest);
+float * carlson_rj_batch(const float * _First_x, const float * _Last_x,
+	const float * _First_y, const float * _First_z, const float * _First_p, float * _Dest);
+long double * carlson_rj_batch(const long double * _First_x, const long double * _Last_x,
+	const long double * _First_y, const long double * _First_z, const long double * _First_p,
+	long double * _Dest);
+
 _NODISCARD double comp_ellint_1(double);
 _NODISCARD float comp_ellint_1f(float);
 _NODISCARD inline long double comp_ellint_1l(const long double _Arg)
@@ -49,6 +368,24 @@ _NODISCARD inline long double comp_ellint_2l(const long double _Arg)
 	return (_STD comp_ellint_2(static_cast<double>(_Arg)));
 	}
 
+	// compute K(k) and E(k) together from one arithmetic-geometric mean iteration
+_NODISCARD complete_elliptic_integrals<double> comp_ellint_1_2(double _Modulus);
+_NODISCARD complete_elliptic_integrals<float> comp_ellint_1_2(float _Modulus);
+_NODISCARD inline complete_elliptic_integrals<long double> comp_ellint_1_2(const long double _Modulus)
+	{
+	const auto _Result = _STD comp_ellint_1_2(static_cast<double>(_Modulus));
+	return {_Result.first_kind, _Result.second_kind};
+	}
+
+	// evaluate K(k) and E(k) for each k in [_First, _Last); either destination may be null, to
+	// store only the other kind
+void comp_ellint_1_2_batch(const double * _First, const double * _Last,
+	double * _First_kind, double * _Second_kind);
+void comp_ellint_1_2_batch(const float * _First, const float * _Last,
+	float * _First_kind, float * _Second_kind);
+void comp_ellint_1_2_batch(const long double * _First, const long double * _Last,
+	long double * _First_kind, long double * _Second_kind);
+
 _NODISCARD double comp_ellint_3(double, double);
 _NODISCARD float comp_ellint_3f(float, float);
 _NODISCARD inline long double comp_ellint_3l(const long double _Arg1, const long double _Arg2)
@@ -56,6 +393,15 @@ _NODISCARD inline long double comp_ellint_3l(const long double _Arg1, const long
 	return (_STD comp_ellint_3(static_cast<double>(_Arg1), static_cast<double>(_Arg2)));
 	}
 
+	// evaluate Pi(nu, k) for each nu in [_First, _Last) at one modulus, sharing the work
+	// that depends only on k
+double * comp_ellint_3_batch(double _Modulus, const double * _First, const double * _Last,
+	double * _Dest);
+float * comp_ellint_3_batch(float _Modulus, const float * _First, const float * _Last,
+	float * _Dest);
+long double * comp_ellint_3_batch(long double _Modulus, const long double * _First,
+	const long double * _Last, long double * _Dest);
+
 _NODISCARD double cyl_bessel_i(double, double);
 _NODISCARD float cyl_bessel_if(float, float);
 _NODISCARD inline long double cyl_bessel_il(const long double _Arg1, const long double _Arg2)
@@ -107,6 +453,91 @@ _NODISCARD inline long double ellint_3l(const long double _Arg1, const long doub
 		static_cast<double>(_Arg3)));
 	}
 
+	// compute F(k, phi), E(k, phi), and Pi(nu, k, phi) together from one Carlson duplication
+_NODISCARD incomplete_elliptic_integrals<double> ellint_1_2_3(double _Modulus, double _Characteristic,
+	double _Amplitude);
+_NODISCARD incomplete_elliptic_integrals<float> ellint_1_2_3(float _Modulus, float _Characteristic,
+	float _Amplitude);
+_NODISCARD inline incomplete_elliptic_integrals<long double> ellint_1_2_3(const long double _Modulus,
+	const long double _Characteristic, const long double _Amplitude)
+	{
+	const auto _Result = _STD ellint_1_2_3(static_cast<double>(_Modulus),
+		static_cast<double>(_Characteristic), static_cast<double>(_Amplitude));
+	return {_Result.first_kind, _Result.second_kind, _Result.third_kind};
+	}
+
+	// evaluate F(k[i], phi[i]) or E(k[i], phi[i]) for each k in [_First_k, _Last_k), storing the
+	// results at _Dest; the lanes of each block run the Carlson duplication together
+double * ellint_1_batch(const double * _First_k, const double * _Last_k,
+	const double * _First_phi, double * _Dest);
+float * ellint_1_batch(const float * _First_k, const float * _Last_k,
+	const float * _First_phi, float * _Dest);
+long double * ellint_1_batch(const long double * _First_k, const long double * _Last_k,
+	const long double * _First_phi, long double * _Dest);
+
+double * ellint_2_batch(const double * _First_k, const double * _Last_k,
+	const double * _First_phi, double * _Dest);
+float * ellint_2_batch(const float * _First_k, const float * _Last_k,
+	const float * _First_phi, float * _Dest);
+long double * ellint_2_batch(const long double * _First_k, const long double * _Last_k,
+	const long double * _First_phi, long double * _Dest);
+
+	// the amplitude phi with F(k, phi) = u, which is the Jacobi amplitude am(u, k)
+_NODISCARD double ellint_1_inverse(double _Modulus, double _Value);
+_NODISCARD float ellint_1_inverse(float _Modulus, float _Value);
+_NODISCARD inline long double ellint_1_inverse(const long double _Modulus, const long double _Value)
+	{
+	return (_STD ellint_1_inverse(static_cast<double>(_Modulus), static_cast<double>(_Value)));
+	}
+
+	// evaluate am(u[i], k[i]) for each k in [_First_k, _Last_k), storing the results at _Dest
+double * ellint_1_inverse_batch(const double * _First_k, const double * _Last_k,
+	const double * _First_u, double * _Dest);
+float * ellint_1_inverse_batch(const float * _First_k, const float * _Last_k,
+	const float * _First_u, float * _Dest);
+long double * ellint_1_inverse_batch(const long double * _First_k, const long double * _Last_k,
+	const long double * _First_u, long double * _Dest);
+
+class elliptic_plan
+	{	// F(k, phi), E(k, phi), and Pi(nu, k, phi) at one modulus and characteristic for any
+		// number of amplitudes; the complete integrals, which whole periods of phi add, are
+		// computed once
+public:
+	explicit elliptic_plan(double _Modulus, double _Characteristic = 0);
+
+	_NODISCARD double modulus() const noexcept
+		{
+		return (_Modulus);
+		}
+
+	_NODISCARD double characteristic() const noexcept
+		{
+		return (_Characteristic);
+		}
+
+	_NODISCARD complete_elliptic_integrals<double> complete() const noexcept
+		{	// K(k) and E(k)
+		return {_Complete.first_kind, _Complete.second_kind};
+		}
+
+	// ellint_1_2_3(k, nu, phi)
+	_NODISCARD incomplete_elliptic_integrals<double> operator()(double _Amplitude) const;
+
+	// ellint_1_inverse(k, u), with K(k) taken from the plan
+	_NODISCARD double amplitude(double _Value) const;
+	double * amplitude(const double * _First, const double * _Last, double * _Dest) const;
+
+	// evaluate F, E, or Pi at each phi in [_First, _Last), storing the results at _Dest
+	double * first_kind(const double * _First, const double * _Last, double * _Dest) const;
+	double * second_kind(const double * _First, const double * _Last, double * _Dest) const;
+	double * third_kind(const double * _First, const double * _Last, double * _Dest) const;
+
+private:
+	double _Modulus;
+	double _Characteristic;
+	incomplete_elliptic_integrals<double> _Complete;	// Pi only where its periods use it
+	};
+
 _NODISCARD double expint(double);
 _NODISCARD float expintf(float);
 _NODISCARD inline long double expintl(const long double _Arg)
@@ -114,6 +545,61 @@ _NODISCARD inline long double expintl(const long double _Arg)
 	return (_STD expint(static_cast<double>(_Arg)));
 	}
 
+	// evaluate Ei(x) for each x in [_First, _Last), picking a rational approximation per
+	// argument so that many arguments run at once
+double * expint_batch(const double * _First, const double * _Last, double * _Dest);
+float * expint_batch(const float * _First, const float * _Last, float * _Dest);
+long double * expint_batch(const long double * _First, const long double * _Last,
+	long double * _Dest);
+
+	// e^-x Ei(x), finite wherever Ei(x) overflows or underflows
+_NODISCARD double expint_scaled(double);
+_NODISCARD float expint_scaledf(float);
+_NODISCARD inline long double expint_scaledl(const long double _Arg)
+	{
+	return (_STD expint_scaled(static_cast<double>(_Arg)));
+	}
+
+	// evaluate e^-x Ei(x) for each x in [_First, _Last), storing the results at _Dest
+double * expint_scaled_batch(const double * _First, const double * _Last, double * _Dest);
+float * expint_scaled_batch(const float * _First, const float * _Last, float * _Dest);
+long double * expint_scaled_batch(const long double * _First, const long double * _Last,
+	long double * _Dest);
+
+	// store E_1(x), ..., E_N(x) at _Dest from one continued fraction or series and one
+	// exponential, returning the end of the sequence
+double * expint_n_sequence(unsigned _Max_order, double _Value, double * _Dest);
+float * expint_n_sequence(unsigned _Max_order, float _Value, float * _Dest);
+long double * expint_n_sequence(unsigned _Max_order, long double _Value, long double * _Dest);
+
+	// evaluate E_n(x) = integral from 1 to infinity of e^-xt / t^n dt for each x in
+	// [_First, _Last), storing the results at _Dest
+double * expint_n_batch(unsigned _Order, const double * _First, const double * _Last,
+	double * _Dest);
+float * expint_n_batch(unsigned _Order, const float * _First, const float * _Last,
+	float * _Dest);
+long double * expint_n_batch(unsigned _Order, const long double * _First,
+	const long double * _Last, long double * _Dest);
+
+struct quadrature_rule
+	{	// nodes in ascending order with their weights; the storage belongs to a
+		// process-wide cache and remains valid until exit
+	const double * nodes;
+	const double * weights;
+	size_t size;
+	};
+
+	// n-point Gauss-Hermite rule for the weight e^{-x^2} on the real line
+_NODISCARD quadrature_rule gauss_hermite_rule(unsigned _Points);
+
+	// n-point generalized Gauss-Laguerre rule for the weight x^alpha e^{-x} on [0, inf);
+	// alpha <= -1 is a domain error, giving an empty rule
+_NODISCARD quadrature_rule gauss_laguerre_rule(unsigned _Points, double _Alpha = 0);
+
+	// n-point Gauss-Legendre rule on [-1, 1]: generated once per n and cached, by
+	// Newton's method for small n and in O(1) per node from an asymptotic expansion above
+_NODISCARD quadrature_rule gauss_legendre_rule(unsigned _Points);
+
 _NODISCARD double hermite(unsigned, double);
 _NODISCARD float hermitef(unsigned, float);
 _NODISCARD inline long double hermitel(const unsigned _Arg1, const long double _Arg2)
@@ -121,6 +607,108 @@ _NODISCARD inline long double hermitel(const unsigned _Arg1, const long double _
 	return (_STD hermite(_Arg1, static_cast<double>(_Arg2)));
 	}
 
+struct _Hermite_terms
+	{	// H_{k+1}(x) = 2xH_k(x) - 2kH_{k-1}(x)
+	static constexpr unsigned _Horner_max = 6;
+
+	static constexpr long double _A(unsigned)
+		{
+		return (2.0L);
+		}
+
+	static constexpr long double _B(unsigned)
+		{
+		return (0.0L);
+		}
+
+	static constexpr long double _C(const unsigned _Kx)
+		{
+		return (2.0L * _Kx);
+		}
+	};
+
+template<unsigned _Degree,
+	class _Ty,
+	enable_if_t<is_arithmetic_v<_Ty>, int> = 0>
+	_NODISCARD constexpr _Fixed_float_t<_Ty> hermite(const _Ty _Value)
+	{	// compute H_n(x) for n fixed at compile time
+	return (_Fixed_polynomial<_Hermite_terms, _Degree>(static_cast<_Fixed_float_t<_Ty>>(_Value)));
+	}
+
+	// evaluate H_n(x) for each x in [_First, _Last), storing the results at _Dest
+double * hermite_batch(unsigned _Degree, const double * _First, const double * _Last, double * _Dest);
+float * hermite_batch(unsigned _Degree, const float * _First, const float * _Last, float * _Dest);
+long double * hermite_batch(unsigned _Degree, const long double * _First, const long double * _Last,
+	long double * _Dest);
+
+	// compute H_n(x) and its derivative in one pass of the recurrence
+_NODISCARD value_and_derivative<double> hermite_and_derivative(unsigned _Degree, double _Value);
+_NODISCARD value_and_derivative<float> hermite_and_derivative(unsigned _Degree, float _Value);
+_NODISCARD inline value_and_derivative<long double> hermite_and_derivative(const unsigned _Degree,
+	const long double _Value)
+	{
+	const auto _Result = _STD hermite_and_derivative(_Degree, static_cast<double>(_Value));
+	return {_Result.value, _Result.derivative};
+	}
+
+	// evaluate H_n(x) and its derivative for each x in [_First, _Last)
+void hermite_and_derivative_batch(unsigned _Degree, const double * _First, const double * _Last,
+	double * _Values, double * _Derivatives);
+void hermite_and_derivative_batch(unsigned _Degree, const float * _First, const float * _Last,
+	float * _Values, float * _Derivatives);
+void hermite_and_derivative_batch(unsigned _Degree, const long double * _First,
+	const long double * _Last, long double * _Values, long double * _Derivatives);
+
+	// the normalized Hermite function psi_n(x) = H_n(x) e^{-x^2/2} / sqrt(2^n n! sqrt(pi)),
+	// from its own recurrence, which neither overflows nor underflows for large n
+_NODISCARD double hermite_function(unsigned _Degree, double _Value);
+_NODISCARD float hermite_function(unsigned _Degree, float _Value);
+_NODISCARD inline long double hermite_function(const unsigned _Degree, const long double _Value)
+	{
+	return (_STD hermite_function(_Degree, static_cast<double>(_Value)));
+	}
+
+	// store psi_0(x), ..., psi_N(x) at _Dest, returning the end of the sequence
+double * hermite_function_sequence(unsigned _Max_degree, double _Value, double * _Dest);
+float * hermite_function_sequence(unsigned _Max_degree, float _Value, float * _Dest);
+long double * hermite_function_sequence(unsigned _Max_degree, long double _Value, long double * _Dest);
+
+	// evaluate psi_n(x) for each x in [_First, _Last), storing the results at _Dest
+double * hermite_function_batch(unsigned _Degree, const double * _First, const double * _Last,
+	double * _Dest);
+float * hermite_function_batch(unsigned _Degree, const float * _First, const float * _Last,
+	float * _Dest);
+long double * hermite_function_batch(unsigned _Degree, const long double * _First,
+	const long double * _Last, long double * _Dest);
+
+class hermite_transform
+	{	// transforms between values at the N Gauss-Hermite nodes and the coefficients of
+		// psi_0, ..., psi_{N-1}, exact for functions in their span; the matrices are built
+		// once and applied to any number of vectors by blocked, multithreaded products
+public:
+	explicit hermite_transform(unsigned _Size);
+
+	_NODISCARD size_t size() const noexcept
+		{
+		return (_Size);
+		}
+
+	_NODISCARD const double * nodes() const noexcept
+		{	// ascending, shared with gauss_hermite_rule
+		return (_Nodes);
+		}
+
+	// _Count vectors of N values or coefficients each, stored one after another
+	void forward(const double * _Values, double * _Coefficients, size_t _Count = 1) const;
+	void backward(const double * _Coefficients, double * _Values, size_t _Count = 1) const;
+
+private:
+	size_t _Size;
+	const double * _Nodes;
+	vector<double> _Analysis;	// [i][n] = lambda_i psi_n(x_i), lambda_i = 1 / sum_n psi_n(x_i)^2
+	vector<double> _Synthesis;	// [n][i] = psi_n(x_i)
+	};
+
 _NODISCARD double laguerre(unsigned, double);
 _NODISCARD float laguerref(unsigned, float);
 _NODISCARD inline long double laguerrel(const unsigned _Arg1, const long double _Arg2)
@@ -128,6 +716,44 @@ _NODISCARD inline long double laguerrel(const unsigned _Arg1, const long double
 	return (_STD laguerre(_Arg1, static_cast<double>(_Arg2)));
 	}
 
+	// evaluate L_n(x) for each x in [_First, _Last), storing the results at _Dest
+double * laguerre_batch(unsigned _Degree, const double * _First, const double * _Last, double * _Dest);
+float * laguerre_batch(unsigned _Degree, const float * _First, const float * _Last, float * _Dest);
+long double * laguerre_batch(unsigned _Degree, const long double * _First, const long double * _Last,
+	long double * _Dest);
+
+	// compute L_n(x) and its derivative in one pass of the recurrence
+_NODISCARD value_and_derivative<double> laguerre_and_derivative(unsigned _Degree, double _Value);
+_NODISCARD value_and_derivative<float> laguerre_and_derivative(unsigned _Degree, float _Value);
+_NODISCARD inline value_and_derivative<long double> laguerre_and_derivative(const unsigned _Degree,
+	const long double _Value)
+	{
+	const auto _Result = _STD laguerre_and_derivative(_Degree, static_cast<double>(_Value));
+	return {_Result.value, _Result.derivative};
+	}
+
+	// evaluate L_n(x) and its derivative for each x in [_First, _Last)
+void laguerre_and_derivative_batch(unsigned _Degree, const double * _First, const double * _Last,
+	double * _Values, double * _Derivatives);
+void laguerre_and_derivative_batch(unsigned _Degree, const float * _First, const float * _Last,
+	float * _Values, float * _Derivatives);
+void laguerre_and_derivative_batch(unsigned _Degree, const long double * _First,
+	const long double * _Last, long double * _Values, long double * _Derivatives);
+
+	// store L_0(x), ..., L_N(x) at _Dest from one pass of the recurrence, returning the
+	// end of the sequence
+double * laguerre_sequence(unsigned _Max_degree, double _Value, double * _Dest);
+float * laguerre_sequence(unsigned _Max_degree, float _Value, float * _Dest);
+long double * laguerre_sequence(unsigned _Max_degree, long double _Value, long double * _Dest);
+
+template<unsigned _Degree,
+	class _Ty,
+	enable_if_t<is_arithmetic_v<_Ty>, int> = 0>
+	_NODISCARD constexpr _Fixed_float_t<_Ty> laguerre(const _Ty _Value)
+	{	// compute L_n(x) for n fixed at compile time
+	return (_Fixed_polynomial<_Assoc_laguerre_terms<0>, _Degree>(static_cast<_Fixed_float_t<_Ty>>(_Value)));
+	}
+
 _NODISCARD double legendre(unsigned _Degree, double _Value);
 _NODISCARD float legendref(unsigned _Degree, float _Value);
 _NODISCARD inline long double legendrel(const unsigned _Degree, const long double _Value)
@@ -135,6 +761,59 @@ _NODISCARD inline long double legendrel(const unsigned _Degree, const long doubl
 	return (_STD legendre(_Degree, static_cast<double>(_Value)));
 	}
 
+	// evaluate P_l(x) for each x in [_First, _Last), storing the results at _Dest
+double * legendre_batch(unsigned _Degree, const double * _First, const double * _Last, double * _Dest);
+float * legendre_batch(unsigned _Degree, const float * _First, const float * _Last, float * _Dest);
+long double * legendre_batch(unsigned _Degree, const long double * _First, const long double * _Last,
+	long double * _Dest);
+
+	// compute P_l(x) and its derivative in one pass of the recurrence
+_NODISCARD value_and_derivative<double> legendre_and_derivative(unsigned _Degree, double _Value);
+_NODISCARD value_and_derivative<float> legendre_and_derivative(unsigned _Degree, float _Value);
+_NODISCARD inline value_and_derivative<long double> legendre_and_derivative(const unsigned _Degree,
+	const long double _Value)
+	{
+	const auto _Result = _STD legendre_and_derivative(_Degree, static_cast<double>(_Value));
+	return {_Result.value, _Result.derivative};
+	}
+
+	// evaluate P_l(x) and its derivative for each x in [_First, _Last)
+void legendre_and_derivative_batch(unsigned _Degree, const double * _First, const double * _Last,
+	double * _Values, double * _Derivatives);
+void legendre_and_derivative_batch(unsigned _Degree, const float * _First, const float * _Last,
+	float * _Values, float * _Derivatives);
+void legendre_and_derivative_batch(unsigned _Degree, const long double * _First,
+	const long double * _Last, long double * _Values, long double * _Derivatives);
+
+struct _Legendre_terms
+	{	// (k+1)P_{k+1}(x) = (2k+1)xP_k(x) - kP_{k-1}(x)
+	static constexpr unsigned _Horner_max = 6;
+
+	static constexpr long double _A(const unsigned _Kx)
+		{
+		return (static_cast<long double>(2 * _Kx + 1) / (_Kx + 1));
+		}
+
+	static constexpr long double _B(unsigned)
+		{
+		return (0.0L);
+		}
+
+	static constexpr long double _C(const unsigned _Kx)
+		{
+		return (static_cast<long double>(_Kx) / (_Kx + 1));
+		}
+	};
+
+template<unsigned _Degree,
+	class _Ty,
+	enable_if_t<is_arithmetic_v<_Ty>, int> = 0>
+	_NODISCARD constexpr _Fixed_float_t<_Ty> legendre(const _Ty _Value)
+	{	// compute P_l(x) for l fixed at compile time; like the polynomial itself,
+		// this is defined for all x, so no |x| <= 1 domain check is made
+	return (_Fixed_polynomial<_Legendre_terms, _Degree>(static_cast<_Fixed_float_t<_Ty>>(_Value)));
+	}
+
 _NODISCARD double riemann_zeta(double);
 _NODISCARD float riemann_zetaf(float);
 _NODISCARD inline long double riemann_zetal(const long double _Arg)
@@ -142,6 +821,13 @@ _NODISCARD inline long double riemann_zetal(const long double _Arg)
 	return (_STD riemann_zeta(static_cast<double>(_Arg)));
 	}
 
+	// evaluate zeta(s) for each s in [_First, _Last), running the series for many arguments
+	// at once
+double * riemann_zeta_batch(const double * _First, const double * _Last, double * _Dest);
+float * riemann_zeta_batch(const float * _First, const float * _Last, float * _Dest);
+long double * riemann_zeta_batch(const long double * _First, const long double * _Last,
+	long double * _Dest);
+
 _NODISCARD double sph_bessel(unsigned, double);
 _NODISCARD float sph_besself(unsigned, float);
 _NODISCARD inline long double sph_bessell(const unsigned _Arg1, const long double _Arg2)
@@ -183,5 +869,514 @@ template<class _Ty1,
 	return (_STD hypot(static_cast<_Common>(_Dx), static_cast<_Common>(_Dy),
 		static_cast<_Common>(_Dz)));
 	}
+
+	// the instruction sets the batch functions are built for, where smf is configured with
+	// SMF_BATCH_DISPATCH; the first batch call picks the widest one this processor runs,
+	// unless the environment variable SMF_BATCH_ISA names another it runs (scalar, avx2, or
+	// avx512)
+enum class batch_isa
+	{
+	scalar,
+	avx2,	// AVX2 and FMA
+	avx512	// AVX-512 F, CD, BW, DQ, and VL
+	};
+
+_NODISCARD batch_isa current_batch_isa() noexcept;
+_NODISCARD bool batch_isa_available(batch_isa _Isa) noexcept;
+	// the instruction set the compiler targeted for the build _Isa selects: _Isa itself where
+	// smf was built with that build's flags, otherwise the baseline it fell back to
+_NODISCARD batch_isa batch_isa_compiled(batch_isa _Isa) noexcept;
+	// run the batch functions on _Isa from here on; false, and no change, where _Isa is not
+	// available
+bool set_batch_isa(batch_isa _Isa) noexcept;
+
+#if _HAS_CXX20
+	// array forms: f(policy, [orders,] inputs..., dest) stores f at each index of the shortest
+	// of the spans in dest, returning the part of dest written; orders are shared by every
+	// element. The indices are cut into chunks of a fixed size whatever the policy, each chunk
+	// run by f's batch function where it has one, so the results do not depend on the number of
+	// threads. The parallel policies spread the chunks over parallel_threads() threads, and
+	// errno after the call is the one the lowest failing chunk set.
+
+	// the threads the parallel array forms run on; 0, the default, asks for one per hardware
+	// thread
+void set_parallel_threads(unsigned _Threads) noexcept;
+_NODISCARD unsigned parallel_threads() noexcept;
+
+	// run _Chunk(_Context, _First, _Last) for each chunk of [0, _Count), spread over
+	// parallel_threads() threads where _Parallel
+void _Run_chunks(size_t _Count, bool _Parallel, void (*_Chunk)(const void *, size_t, size_t),
+	const void * _Context);
+
+template<class _ExPo,
+	class _Ty>
+	using _Enable_if_array_form_t = enable_if_t<is_execution_policy_v<remove_cvref_t<_ExPo>>
+		&& is_floating_point_v<_Ty>, int>;
+
+template<class _ExPo>
+	constexpr bool _Runs_in_parallel_v =
+		!is_same_v<remove_cvref_t<_ExPo>, execution::sequenced_policy>
+		&& !is_same_v<remove_cvref_t<_ExPo>, execution::unsequenced_policy>;
+
+template<class _Ty,
+	class _Param>
+	using _Retyped_t = conditional_t<is_same_v<_Param, float>, _Ty, _Param>;
+
+template<class... _Params>
+	constexpr auto _Typed_form(float, float (* const _Float)(_Params...),
+		double (*)(_Retyped_t<double, _Params>...),
+		long double (*)(_Retyped_t<long double, _Params>...))
+	{	// of the f, unsuffixed, and l forms of a function, the one for float; the parameters
+		// of the f form pick the others from their overloads
+	return (_Float);
+	}
+
+template<class... _Params>
+	constexpr auto _Typed_form(double, float (*)(_Params...),
+		double (* const _Double)(_Retyped_t<double, _Params>...),
+		long double (*)(_Retyped_t<long double, _Params>...))
+	{	// the one for double
+	return (_Double);
+	}
+
+template<class... _Params>
+	constexpr auto _Typed_form(long double, float (*)(_Params...),
+		double (*)(_Retyped_t<double, _Params>...),
+		long double (* const _Long)(_Retyped_t<long double, _Params>...))
+	{	// the one for long double
+	return (_Long);
+	}
+
+template<class _Ty,
+	class... _Inputs>
+	constexpr size_t _Common_extent(const span<_Ty> _Dest, const span<_Inputs>... _In)
+	{	// the extent of the shortest span
+	size_t _Count = _Dest.size();
+	((_Count = _In.size() < _Count ? _In.size() : _Count), ...);
+	return (_Count);
+	}
+
+template<class _ExPo,
+	class _Ty,
+	class _Fn>
+	span<_Ty> _Parallel_chunks(const span<_Ty> _Dest, const size_t _Count, const _Fn& _Chunk)
+	{	// call _Chunk(_First, _Last) for each chunk of [0, _Count) as _ExPo allows
+	_STD _Run_chunks(_Count, _Runs_in_parallel_v<_ExPo>,
+		[](const void * const _Context, const size_t _First, const size_t _Last)
+			{
+			(*static_cast<const _Fn *>(_Context))(_First, _Last);
+			}, &_Chunk);
+	return (_Dest.first(_Count));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	class _Batch_fn,
+	class... _Inputs>
+	span<_Ty> _Parallel_batch(const span<_Ty> _Dest, const _Batch_fn _Batch,
+		const span<const _Ty> _Leading, const span<_Inputs>... _In)
+	{	// _Batch(_First, _Last, _In..., _Dest) over each chunk, in the shape of the batch
+		// functions: a range of the leading input, then the start of each other input
+	return (_Parallel_chunks<_ExPo>(_Dest, _Common_extent(_Dest, _Leading, _In...),
+		[=](const size_t _First, const size_t _Last)
+			{
+			_Batch(_Leading.data() + _First, _Leading.data() + _Last, (_In.data() + _First)...,
+				_Dest.data() + _First);
+			}));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	class _Fn,
+	class... _Inputs>
+	span<_Ty> _Parallel_each(const span<_Ty> _Dest, const _Fn _Func, const span<_Inputs>... _In)
+	{	// _Dest[i] = _Func(_In[i]...), for functions with no batch form
+	return (_Parallel_chunks<_ExPo>(_Dest, _Common_extent(_Dest, _In...),
+		[=](const size_t _First, const size_t _Last)
+			{
+			for (size_t _Idx = _First; _Idx < _Last; ++_Idx)
+				{
+				_Dest[_Idx] = _Func(_In[_Idx]...);
+				}
+			}));
+	}
+
+template<class _Ty>
+	using _Array_input_t = span<const type_identity_t<_Ty>>;
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> assoc_laguerre(_ExPo&&, const unsigned _Degree, const unsigned _Order,
+		const _Array_input_t<_Ty> _Values, const span<_Ty> _Dest)
+	{
+	const auto _Form = _Typed_form(_Ty{}, _STD assoc_laguerref, _STD assoc_laguerre, _STD assoc_laguerrel);
+	return (_Parallel_each<_ExPo>(_Dest, [=](const _Ty _Value)
+		{
+		return (_Form(_Degree, _Order, _Value));
+		}, _Values));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> assoc_legendre(_ExPo&&, const unsigned _Degree, const unsigned _Order,
+		const _Array_input_t<_Ty> _Values, const span<_Ty> _Dest)
+	{
+	const auto _Form = _Typed_form(_Ty{}, _STD assoc_legendref, _STD assoc_legendre, _STD assoc_legendrel);
+	return (_Parallel_each<_ExPo>(_Dest, [=](const _Ty _Value)
+		{
+		return (_Form(_Degree, _Order, _Value));
+		}, _Values));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> beta(_ExPo&&, const _Array_input_t<_Ty> _Args1, const _Array_input_t<_Ty> _Args2,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest, _Typed_form(_Ty{}, _STD betaf, _STD beta, _STD betal),
+		_Args1, _Args2));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> lbeta(_ExPo&&, const _Array_input_t<_Ty> _Args1, const _Array_input_t<_Ty> _Args2,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD lbeta_batch(_Pointers...));
+		}, _Args1, _Args2));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> lbeta(_ExPo&&, const type_identity_t<_Ty> _Arg1, const _Array_input_t<_Ty> _Args2,
+		const span<_Ty> _Dest)
+	{	// one a for every b
+	return (_Parallel_batch<_ExPo>(_Dest, [_Arg1](const auto... _Pointers)
+		{
+		return (_STD lbeta_batch(_Arg1, _Pointers...));
+		}, _Args2));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> carlson_rd(_ExPo&&, const _Array_input_t<_Ty> _Xx, const _Array_input_t<_Ty> _Yy,
+		const _Array_input_t<_Ty> _Zz, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD carlson_rd_batch(_Pointers...));
+		}, _Xx, _Yy, _Zz));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> carlson_rf(_ExPo&&, const _Array_input_t<_Ty> _Xx, const _Array_input_t<_Ty> _Yy,
+		const _Array_input_t<_Ty> _Zz, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD carlson_rf_batch(_Pointers...));
+		}, _Xx, _Yy, _Zz));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> carlson_rj(_ExPo&&, const _Array_input_t<_Ty> _Xx, const _Array_input_t<_Ty> _Yy,
+		const _Array_input_t<_Ty> _Zz, const _Array_input_t<_Ty> _Pp, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD carlson_rj_batch(_Pointers...));
+		}, _Xx, _Yy, _Zz, _Pp));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> comp_ellint_1(_ExPo&&, const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{	// the batch function, storing K(k) alone
+	return (_Parallel_batch<_ExPo>(_Dest, [](const _Ty * const _First, const _Ty * const _Last,
+		_Ty * const _First_kind)
+		{
+		_STD comp_ellint_1_2_batch(_First, _Last, _First_kind, static_cast<_Ty *>(nullptr));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> comp_ellint_2(_ExPo&&, const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{	// the batch function, storing E(k) alone
+	return (_Parallel_batch<_ExPo>(_Dest, [](const _Ty * const _First, const _Ty * const _Last,
+		_Ty * const _Second_kind)
+		{
+		_STD comp_ellint_1_2_batch(_First, _Last, static_cast<_Ty *>(nullptr), _Second_kind);
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> comp_ellint_3(_ExPo&&, const _Array_input_t<_Ty> _Moduli,
+		const _Array_input_t<_Ty> _Characteristics, const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest,
+		_Typed_form(_Ty{}, _STD comp_ellint_3f, _STD comp_ellint_3, _STD comp_ellint_3l),
+		_Moduli, _Characteristics));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> comp_ellint_3(_ExPo&&, const type_identity_t<_Ty> _Modulus,
+		const _Array_input_t<_Ty> _Characteristics, const span<_Ty> _Dest)
+	{	// one k for every nu
+	return (_Parallel_batch<_ExPo>(_Dest, [_Modulus](const auto... _Pointers)
+		{
+		return (_STD comp_ellint_3_batch(_Modulus, _Pointers...));
+		}, _Characteristics));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> cyl_bessel_i(_ExPo&&, const _Array_input_t<_Ty> _Orders,
+		const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest,
+		_Typed_form(_Ty{}, _STD cyl_bessel_if, _STD cyl_bessel_i, _STD cyl_bessel_il), _Orders, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> cyl_bessel_j(_ExPo&&, const _Array_input_t<_Ty> _Orders,
+		const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest,
+		_Typed_form(_Ty{}, _STD cyl_bessel_jf, _STD cyl_bessel_j, _STD cyl_bessel_jl), _Orders, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> cyl_bessel_k(_ExPo&&, const _Array_input_t<_Ty> _Orders,
+		const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest,
+		_Typed_form(_Ty{}, _STD cyl_bessel_kf, _STD cyl_bessel_k, _STD cyl_bessel_kl), _Orders, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> cyl_neumann(_ExPo&&, const _Array_input_t<_Ty> _Orders,
+		const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest,
+		_Typed_form(_Ty{}, _STD cyl_neumannf, _STD cyl_neumann, _STD cyl_neumannl), _Orders, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> ellint_1(_ExPo&&, const _Array_input_t<_Ty> _Moduli,
+		const _Array_input_t<_Ty> _Amplitudes, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD ellint_1_batch(_Pointers...));
+		}, _Moduli, _Amplitudes));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> ellint_2(_ExPo&&, const _Array_input_t<_Ty> _Moduli,
+		const _Array_input_t<_Ty> _Amplitudes, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD ellint_2_batch(_Pointers...));
+		}, _Moduli, _Amplitudes));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> ellint_3(_ExPo&&, const _Array_input_t<_Ty> _Moduli,
+		const _Array_input_t<_Ty> _Characteristics, const _Array_input_t<_Ty> _Amplitudes,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest, _Typed_form(_Ty{}, _STD ellint_3f, _STD ellint_3, _STD ellint_3l),
+		_Moduli, _Characteristics, _Amplitudes));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> ellint_1_inverse(_ExPo&&, const _Array_input_t<_Ty> _Moduli,
+		const _Array_input_t<_Ty> _Values, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD ellint_1_inverse_batch(_Pointers...));
+		}, _Moduli, _Values));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> expint(_ExPo&&, const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD expint_batch(_Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> expint_scaled(_ExPo&&, const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD expint_scaled_batch(_Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> expint_n(_ExPo&&, const unsigned _Order, const _Array_input_t<_Ty> _Args,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [_Order](const auto... _Pointers)
+		{
+		return (_STD expint_n_batch(_Order, _Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> hermite(_ExPo&&, const unsigned _Degree, const _Array_input_t<_Ty> _Args,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [_Degree](const auto... _Pointers)
+		{
+		return (_STD hermite_batch(_Degree, _Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> hermite_function(_ExPo&&, const unsigned _Degree, const _Array_input_t<_Ty> _Args,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [_Degree](const auto... _Pointers)
+		{
+		return (_STD hermite_function_batch(_Degree, _Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> laguerre(_ExPo&&, const unsigned _Degree, const _Array_input_t<_Ty> _Args,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [_Degree](const auto... _Pointers)
+		{
+		return (_STD laguerre_batch(_Degree, _Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> legendre(_ExPo&&, const unsigned _Degree, const _Array_input_t<_Ty> _Args,
+		const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [_Degree](const auto... _Pointers)
+		{
+		return (_STD legendre_batch(_Degree, _Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> riemann_zeta(_ExPo&&, const _Array_input_t<_Ty> _Args, const span<_Ty> _Dest)
+	{
+	return (_Parallel_batch<_ExPo>(_Dest, [](const auto... _Pointers)
+		{
+		return (_STD riemann_zeta_batch(_Pointers...));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> sph_bessel(_ExPo&&, const unsigned _Order, const _Array_input_t<_Ty> _Args,
+		const span<_Ty> _Dest)
+	{
+	const auto _Form = _Typed_form(_Ty{}, _STD sph_besself, _STD sph_bessel, _STD sph_bessell);
+	return (_Parallel_each<_ExPo>(_Dest, [=](const _Ty _Arg)
+		{
+		return (_Form(_Order, _Arg));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> sph_legendre(_ExPo&&, const unsigned _Degree, const unsigned _Order,
+		const _Array_input_t<_Ty> _Angles, const span<_Ty> _Dest)
+	{
+	const auto _Form = _Typed_form(_Ty{}, _STD sph_legendref, _STD sph_legendre, _STD sph_legendrel);
+	return (_Parallel_each<_ExPo>(_Dest, [=](const _Ty _Theta)
+		{
+		return (_Form(_Degree, _Order, _Theta));
+		}, _Angles));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> sph_neumann(_ExPo&&, const unsigned _Order, const _Array_input_t<_Ty> _Args,
+		const span<_Ty> _Dest)
+	{
+	const auto _Form = _Typed_form(_Ty{}, _STD sph_neumannf, _STD sph_neumann, _STD sph_neumannl);
+	return (_Parallel_each<_ExPo>(_Dest, [=](const _Ty _Arg)
+		{
+		return (_Form(_Order, _Arg));
+		}, _Args));
+	}
+
+template<class _ExPo,
+	class _Ty,
+	_Enable_if_array_form_t<_ExPo, _Ty> = 0>
+	span<_Ty> hypot(_ExPo&&, const _Array_input_t<_Ty> _Dx, const _Array_input_t<_Ty> _Dy,
+		const _Array_input_t<_Ty> _Dz, const span<_Ty> _Dest)
+	{
+	return (_Parallel_each<_ExPo>(_Dest, [](const _Ty _Xx, const _Ty _Yy, const _Ty _Zz)
+		{
+		return (_STD hypot(_Xx, _Yy, _Zz));
+		}, _Dx, _Dy, _Dz));
+	}
+#endif /* _HAS_CXX20 */
 #endif /* _HAS_CXX17 */
 _STD_END
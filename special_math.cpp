@@ -1,515 +1,5124 @@
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <cmath>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <numeric>
 #include <limits>
+#include <map>
+#include <mutex>
+#include <thread>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <boost/math/tools/config.hpp>
 #include <boost/math/tools/precision.hpp>
 #include <boost/math/special_functions.hpp>
 #include "special.hpp"
+#include "special_math_kernels.hpp"
+
+#if defined(_M_IX86) || defined(_M_X64)
+#include <intrin.h>
+#elif defined(__i386__) || defined(__x86_64__)
+#include <cpuid.h>
+#endif /* defined(_M_IX86) || defined(_M_X64) */
 
 _STD_BEGIN
 namespace {
-template<class _Func> inline
-	auto _Boost_call(const _Func _Fn)
-	{
-	_TRY_BEGIN
-		return _Fn();
-	_CATCH(boost::math::rounding_error&)
-		_THROW(domain_error("FIXME: boost::math::rounding_error"));
-	_CATCH(boost::math::evaluation_error&)
-		_THROW(domain_error("FIXME: boost::math::evaluation_error"));
-	_CATCH_END
-	}
-} // unnamed namespace
-
-double assoc_laguerre(const unsigned _Pn, const unsigned _Pm, const double _Px)
-	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
-		}
-
-	return (_Boost_call([=]{ return boost::math::laguerre(_Pn, _Pm, _Px); }));
-	}
+	// Boost reports its errors through errno, as this library reports its own, so that no
+	// call sets up an exception frame: domain, pole, and evaluation errors set EDOM,
+	// rounding errors ERANGE, and overflow saturates
+using _Errno_policy = boost::math::policies::policy<
+	boost::math::policies::domain_error<boost::math::policies::errno_on_error>,
+	boost::math::policies::pole_error<boost::math::policies::errno_on_error>,
+	boost::math::policies::overflow_error<boost::math::policies::ignore_error>,
+	boost::math::policies::evaluation_error<boost::math::policies::errno_on_error>,
+	boost::math::policies::rounding_error<boost::math::policies::errno_on_error>>;
 
-float assoc_laguerref(const unsigned _Pn, const unsigned _Pm, const float _Px)
-	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
+template<class _Func,
+	class... _Ty> inline
+	auto _Boost_call(const _Func _Fn, const _Ty... _Args) noexcept
+	{	// _Fn(_Args..., _Errno_policy()), the first NaN among _Args passing through; x * 0 is
+		// 0 for finite x and NaN otherwise, so one comparison clears the usual case
+	using _Result = decltype(_Fn(_Args..., _Errno_policy()));
+	if ((... + (_Args * 0)) != 0)
+		{	// NaN or infinite somewhere
+		_Result _Nan = 0;
+		if ((... || (_CSTD isnan(static_cast<double>(_Args))
+			&& (_Nan = static_cast<_Result>(_Args), true))))
+			{
+			return (_Nan);
+			}
 		}
 
-	return (_Boost_call([=]{ return boost::math::laguerre(_Pn, _Pm, _Px); }));
+	return (_Fn(_Args..., _Errno_policy()));
 	}
 
-double assoc_legendre(const unsigned _Pl, const unsigned _Pm, const double _Px)
-	{
-	if (_CSTD isnan(_Px))
+template<class _Func,
+	class _Ty> inline
+	_Ty _Bessel_call(const _Func _Fn, const _Ty _Pnu, const _Ty _Px) noexcept
+	{	// _Boost_call for the cylinder functions, whose orders past INT_MAX reach Boost
+		// rounding or evaluation errors it cannot continue from without unwinding
+	if (static_cast<_Ty>(numeric_limits<int>::max()) < _CSTD fabs(_Pnu) && !_CSTD isnan(_Px))
 		{
-		return (_Px);
+		errno = EDOM;
+		return (numeric_limits<_Ty>::quiet_NaN());
 		}
 
-	return (_Boost_call([=]{ return boost::math::legendre_p(_Pl, _Pm, _Px); }));
+	return (_Boost_call(_Fn, _Pnu, _Px));
 	}
 
-float assoc_legendref(const unsigned _Pl, const unsigned _Pm, const float _Px)
-	{
-	if (_CSTD isnan(_Px))
+double _Rational_fit(const double * const _Coeff, const size_t _Degree, const size_t _Region,
+	const double _Var)
+	{	// P(v) / Q(v) for one region of a table holding P then Q for each region, lowest
+		// order first and padded to _Degree
+	const double * const _Num = _Coeff + 2 * _Region * (_Degree + 1);
+	const double * const _Den = _Num + (_Degree + 1);
+	double _Pv = 0;
+	double _Qv = 0;
+	for (size_t _Idx = _Degree + 1; 0 < _Idx--; )
 		{
-		return (_Px);
+		_Pv = _Pv * _Var + _Num[_Idx];
+		_Qv = _Qv * _Var + _Den[_Idx];
 		}
 
-	return (_Boost_call([=]{ return boost::math::legendre_p(_Pl, _Pm, _Px); }));
-	}
-
-double beta(const double _Px, const double _Py)
-	{
-	return (_Boost_call([=]{ return boost::math::beta(_Px, _Py); }));
+	return (_Pv / _Qv);
 	}
 
-float betaf(const float _Px, const float _Py)
-	{
-	return (_Boost_call([=]{ return boost::math::beta(_Px, _Py); }));
-	}
+struct _Bessel_j_float_fits
+	{	// J_0 and J_1 to a few hundredths of a float ulp in double arithmetic, in the forms
+		// of boost::math's bessel_j0 and bessel_j1 at lower degree: for x <= 4 and for
+		// 4 < x <= 8, J_n(x) = x^n (x - r)(x + r) P/Q(x^2) about the root r there; past 8,
+		// with y = 8 / x, the Hankel amplitudes P/Q(y^2) and y P/Q(y^2)
+	static constexpr double _Roots[2][2][2] =
+		{	// hi and lo, for each order and region
+		{{0x1.33d152e971b40p+1, -1.176691651530894036279e-16},
+			{0x1.6148f5b2c2e45p+2, 8.088597146146722331758e-17}},
+		{{0x1.ea75575af6f09p+1, -1.526918409008806685673e-16},
+			{0x1.c0ff5f3b47250p+2, -9.414165653410388907504e-17}},
+		};
 
-double comp_ellint_1(const double _Pk)
-	{
-	return (_Boost_call([=]{ return boost::math::ellint_1(_Pk); }));
-	}
+	static constexpr size_t _Near_degree = 5;
+	static constexpr double _Near_coeff[2][24] =
+		{	// P then Q, lowest order first, for x <= 4 then 4 < x <= 8, for each order
+			{
+			-1.729150692951546275378e-01, 9.950989440710201333617e-03, -1.677123387175613600242e-04,
+			8.985858632868612895804e-07, 0.0, 0.0,
+			1.000000000000000000000e+00, 1.953651695587133030330e-02, 1.800209847671045595551e-04,
+			8.701247692768911532097e-07, 0.0, 0.0,
+			-3.281759553620604979995e-02, 6.677587378054503954028e-03, -1.842095233224501100305e-04,
+			1.915230926290689057078e-06, -8.686376394430108242650e-09, 1.471622045772677763781e-11,
+			1.000000000000000000000e+00, 1.370559016842011999804e-02, 9.244862678850525989326e-05,
+			3.863313869456351436221e-07, 1.083699332403542225691e-09, 0.0,
+			},
+			{
+			-3.405537392206187813359e-02, 1.365740818438582367123e-03, -1.730765856620278408278e-05,
+			7.365976942168604367552e-08, 0.0, 0.0,
+			1.000000000000000000000e+00, 1.678572047435191935683e-02, 1.295828797091264474386e-04,
+			5.015540704856037056703e-07, 0.0, 0.0,
+			-1.015878694552914927873e-02, 9.393375656397486310120e-04, -1.904443072428042317557e-05,
+			1.579274841950475910266e-07, -5.967090811213721914319e-10, 8.691820323262056981399e-13,
+			1.000000000000000000000e+00, 1.221680150734260478229e-02, 7.213842204654996332486e-05,
+			2.582972519386032545410e-07, 5.554953352004832445163e-10, 0.0,
+			},
+		};
 
-float comp_ellint_1f(const float _Pk)
-	{
-	return (_Boost_call([=]{ return boost::math::ellint_1(_Pk); }));
-	}
+	static constexpr size_t _Far_degree = 4;
+	static constexpr double _Far_coeff[2][20] =
+		{	// P then Q, lowest order first, for the amplitudes of cos and sin, for each order,
+			// to double accuracy since they cancel near the roots
+			{
+			9.999999999999998889777e-01, 1.039680742064373220046e+00, 2.576824570126510782764e-01,
+			1.504081051591454019911e-02, 1.052536335418361156677e-04,
+			1.000000000000000000000e+00, 1.040779374876845464470e+00, 2.587985105017238662839e-01,
+			1.529882149924339726499e-02, 1.168863146136581019274e-04,
+			-1.562499999999992020272e-02, -1.919854635418404009695e-02, -5.826858021256434844171e-03,
+			-4.371479176609802791940e-04, -3.894457283452527237276e-06,
+			1.000000000000000000000e+00, 1.237862240104154576414e+00, 3.838083103705368093195e-01,
+			3.099498332248107682063e-02, 4.164128759334985419548e-04,
+			},
+			{
+			1.000000000000000222045e+00, 1.014050429967612076965e+00, 2.426814641644117198638e-01,
+			1.350349602951064244272e-02, 9.516876127473455633087e-05,
+			1.000000000000000000000e+00, 1.012219375280144273432e+00, 2.408632391247538251378e-01,
+			1.309551544921424420798e-02, 7.746718314342162039782e-05,
+			4.687499999999990979438e-02, 5.652131140433575007265e-02, 1.676371792811343422458e-02,
+			1.231047193127900694909e-03, 1.178157671494133059537e-05,
+			1.000000000000000000000e+00, 1.210060437562903601361e+00, 3.626152046005768903036e-01,
+			2.761320380448955766339e-02, 3.239965801746368546238e-04,
+			},
+		};
+	};
 
-double comp_ellint_2(const double _Pk)
-	{
-	if (_CSTD isnan(_Pk))
+double _Bessel_j_float(const bool _First, const double _Px)
+	{	// J_0(x), or J_1(x) if _First, for finite x >= 0, to float accuracy
+	using _Fits = _Bessel_j_float_fits;
+	if (_Px <= 8)
 		{
-		return (_Pk);
+		const size_t _Region = _Px <= 4 ? 0 : 1;
+		const double * const _Root = _Fits::_Roots[_First][_Region];
+		const double _Value = ((_Px - _Root[0]) - _Root[1]) * (_Px + _Root[0])
+			* _Rational_fit(_Fits::_Near_coeff[_First], _Fits::_Near_degree, _Region, _Px * _Px);
+		return (_First ? _Px * _Value : _Value);
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_2(_Pk); }));
+	// J_0 = (P cos(x - pi / 4) - Q sin(x - pi / 4)) sqrt(2 / (pi x)), and J_1 likewise
+	// about x - 3 pi / 4, with the shifts taken into sums of sin x and cos x
+	const double _Yy = 8 / _Px;
+	const double _Zz = _Yy * _Yy;
+	const double _Pv = _Rational_fit(_Fits::_Far_coeff[_First], _Fits::_Far_degree, 0, _Zz);
+	const double _Qv = _Yy * _Rational_fit(_Fits::_Far_coeff[_First], _Fits::_Far_degree, 1, _Zz);
+	const double _Sx = _CSTD sin(_Px);
+	const double _Cx = _CSTD cos(_Px);
+	const double _Scale = 1 / _CSTD sqrt(boost::math::double_constants::pi * _Px);
+	return (_First ? _Scale * (_Pv * (_Sx - _Cx) + _Qv * (_Sx + _Cx))
+		: _Scale * (_Pv * (_Cx + _Sx) - _Qv * (_Sx - _Cx)));
 	}
+} // unnamed namespace
 
-float comp_ellint_2f(const float _Pk)
+namespace {
+	// three-term recurrences shared by the batch and derivative entry points: the starting
+	// values and the domain here, the steps and their lanes in special_math_kernels.hpp
+struct _Recurrence_defaults
 	{
-	if (_CSTD isnan(_Pk))
+	static bool _In_domain(double)
 		{
-		return (_Pk);
+		return (true);
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_2(_Pk); }));
-	}
+	static double _Finish_derivative(double, const double _Dp)
+		{
+		return (_Dp);
+		}
+	};
 
-double comp_ellint_3(const double _Pk, const double _Pnu)
+struct _Hermite_recurrence
+	: _Recurrence_defaults, _Hermite_step
 	{
-	if (_CSTD isnan(_Pk))
+	double _P0(double) const
 		{
-		return (_Pk);
+		return (1.0);
 		}
 
-	if (_CSTD isnan(_Pnu))
+	double _P1(const double _Px) const
 		{
-		return (_Pnu);
+		return (2 * _Px);
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_3(_Pk, _Pnu); }));
-	}
+	double _D0(double) const
+		{
+		return (0.0);
+		}
 
-float comp_ellint_3f(const float _Pk, const float _Pnu)
-	{
-	if (_CSTD isnan(_Pk))
+	double _D1(double) const
 		{
-		return (_Pk);
+		return (2.0);
 		}
 
-	if (_CSTD isnan(_Pnu))
+	static void _Lanes(const _Lane_table& _Table, const unsigned _Degree, const double * const _Xs,
+		double * const _Pnm1, double * const _Pn)
 		{
-		return (_Pnu);
+		_Table._Hermite(_Degree, _Xs, _Pnm1, _Pn);
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_3(_Pk, _Pnu); }));
-	}
+	static void _Derivative_lanes(const _Lane_table& _Table, const unsigned _Degree,
+		const double * const _Xs, double * const _Pnm1, double * const _Pn, double * const _Dnm1,
+		double * const _Dn)
+		{
+		_Table._Hermite_derivative(_Degree, _Xs, _Pnm1, _Pn, _Dnm1, _Dn);
+		}
+	};
 
-double cyl_bessel_i(const double _Pnu, const double _Px)
+struct _Laguerre_recurrence
+	: _Recurrence_defaults, _Laguerre_step
 	{
-	if (_CSTD isnan(_Pnu))
+	explicit _Laguerre_recurrence(const unsigned _Pm = 0)
+		: _Laguerre_step{_Pm}
 		{
-		return (_Pnu);
 		}
 
-	if (_CSTD isnan(_Px))
+	double _P0(double) const
 		{
-		return (_Px);
+		return (1.0);
 		}
 
-	return (_Boost_call([=]{ return boost::math::cyl_bessel_i(_Pnu, _Px); }));
-}
-
-float cyl_bessel_if(const float _Pnu, const float _Px)
-	{
-	if (_CSTD isnan(_Pnu))
+	double _P1(const double _Px) const
 		{
-		return (_Pnu);
+		return (_Order + 1 - _Px);
 		}
 
-	if (_CSTD isnan(_Px))
+	double _D0(double) const
 		{
-		return (_Px);
+		return (0.0);
 		}
 
-	return (_Boost_call([=]{ return boost::math::cyl_bessel_i(_Pnu, _Px); }));
-	}
+	double _D1(double) const
+		{
+		return (-1.0);
+		}
 
-double cyl_bessel_j(const double _Pnu, const double _Px)
-	{
-	if (_CSTD isnan(_Pnu))
+	void _Lanes(const _Lane_table& _Table, const unsigned _Degree, const double * const _Xs,
+		double * const _Pnm1, double * const _Pn) const
 		{
-		return (_Pnu);
+		_Table._Laguerre(_Order, _Degree, _Xs, _Pnm1, _Pn);
 		}
 
-	if (_CSTD isnan(_Px))
+	void _Derivative_lanes(const _Lane_table& _Table, const unsigned _Degree,
+		const double * const _Xs, double * const _Pnm1, double * const _Pn, double * const _Dnm1,
+		double * const _Dn) const
 		{
-		return (_Px);
+		_Table._Laguerre_derivative(_Order, _Degree, _Xs, _Pnm1, _Pn, _Dnm1, _Dn);
 		}
+	};
 
-	return (_Boost_call([=]{ return boost::math::cyl_bessel_j(_Pnu, _Px); }));
+unsigned _Legendre_degree(const unsigned _Pl)
+	{	// boost::math::legendre_p takes a signed degree and reflects P_{-l-1} = P_l
+	const int _Signed = static_cast<int>(_Pl);
+	return (_Signed < 0 ? static_cast<unsigned>(-(_Signed + 1)) : _Pl);
 	}
 
-float cyl_bessel_jf(const float _Pnu, const float _Px)
-	{
-	if (_CSTD isnan(_Pnu))
+struct _Legendre_recurrence
+	: _Recurrence_defaults, _Legendre_step
+	{	// _Order is 0 but for _Assoc_legendre_recurrence
+	double _P0(double) const
 		{
-		return (_Pnu);
+		return (1.0);
 		}
 
-	if (_CSTD isnan(_Px))
+	double _P1(const double _Px) const
 		{
 		return (_Px);
 		}
 
-	return (_Boost_call([=]{ return boost::math::cyl_bessel_j(_Pnu, _Px); }));
-	}
-
-double cyl_bessel_k(const double _Pnu, const double _Px)
-	{
-	if (_CSTD isnan(_Pnu))
+	double _D0(double) const
 		{
-		return (_Pnu);
+		return (0.0);
 		}
 
-	if (_CSTD isnan(_Px))
+	double _D1(double) const
 		{
-		return (_Px);
+		return (1.0);
 		}
 
-	return (_Boost_call([=]{ return boost::math::cyl_bessel_k(_Pnu, _Px); }));
-	}
+	static bool _In_domain(const double _Px)
+		{
+		return (-1 <= _Px && _Px <= 1);
+		}
 
-float cyl_bessel_kf(const float _Pnu, const float _Px)
-	{
-	if (_CSTD isnan(_Pnu))
+	void _Lanes(const _Lane_table& _Table, const unsigned _Degree, const double * const _Xs,
+		double * const _Pnm1, double * const _Pn) const
 		{
-		return (_Pnu);
+		_Table._Legendre(_Order, _Degree, _Xs, _Pnm1, _Pn);
 		}
 
-	if (_CSTD isnan(_Px))
+	void _Derivative_lanes(const _Lane_table& _Table, const unsigned _Degree,
+		const double * const _Xs, double * const _Pnm1, double * const _Pn, double * const _Dnm1,
+		double * const _Dn) const
 		{
-		return (_Px);
+		_Table._Legendre_derivative(_Order, _Degree, _Xs, _Pnm1, _Pn, _Dnm1, _Dn);
 		}
+	};
 
-	return (_Boost_call([=]{ return boost::math::cyl_bessel_k(_Pnu, _Px); }));
-	}
+struct _Assoc_legendre_recurrence
+	: _Legendre_recurrence
+	{	// (l+1-m)P_{l+1}^m(x) = (2l+1)xP_l^m(x) - (l+m)P_{l-1}^m(x), started from
+		// P_m^m(x) = (-1)^m (2m-1)!! (1-x^2)^{m/2}; index n of the recurrence is l = m + n.
+		// Like boost::math::legendre_p, this includes the Condon-Shortley phase.
+		// Requires 0 < m <= l; callers handle m == 0 and m > l.
+	unsigned _Degree;
+	double _Start;
 
-double cyl_neumann(const double _Pnu, const double _Px)
-	{
-	if (_CSTD isnan(_Pnu))
+	_Assoc_legendre_recurrence(const unsigned _Pl, const unsigned _Pm)
+		: _Legendre_recurrence{{}, {_Pm}}, _Degree(_Pl),
+		_Start((_Pm % 2 != 0 ? -1 : 1) * boost::math::double_factorial<double>(2 * _Pm - 1))
 		{
-		return (_Pnu);
 		}
 
-	if (_CSTD isnan(_Px))
+	double _P0(const double _Px) const
 		{
-		return (_Px);
+		return (_Start * _STD pow(1 - _Px * _Px, _Order / 2.0));
 		}
 
-	return (_Boost_call([=]{ return boost::math::cyl_neumann(_Pnu, _Px); }));
-	}
-
-float cyl_neumannf(const float _Pnu, const float _Px)
-	{
-	if (_CSTD isnan(_Pnu))
+	double _P1(const double _Px) const
 		{
-		return (_Pnu);
+		return (_Px * (2 * _Order + 1) * _P0(_Px));
 		}
 
-	if (_CSTD isnan(_Px))
+	double _D0(const double _Px) const
+		{	// d/dx (1-x^2)^{m/2} = -mx(1-x^2)^{m/2-1}; for m == 1, divide rather than raise
+			// 0 to a negative power, which would report a pole error at x = +/-1
+		const double _Wx = 1 - _Px * _Px;
+		return (-(_Start * _Order * _Px)
+			* (_Order == 1 ? 1 / _STD sqrt(_Wx) : _STD pow(_Wx, _Order / 2.0 - 1)));
+		}
+
+	double _D1(const double _Px) const
 		{
-		return (_Px);
+		return ((2 * _Order + 1) * (_P0(_Px) + _Px * _D0(_Px)));
+		}
+
+	double _Finish_derivative(const double _Px, const double _Dp) const
+		{	// for m == 1 the slope is infinite at x = +/-1, where the recurrence meets inf - inf
+		if (_Order == 1 && (_Px == 1 || _Px == -1))
+			{
+			return (_Px > 0 || _Degree % 2 == 0
+				? numeric_limits<double>::infinity() : -numeric_limits<double>::infinity());
+			}
+
+		return (_Dp);
 		}
+	};
 
-	return (_Boost_call([=]{ return boost::math::cyl_neumann(_Pnu, _Px); }));
+#if defined(_M_IX86) || defined(_M_X64)
+void _Cpuid(int (&_Regs)[4], const int _Leaf) noexcept
+	{
+	__cpuidex(_Regs, _Leaf, 0);
 	}
 
-double ellint_1(const double _Pk, const double _Pphi)
+unsigned long long _Xcr0() noexcept
 	{
-	if (_CSTD isnan(_Pk))
+	return (_xgetbv(0));
+	}
+#elif defined(__i386__) || defined(__x86_64__)
+void _Cpuid(int (&_Regs)[4], const int _Leaf) noexcept
+	{	// GCC and Clang
+	unsigned int _Ax;
+	unsigned int _Bx;
+	unsigned int _Cx;
+	unsigned int _Dx;
+	__cpuid_count(_Leaf, 0, _Ax, _Bx, _Cx, _Dx);
+	_Regs[0] = static_cast<int>(_Ax);
+	_Regs[1] = static_cast<int>(_Bx);
+	_Regs[2] = static_cast<int>(_Cx);
+	_Regs[3] = static_cast<int>(_Dx);
+	}
+
+unsigned long long _Xcr0() noexcept
+	{	// the instruction itself, as _xgetbv would need -mxsave for this whole file
+	unsigned int _Lo;
+	unsigned int _Hi;
+	__asm__ volatile("xgetbv" : "=a"(_Lo), "=d"(_Hi) : "c"(0));
+	return ((static_cast<unsigned long long>(_Hi) << 32) | _Lo);
+	}
+#endif /* defined(_M_IX86) || defined(_M_X64) */
+
+bool _Batch_isa_supported(const batch_isa _Isa) noexcept
+	{	// whether this build has _Isa and this processor, with the state the operating
+		// system saves, runs it
+	if (_Isa == batch_isa::scalar)
 		{
-		return (_Pk);
+		return (true);
 		}
 
-	if (_CSTD isnan(_Pphi))
+#if defined(SMF_BATCH_DISPATCH) \
+	&& (defined(_M_IX86) || defined(_M_X64) || defined(__i386__) || defined(__x86_64__))
+	int _Regs[4];
+	_Cpuid(_Regs, 0);
+	if (_Regs[0] < 7)
 		{
-		return (_Pphi);
+		return (false);
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_1(_Pk, _Pphi); }));
-	}
-
-float ellint_1f(const float _Pk, const float _Pphi)
-	{
-	if (_CSTD isnan(_Pk))
+	_Cpuid(_Regs, 1);
+	constexpr int _Fma_osxsave_avx = (1 << 12) | (1 << 27) | (1 << 28);
+	if ((_Regs[2] & _Fma_osxsave_avx) != _Fma_osxsave_avx)
 		{
-		return (_Pk);
+		return (false);
 		}
 
-	if (_CSTD isnan(_Pphi))
-		{
-		return (_Pphi);
+	const unsigned long long _State = _Xcr0();
+	_Cpuid(_Regs, 7);
+	const unsigned int _Features = static_cast<unsigned int>(_Regs[1]);
+	if (_Isa == batch_isa::avx2)
+		{	// XMM and YMM state; AVX2
+		return ((_State & 0x6) == 0x6 && (_Features & 0x20) != 0);
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_1(_Pk, _Pphi); }));
+	// opmask and ZMM state as well; AVX2 and AVX-512 F, DQ, CD, BW, and VL, all of which
+	// /arch:AVX512 may emit
+	return (_Isa == batch_isa::avx512 && (_State & 0xE6) == 0xE6
+		&& (_Features & 0xD0030020) == 0xD0030020);
+#else /* defined(SMF_BATCH_DISPATCH) && x86 or x64 */
+	return (false);
+#endif /* defined(SMF_BATCH_DISPATCH) && x86 or x64 */
 	}
 
-double ellint_2(const double _Pk, const double _Pphi)
-	{
-	if (_CSTD isnan(_Pk))
+batch_isa _Initial_batch_isa() noexcept
+	{	// the instruction set SMF_BATCH_ISA names, where this processor runs it, otherwise the
+		// widest one it runs
+#pragma warning(push)
+#pragma warning(disable:4996)	// getenv
+	const char * const _Name = _CSTD getenv("SMF_BATCH_ISA");
+#pragma warning(pop)
+	if (_Name)
 		{
-		return (_Pk);
+		constexpr pair<batch_isa, const char *> _Names[] =
+			{
+			{batch_isa::scalar, "scalar"}, {batch_isa::avx2, "avx2"}, {batch_isa::avx512, "avx512"},
+			};
+		for (const auto& _Entry : _Names)
+			{
+			if (_CSTD strcmp(_Name, _Entry.second) == 0 && _Batch_isa_supported(_Entry.first))
+				{
+				return (_Entry.first);
+				}
+			}
 		}
 
-	if (_CSTD isnan(_Pphi))
+	return (_Batch_isa_supported(batch_isa::avx512) ? batch_isa::avx512
+		: _Batch_isa_supported(batch_isa::avx2) ? batch_isa::avx2
+		: batch_isa::scalar);
+	}
+
+atomic<batch_isa>& _Batch_isa_in_use() noexcept
+	{	// chosen at the first use
+	static atomic<batch_isa> _Isa{_Initial_batch_isa()};
+	return (_Isa);
+	}
+
+const _Lane_table& _Lane_table_for(const batch_isa _Isa) noexcept
+	{	// the build of the lane kernels for _Isa
+	switch (_Isa)
 		{
-		return (_Pphi);
+#ifdef SMF_BATCH_DISPATCH
+	case batch_isa::avx2:
+		return (_Avx2::_Isa_lane_table());
+	case batch_isa::avx512:
+		return (_Avx512::_Isa_lane_table());
+#endif /* SMF_BATCH_DISPATCH */
+	default:
+		return (_Local_lane_table);
 		}
+	}
 
-	return (_Boost_call([=]{ return boost::math::ellint_2(_Pk, _Pphi); }));
+const _Lane_table& _Lane_table_in_use() noexcept
+	{	// the build of the lane kernels for the batch functions to call
+	return (_Lane_table_for(_Batch_isa_in_use().load(memory_order_relaxed)));
 	}
 
-float ellint_2f(const float _Pk, const float _Pphi)
-	{
-	if (_CSTD isnan(_Pk))
+template<class _Ty> inline
+	const _Lane_kernels<conditional_t<is_same_v<_Ty, float>, float, double>>& _Lane_kernels_in_use()
+		noexcept
+	{	// the kernels for a _Ty result; long double runs in double lanes
+	return (_Lane_table_in_use());
+	}
+
+template<class _Recurrence,
+	class _Ty> inline
+	_Ty * _Recurrence_batch(const _Recurrence& _Rec, const unsigned _Degree,
+		const _Ty * _First, const _Ty * const _Last, _Ty * _Dest)
+	{	// run _Rec up to _Degree over blocks of _Batch_lanes arguments at once;
+		// like the scalar wrappers, float and long double are evaluated in double
+	const _Lane_table& _Table = _Lane_table_in_use();
+	double _Xs[_Batch_lanes];
+	double _Pnm1[_Batch_lanes];
+	double _Pn[_Batch_lanes];
+	bool _Domain_error = false;
+	while (_First != _Last)
 		{
-		return (_Pk);
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{	// pad the tail of a short block so every pass runs the full lane count
+			_Xs[_Idx] = _Idx < _Count ? static_cast<double>(_First[_Idx]) : 0.0;
+			_Pnm1[_Idx] = _Rec._P0(_Xs[_Idx]);
+			_Pn[_Idx] = _Degree == 0 ? _Pnm1[_Idx] : _Rec._P1(_Xs[_Idx]);
+			}
+
+		_Rec._Lanes(_Table, _Degree, _Xs, _Pnm1, _Pn);
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{	// NaN arguments pass through, like the scalar wrappers
+			if (_CSTD isnan(_First[_Idx]))
+				{
+				_Dest[_Idx] = _First[_Idx];
+				}
+			else if (!_Rec._In_domain(_Xs[_Idx]))
+				{
+				_Domain_error = true;
+				_Dest[_Idx] = numeric_limits<_Ty>::quiet_NaN();
+				}
+			else
+				{
+				_Dest[_Idx] = static_cast<_Ty>(_Pn[_Idx]);
+				}
+			}
+
+		_First += _Count;
+		_Dest += _Count;
 		}
 
-	if (_CSTD isnan(_Pphi))
-		{
-		return (_Pphi);
+	if (_Domain_error)
+		{	// report once per call, as errno_on_error does for each scalar call
+		errno = EDOM;
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_2(_Pk, _Pphi); }));
+	return (_Dest);
 	}
 
-double ellint_3(const double _Pk, const double _Pnu, const double _Pphi)
-	{
-	if (_CSTD isnan(_Pk))
+template<class _Recurrence,
+	class _Ty> inline
+	void _Recurrence_derivative_batch(const _Recurrence& _Rec, const unsigned _Degree,
+		const _Ty * _First, const _Ty * const _Last, _Ty * _Values, _Ty * _Derivatives)
+	{	// as _Recurrence_batch, also carrying the differentiated recurrence
+	const _Lane_table& _Table = _Lane_table_in_use();
+	double _Xs[_Batch_lanes];
+	double _Pnm1[_Batch_lanes];
+	double _Pn[_Batch_lanes];
+	double _Dnm1[_Batch_lanes];
+	double _Dn[_Batch_lanes];
+	bool _Domain_error = false;
+	while (_First != _Last)
 		{
-		return (_Pk);
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			_Xs[_Idx] = _Idx < _Count ? static_cast<double>(_First[_Idx]) : 0.0;
+			_Pnm1[_Idx] = _Rec._P0(_Xs[_Idx]);
+			_Dnm1[_Idx] = _Rec._D0(_Xs[_Idx]);
+			_Pn[_Idx] = _Degree == 0 ? _Pnm1[_Idx] : _Rec._P1(_Xs[_Idx]);
+			_Dn[_Idx] = _Degree == 0 ? _Dnm1[_Idx] : _Rec._D1(_Xs[_Idx]);
+			}
+
+		_Rec._Derivative_lanes(_Table, _Degree, _Xs, _Pnm1, _Pn, _Dnm1, _Dn);
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			if (_CSTD isnan(_First[_Idx]))
+				{
+				_Values[_Idx] = _First[_Idx];
+				_Derivatives[_Idx] = _First[_Idx];
+				}
+			else if (!_Rec._In_domain(_Xs[_Idx]))
+				{
+				_Domain_error = true;
+				_Values[_Idx] = numeric_limits<_Ty>::quiet_NaN();
+				_Derivatives[_Idx] = numeric_limits<_Ty>::quiet_NaN();
+				}
+			else
+				{
+				_Values[_Idx] = static_cast<_Ty>(_Pn[_Idx]);
+				_Derivatives[_Idx] = static_cast<_Ty>(_Rec._Finish_derivative(_Xs[_Idx], _Dn[_Idx]));
+				}
+			}
+
+		_First += _Count;
+		_Values += _Count;
+		_Derivatives += _Count;
 		}
 
-	if (_CSTD isnan(_Pnu))
+	if (_Domain_error)
 		{
-		return (_Pnu);
+		errno = EDOM;
 		}
+	}
 
-	if (_CSTD isnan(_Pphi))
+template<class _Ty,
+	class _Recurrence> inline
+	value_and_derivative<_Ty> _Recurrence_derivative(const _Recurrence& _Rec, const unsigned _Degree,
+		const _Ty _Px)
+	{	// scalar form of _Recurrence_derivative_batch
+	if (_CSTD isnan(_Px))
 		{
-		return (_Pphi);
+		return {_Px, _Px};
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_3(_Pk, _Pnu, _Pphi); }));
-	}
-
-float ellint_3f(const float _Pk, const float _Pnu, const float _Pphi)
-	{
-	if (_CSTD isnan(_Pk))
+	const double _Dx = _Px;
+	if (!_Rec._In_domain(_Dx))
 		{
-		return (_Pk);
+		errno = EDOM;
+		return {numeric_limits<_Ty>::quiet_NaN(), numeric_limits<_Ty>::quiet_NaN()};
 		}
 
-	if (_CSTD isnan(_Pnu))
+	double _Pnm1 = _Rec._P0(_Dx);
+	double _Dnm1 = _Rec._D0(_Dx);
+	if (_Degree == 0)
 		{
-		return (_Pnu);
+		return {static_cast<_Ty>(_Pnm1), static_cast<_Ty>(_Rec._Finish_derivative(_Dx, _Dnm1))};
 		}
 
-	if (_CSTD isnan(_Pphi))
+	double _Pn = _Rec._P1(_Dx);
+	double _Dn = _Rec._D1(_Dx);
+	for (unsigned _Nx = 1; _Nx < _Degree; ++_Nx)
 		{
-		return (_Pphi);
+		const double _Dnext = _Rec._Next_derivative(_Nx, _Dx, _Pn, _Dn, _Dnm1);
+		const double _Pnext = _Rec._Next(_Nx, _Dx, _Pn, _Pnm1);
+		_Dnm1 = _Dn;
+		_Dn = _Dnext;
+		_Pnm1 = _Pn;
+		_Pn = _Pnext;
 		}
 
-	return (_Boost_call([=]{ return boost::math::ellint_3(_Pk, _Pnu, _Pphi); }));
+	return {static_cast<_Ty>(_Pn), static_cast<_Ty>(_Rec._Finish_derivative(_Dx, _Dn))};
 	}
 
-double expint(const double _Px)
-	{
+template<class _Ty,
+	class _Recurrence> inline
+	_Ty * _Recurrence_sequence(const _Recurrence& _Rec, const unsigned _Max_degree, const _Ty _Px,
+		_Ty * _Dest)
+	{	// store P_0(x), ..., P_N(x) from one pass of the recurrence
+	_Ty * const _End = _Dest + (_Max_degree + static_cast<size_t>(1));
 	if (_CSTD isnan(_Px))
 		{
-		return (_Px);
+		_STD fill(_Dest, _End, _Px);
+		return (_End);
 		}
 
-	return (_Boost_call([=]{ return boost::math::expint(_Px); }));
-	}
-
-float expintf(const float _Px)
-	{
-	if (_CSTD isnan(_Px))
+	const double _Dx = _Px;
+	if (!_Rec._In_domain(_Dx))
 		{
-		return (_Px);
+		errno = EDOM;
+		_STD fill(_Dest, _End, numeric_limits<_Ty>::quiet_NaN());
+		return (_End);
 		}
 
-	return (_Boost_call([=]{ return boost::math::expint(_Px); }));
-	}
+	double _Pnm1 = _Rec._P0(_Dx);
+	*_Dest++ = static_cast<_Ty>(_Pnm1);
+	if (_Max_degree == 0)
+		{
+		return (_End);
+		}
 
-double hermite(const unsigned _Pn, const double _Px)
-	{
-	if (_CSTD isnan(_Px))
+	double _Pn = _Rec._P1(_Dx);
+	*_Dest++ = static_cast<_Ty>(_Pn);
+	for (unsigned _Nx = 1; _Nx < _Max_degree; ++_Nx)
 		{
-		return (_Px);
+		const double _Pnext = _Rec._Next(_Nx, _Dx, _Pn, _Pnm1);
+		_Pnm1 = _Pn;
+		_Pn = _Pnext;
+		*_Dest++ = static_cast<_Ty>(_Pn);
 		}
 
-	return (_Boost_call([=]{ return boost::math::hermite(_Pn, _Px); }));
+	return (_End);
 	}
 
-float hermitef(const unsigned _Pn, const float _Px)
-	{
-	if (_CSTD isnan(_Px))
+template<class _Ty> inline
+	_Ty * _Assoc_laguerre_table(const unsigned _Max_degree, const unsigned _Max_order, const _Ty _Px,
+		_Ty * _Dest)
+	{	// one recurrence in n per order; the relation L_n^{m+1} = sum_{k<=n} L_k^m would be
+		// cheaper, but cancels badly once L_k^m oscillates
+	for (unsigned _Mx = 0; ; ++_Mx)
 		{
-		return (_Px);
+		_Dest = _Recurrence_sequence(_Laguerre_recurrence{_Mx}, _Max_degree, _Px, _Dest);
+		if (_Mx == _Max_order)
+			{
+			return (_Dest);
+			}
 		}
+	}
 
-	return (_Boost_call([=]{ return boost::math::hermite(_Pn, _Px); }));
+double _Assoc_legendre_reflection(const unsigned _Degree, const unsigned _Order)
+	{	// the scalar wrappers hand the order to boost::math::legendre_p as an int, so an
+		// order above INT_MAX is negative: P_l^{-m}(x) = (-1)^m (l-m)!/(l+m)! P_l^m(x)
+	return ((_Order % 2 != 0 ? -1 : 1)
+		* boost::math::tgamma_delta_ratio(_Degree - _Order + 1.0, 2.0 * _Order));
 	}
 
-double laguerre(const unsigned _Pn, const double _Px)
+template<class _Ty> inline
+	value_and_derivative<_Ty> _Assoc_legendre_derivative(const unsigned _Pl, const unsigned _Pm,
+		const _Ty _Px)
 	{
-	if (_CSTD isnan(_Px))
+	const unsigned _Degree = _Legendre_degree(_Pl);
+	if (static_cast<int>(_Pm) < 0 && 0U - _Pm <= _Degree)
+		{	// otherwise P_l^{-m} vanishes along with P_l^m, below
+		const unsigned _Order = 0U - _Pm;
+		const double _Scale = _Assoc_legendre_reflection(_Degree, _Order);
+		const auto _Result = _Assoc_legendre_derivative(_Pl, _Order, _Px);
+		return {static_cast<_Ty>(_Scale * _Result.value), static_cast<_Ty>(_Scale * _Result.derivative)};
+		}
+
+	if (_Pm == 0)
 		{
-		return (_Px);
+		return (_Recurrence_derivative(_Legendre_recurrence{}, _Degree, _Px));
 		}
 
-	return (_Boost_call([=]{ return boost::math::laguerre(_Pn, _Px); }));
-	}
+	if (_Pm > _Degree)
+		{	// P_l^m vanishes identically; run the degree-0 recurrence for NaN and domain handling
+		auto _Result = _Recurrence_derivative(_Legendre_recurrence{}, 0, _Px);
+		if (!_CSTD isnan(_Result.value))
+			{
+			_Result = {_Ty{0}, _Ty{0}};
+			}
 
-float laguerref(const unsigned _Pn, const float _Px)
-	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
+		return (_Result);
 		}
 
-	return (_Boost_call([=]{ return boost::math::laguerre(_Pn, _Px); }));
+	return (_Recurrence_derivative(_Assoc_legendre_recurrence{_Degree, _Pm}, _Degree - _Pm, _Px));
 	}
 
-double legendre(const unsigned _Pl, const double _Px)
+template<class _Ty> inline
+	void _Assoc_legendre_derivative_batch(const unsigned _Pl, const unsigned _Pm,
+		const _Ty * const _First, const _Ty * const _Last, _Ty * const _Values, _Ty * const _Derivatives)
 	{
-	if (_CSTD isnan(_Px))
+	const unsigned _Degree = _Legendre_degree(_Pl);
+	if (static_cast<int>(_Pm) < 0 && 0U - _Pm <= _Degree)
+		{	// otherwise P_l^{-m} vanishes along with P_l^m, below
+		const unsigned _Order = 0U - _Pm;
+		const double _Scale = _Assoc_legendre_reflection(_Degree, _Order);
+		_Assoc_legendre_derivative_batch(_Pl, _Order, _First, _Last, _Values, _Derivatives);
+		const auto _Count = _Last - _First;
+		for (ptrdiff_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			_Values[_Idx] = static_cast<_Ty>(_Scale * _Values[_Idx]);
+			_Derivatives[_Idx] = static_cast<_Ty>(_Scale * _Derivatives[_Idx]);
+			}
+		}
+	else if (_Pm == 0)
 		{
-		return (_Px);
+		_Recurrence_derivative_batch(_Legendre_recurrence{}, _Degree, _First, _Last, _Values, _Derivatives);
+		}
+	else if (_Pm > _Degree)
+		{	// P_l^m vanishes identically; run the degree-0 recurrence for NaN and domain handling
+		_Recurrence_derivative_batch(_Legendre_recurrence{}, 0, _First, _Last, _Values, _Derivatives);
+		const auto _Count = _Last - _First;
+		for (ptrdiff_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			if (!_CSTD isnan(_Values[_Idx]))
+				{
+				_Values[_Idx] = 0;
+				_Derivatives[_Idx] = 0;
+				}
+			}
+		}
+	else
+		{
+		_Recurrence_derivative_batch(_Assoc_legendre_recurrence{_Degree, _Pm}, _Degree - _Pm,
+			_First, _Last, _Values, _Derivatives);
 		}
-
-	return (_Boost_call([=]{ return boost::math::legendre_p(_Pl, _Px); }));
 	}
+} // unnamed namespace
 
-float legendref(const unsigned _Pl, const float _Px)
+double assoc_laguerre(const unsigned _Pn, const unsigned _Pm, const double _Px)
 	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
-		}
+	return (_Boost_call([](auto... _Args) { return boost::math::laguerre(_Args...); },
+		_Pn, _Pm, _Px));
+	}
 
-	return (_Boost_call([=]{ return boost::math::legendre_p(_Pl, _Px); }));
+float assoc_laguerref(const unsigned _Pn, const unsigned _Pm, const float _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::laguerre(_Args...); },
+		_Pn, _Pm, _Px));
 	}
 
-double riemann_zeta(const double _Px)
+value_and_derivative<double> assoc_laguerre_and_derivative(const unsigned _Pn, const unsigned _Pm,
+	const double _Px)
 	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
-		}
+	return (_Recurrence_derivative(_Laguerre_recurrence{_Pm}, _Pn, _Px));
+	}
 
-	return (_Boost_call([=]{ return boost::math::zeta(_Px); }));
+value_and_derivative<float> assoc_laguerre_and_derivative(const unsigned _Pn, const unsigned _Pm,
+	const float _Px)
+	{
+	return (_Recurrence_derivative(_Laguerre_recurrence{_Pm}, _Pn, _Px));
 	}
 
-float riemann_zetaf(const float _Px)
+void assoc_laguerre_and_derivative_batch(const unsigned _Pn, const unsigned _Pm, const double * const _First,
+	const double * const _Last, double * const _Values, double * const _Derivatives)
 	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
-		}
+	_Recurrence_derivative_batch(_Laguerre_recurrence{_Pm}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
 
-	return (_Boost_call([=]{ return boost::math::zeta(_Px); }));
+void assoc_laguerre_and_derivative_batch(const unsigned _Pn, const unsigned _Pm, const float * const _First,
+	const float * const _Last, float * const _Values, float * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Laguerre_recurrence{_Pm}, _Pn, _First, _Last, _Values, _Derivatives);
 	}
 
-double sph_bessel(const unsigned _Pn, const double _Px)
+void assoc_laguerre_and_derivative_batch(const unsigned _Pn, const unsigned _Pm,
+	const long double * const _First, const long double * const _Last, long double * const _Values,
+	long double * const _Derivatives)
 	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
-		}
+	_Recurrence_derivative_batch(_Laguerre_recurrence{_Pm}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
 
-	return (_Boost_call([=]{ return boost::math::sph_bessel(_Pn, _Px); }));
+double * assoc_laguerre_sequence(const unsigned _Pn, const unsigned _Pm, const double _Px, double * const _Dest)
+	{
+	return (_Recurrence_sequence(_Laguerre_recurrence{_Pm}, _Pn, _Px, _Dest));
 	}
 
-float sph_besself(const unsigned _Pn, const float _Px)
+float * assoc_laguerre_sequence(const unsigned _Pn, const unsigned _Pm, const float _Px, float * const _Dest)
 	{
-	if (_CSTD isnan(_Px))
-		{
-		return (_Px);
-		}
+	return (_Recurrence_sequence(_Laguerre_recurrence{_Pm}, _Pn, _Px, _Dest));
+	}
 
-	return (_Boost_call([=]{ return boost::math::sph_bessel(_Pn, _Px); }));
+long double * assoc_laguerre_sequence(const unsigned _Pn, const unsigned _Pm, const long double _Px,
+	long double * const _Dest)
+	{
+	return (_Recurrence_sequence(_Laguerre_recurrence{_Pm}, _Pn, _Px, _Dest));
 	}
 
-double sph_legendre(const unsigned _Pl, const unsigned _Pm, const double _Ptheta)
+double * assoc_laguerre_table(const unsigned _Pn, const unsigned _Pm, const double _Px, double * const _Dest)
 	{
-	if (_CSTD isnan(_Ptheta))
-		{
-		return (_Ptheta);
-		}
+	return (_Assoc_laguerre_table(_Pn, _Pm, _Px, _Dest));
+	}
 
-	return (_Boost_call([=]{ return boost::math::spherical_harmonic_r(_Pl, _Pm, _Ptheta, 0.0); }));
+float * assoc_laguerre_table(const unsigned _Pn, const unsigned _Pm, const float _Px, float * const _Dest)
+	{
+	return (_Assoc_laguerre_table(_Pn, _Pm, _Px, _Dest));
 	}
 
-float sph_legendref(const unsigned _Pl, const unsigned _Pm, const float _Ptheta)
+long double * assoc_laguerre_table(const unsigned _Pn, const unsigned _Pm, const long double _Px,
+	long double * const _Dest)
 	{
-	if (_CSTD isnan(_Ptheta))
+	return (_Assoc_laguerre_table(_Pn, _Pm, _Px, _Dest));
+	}
+
+namespace {
+	// With its normalization, R_p^m is the orthonormal Laguerre recurrence in p, in u = 2r^2/w^2:
+	// R_{p+1} = ((2p + m + 1 - u)R_p - sqrt(p(p + m))R_{p-1}) / sqrt((p + 1)(p + m + 1)),
+	// so one pass yields every p. R_0 is carried as a mantissa and a power of two, since
+	// e^{-u/2} underflows long before the profiles of high p do.
+constexpr double _Laguerre_gauss_rescale = 0x1p256;
+
+void _Laguerre_gauss_profiles(const unsigned _Max_radial, const unsigned _Order, const double _Waist,
+	const double * const _Radii, const size_t _Count, const bool _Squared, double * const _Dest,
+	const size_t _Stride)
+	{	// R_p^m at _Radii (or their squares), stored at _Dest[p * _Stride + k]
+	constexpr double _Ln2_hi = 0x1.62e42fefa39efp-1;
+	constexpr double _Ln2_lo = 0x1.abc9e3b39803fp-56;
+	const double _Per_square = 2 / _Waist / _Waist;
+	const double _Log_norm = 0.5 * _CSTD log(2 / boost::math::double_constants::pi) - _CSTD log(_Waist)
+		- 0.5 * boost::math::lgamma(_Order + 1.0);
+	vector<double> _Diagonal(_Max_radial);
+	vector<double> _Offdiagonal(_Max_radial);
+	vector<double> _Inverse(_Max_radial);
+	for (unsigned _Px = 0; _Px < _Max_radial; ++_Px)
 		{
-		return (_Ptheta);
+		_Diagonal[_Px] = 2.0 * _Px + _Order + 1;
+		_Offdiagonal[_Px] = _CSTD sqrt(static_cast<double>(_Px) * (_Px + static_cast<double>(_Order)));
+		_Inverse[_Px] = 1 / _CSTD sqrt((_Px + 1.0) * (_Px + 1.0 + _Order));
 		}
 
-	return (_Boost_call([=]{ return boost::math::spherical_harmonic_r(_Pl, _Pm, _Ptheta, 0.0f); }));
+	double _Us[_Batch_lanes];
+	double _Prev[_Batch_lanes];
+	double _Cur[_Batch_lanes];
+	double _Scale[_Batch_lanes];
+	long long _Exponent[_Batch_lanes];
+	bool _Domain_error = false;
+	const auto _Power_of_two = [](const double _Mantissa, const long long _Power)
+		{	// powers below the range of int underflow all the same
+		constexpr long long _Floor = numeric_limits<int>::min();
+		return (_CSTD ldexp(_Mantissa, static_cast<int>(_STD max(_Power, _Floor))));
+		};
+	for (size_t _First = 0; _First < _Count; _First += _Batch_lanes)
+		{
+		const size_t _Lanes = _STD min(_Count - _First, _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			double _Rv = _Idx < _Lanes ? _Radii[_First + _Idx] : 0.0;
+			if (_Rv < 0)
+				{
+				_Domain_error = true;
+				_Rv = numeric_limits<double>::quiet_NaN();
+				}
+
+			const double _Uv = (_Squared ? _Rv : _Rv * _Rv) * _Per_square;
+			double _Mantissa = 0;
+			long long _Power = 0;
+			if (_CSTD isnan(_Uv))
+				{
+				_Mantissa = _Uv;
+				}
+			else if (_Uv == 0)
+				{	// (sqrt(2) r / w)^m is 1 for m = 0
+				_Mantissa = _Order == 0 ? _CSTD exp(_Log_norm) : 0.0;
+				}
+			else if (_Uv < 0x1p60)
+				{	// beyond, past the turning point u = 4p + 2m + 2 of every unsigned p
+				const double _Log = _Log_norm + 0.5 * _Order * _CSTD log(_Uv) - _Uv / 2;
+				if (_Log > -700)
+					{
+					_Mantissa = _CSTD exp(_Log);
+					}
+				else
+					{
+					const double _Kx = _CSTD floor(_Log * boost::math::double_constants::log2_e);
+					_Mantissa = _CSTD exp(_CSTD fma(-_Kx, _Ln2_lo, _CSTD fma(-_Kx, _Ln2_hi, _Log)));
+					_Power = static_cast<long long>(_Kx);
+					}
+				}
+
+			_Us[_Idx] = _CSTD isnan(_Uv) || _Uv < 0x1p60 ? _Uv : 0.0;
+			_Prev[_Idx] = 0;
+			_Cur[_Idx] = _Mantissa;
+			_Exponent[_Idx] = _Power;
+			_Scale[_Idx] = _Power_of_two(1.0, _Power);
+			}
+
+		for (unsigned _Px = 0; ; ++_Px)
+			{
+			double * const _Out = _Dest + _Px * _Stride + _First;
+			for (size_t _Idx = 0; _Idx < _Lanes; ++_Idx)
+				{
+				if (_CSTD fabs(_Cur[_Idx]) > _Laguerre_gauss_rescale)
+					{
+					_Prev[_Idx] /= _Laguerre_gauss_rescale;
+					_Cur[_Idx] /= _Laguerre_gauss_rescale;
+					_Exponent[_Idx] += 256;
+					_Scale[_Idx] = _Power_of_two(1.0, _Exponent[_Idx]);
+					}
+
+				// scaling by a normal power of two rounds once, like ldexp
+				_Out[_Idx] = _Exponent[_Idx] >= numeric_limits<double>::min_exponent - 1
+					? _Cur[_Idx] * _Scale[_Idx] : _Power_of_two(_Cur[_Idx], _Exponent[_Idx]);
+				}
+
+			if (_Px == _Max_radial)
+				{
+				break;
+				}
+
+			const double _Dp = _Diagonal[_Px];
+			const double _Op = _Offdiagonal[_Px];
+			const double _Ip = _Inverse[_Px];
+			for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+				{
+				const double _Next = ((_Dp - _Us[_Idx]) * _Cur[_Idx] - _Op * _Prev[_Idx]) * _Ip;
+				_Prev[_Idx] = _Cur[_Idx];
+				_Cur[_Idx] = _Next;
+				}
+			}
+		}
+
+	if (_Domain_error)
+		{
+		errno = EDOM;
+		}
+	}
+
+pair<vector<double>, vector<size_t>> _Distinct_magnitudes(const double * const _First,
+	const double * const _Last)
+	{	// the distinct |x|, ascending with any NaN last, and the index of each x among them
+	vector<double> _Magnitudes;
+	bool _Has_nan = false;
+	for (const double * _Ptr = _First; _Ptr != _Last; ++_Ptr)
+		{
+		if (_CSTD isnan(*_Ptr))
+			{
+			_Has_nan = true;
+			}
+		else
+			{
+			_Magnitudes.push_back(_CSTD fabs(*_Ptr));
+			}
+		}
+
+	_STD sort(_Magnitudes.begin(), _Magnitudes.end());
+	_Magnitudes.erase(_STD unique(_Magnitudes.begin(), _Magnitudes.end()), _Magnitudes.end());
+	if (_Has_nan)
+		{
+		_Magnitudes.push_back(numeric_limits<double>::quiet_NaN());
+		}
+
+	vector<size_t> _Indices;
+	for (const double * _Ptr = _First; _Ptr != _Last; ++_Ptr)
+		{
+		_Indices.push_back(_CSTD isnan(*_Ptr) ? _Magnitudes.size() - 1
+			: static_cast<size_t>(_STD lower_bound(_Magnitudes.begin(), _Magnitudes.end() - _Has_nan,
+				_CSTD fabs(*_Ptr)) - _Magnitudes.begin()));
+		}
+
+	return {_STD move(_Magnitudes), _STD move(_Indices)};
+	}
+
+complex<double> _Vortex_phase(const double _Px, const double _Py, const unsigned _Order, const bool _Negative)
+	{	// e^{i l phi} = ((x + iy) / r)^l by repeated squaring; 1 where phi is undefined
+	const double _Rv = _CSTD hypot(_Px, _Py);
+	if (!(0 < _Rv && _Rv < numeric_limits<double>::infinity()))
+		{
+		return (1.0);
+		}
+
+	double _Zr = _Px / _Rv;
+	double _Zi = _Py / _Rv;
+	double _Re = 1;
+	double _Im = 0;
+	for (unsigned _Ex = _Order; _Ex != 0; _Ex >>= 1)
+		{
+		if (_Ex & 1)
+			{
+			const double _Tr = _Re * _Zr - _Im * _Zi;
+			_Im = _Re * _Zi + _Im * _Zr;
+			_Re = _Tr;
+			}
+
+		const double _Sr = _Zr * _Zr - _Zi * _Zi;
+		_Zi = 2 * _Zr * _Zi;
+		_Zr = _Sr;
+		}
+
+	return (complex<double>(_Re, _Negative ? -_Im : _Im));
+	}
+} // unnamed namespace
+
+double * laguerre_gauss_radial(const unsigned _Max_radial, const unsigned _Order, const double _Waist,
+	const double * const _First, const double * const _Last, double * const _Dest)
+	{
+	const size_t _Count = static_cast<size_t>(_Last - _First);
+	double * const _End = _Dest + (_Max_radial + static_cast<size_t>(1)) * _Count;
+	if (!(_Waist > 0))
+		{
+		errno = EDOM;
+		_STD fill(_Dest, _End, numeric_limits<double>::quiet_NaN());
+		return (_End);
+		}
+
+	_Laguerre_gauss_profiles(_Max_radial, _Order, _Waist, _First, _Count, false, _Dest, _Count);
+	return (_End);
+	}
+
+void laguerre_gauss_modes(const unsigned _Max_radial, const int _Charge, const double _Waist,
+	const double * const _X_first, const double * const _X_last, const double * const _Y_first,
+	const double * const _Y_last, complex<double> * const _Dest)
+	{	// the profiles depend only on |x| and |y|, and not on their order: compute them once
+		// for each unordered pair of distinct magnitudes on the grid, so that swapped
+		// (|x|, |y|) pixels, as across the diagonals of a square grid, share them too
+	const size_t _Columns = static_cast<size_t>(_X_last - _X_first);
+	const size_t _Rows = static_cast<size_t>(_Y_last - _Y_first);
+	const size_t _Plane = _Columns * _Rows;
+	if (!(_Waist > 0))
+		{
+		errno = EDOM;
+		_STD fill(_Dest, _Dest + (_Max_radial + static_cast<size_t>(1)) * _Plane,
+			complex<double>(numeric_limits<double>::quiet_NaN(), numeric_limits<double>::quiet_NaN()));
+		return;
+		}
+
+	const unsigned _Order = _Charge < 0 ? 0U - static_cast<unsigned>(_Charge) : static_cast<unsigned>(_Charge);
+	const auto _Xs = _Distinct_magnitudes(_X_first, _X_last);
+	const auto _Ys = _Distinct_magnitudes(_Y_first, _Y_last);
+	constexpr size_t _None = numeric_limits<size_t>::max();
+	const auto _Find = [_None](const vector<double>& _Magnitudes, const double _Value)
+		{	// the index of _Value among _Magnitudes, or _None
+		const auto _Where = _STD lower_bound(_Magnitudes.begin(), _Magnitudes.end(), _Value);
+		return (_CSTD isnan(_Value) || _Where == _Magnitudes.end() || *_Where != _Value
+			? _None : static_cast<size_t>(_Where - _Magnitudes.begin()));
+		};
+
+	const size_t _Xn = _Xs.first.size();
+	vector<size_t> _Y_of_x(_Xn);
+	for (size_t _Ax = 0; _Ax < _Xn; ++_Ax)
+		{
+		_Y_of_x[_Ax] = _Find(_Ys.first, _Xs.first[_Ax]);
+		}
+
+	vector<size_t> _Radius_of_pair(_Xn * _Ys.first.size(), _None);
+	vector<double> _Squares;
+	for (size_t _Ay = 0; _Ay < _Ys.first.size(); ++_Ay)
+		{
+		const size_t _X_of_y = _Find(_Xs.first, _Ys.first[_Ay]);
+		for (size_t _Ax = 0; _Ax < _Xn; ++_Ax)
+			{	// the swapped pair, where it is on the grid and already numbered, or a new radius
+			size_t& _Radius = _Radius_of_pair[_Ay * _Xn + _Ax];
+			if (_X_of_y != _None && _Y_of_x[_Ax] != _None)
+				{
+				_Radius = _Radius_of_pair[_Y_of_x[_Ax] * _Xn + _X_of_y];
+				}
+
+			if (_Radius == _None)
+				{
+				_Radius = _Squares.size();
+				_Squares.push_back(_Xs.first[_Ax] * _Xs.first[_Ax] + _Ys.first[_Ay] * _Ys.first[_Ay]);
+				}
+			}
+		}
+
+	const size_t _Distinct = _Squares.size();
+	const size_t _Modes = _Max_radial + static_cast<size_t>(1);
+	vector<double> _Profiles(_Modes * _Distinct);
+	_Laguerre_gauss_profiles(_Max_radial, _Order, _Waist, _Squares.data(), _Distinct, true,
+		_Profiles.data(), _Distinct);
+
+	vector<size_t> _Row_order(_Rows);
+	_STD iota(_Row_order.begin(), _Row_order.end(), static_cast<size_t>(0));
+	_STD stable_sort(_Row_order.begin(), _Row_order.end(),
+		[&](const size_t _Left, const size_t _Right) { return (_Ys.second[_Left] < _Ys.second[_Right]); });
+
+	vector<double> _Row_profiles(_Modes * _Xn);
+	vector<complex<double>> _Phases(_Columns);
+	size_t _Current = _None;
+	for (const size_t _Row : _Row_order)
+		{
+		if (_Ys.second[_Row] != _Current)
+			{	// gathered once for all the rows with this |y|, over the distinct |x|
+			_Current = _Ys.second[_Row];
+			const size_t * const _Pairs = _Radius_of_pair.data() + _Current * _Xn;
+			for (size_t _Px = 0; _Px < _Modes; ++_Px)
+				{
+				for (size_t _Ax = 0; _Ax < _Xn; ++_Ax)
+					{
+					_Row_profiles[_Px * _Xn + _Ax] = _Profiles[_Px * _Distinct + _Pairs[_Ax]];
+					}
+				}
+			}
+
+		for (size_t _Col = 0; _Col < _Columns; ++_Col)
+			{
+			_Phases[_Col] = _Order == 0 ? 1.0 : _Vortex_phase(_X_first[_Col], _Y_first[_Row], _Order, _Charge < 0);
+			}
+
+		for (size_t _Px = 0; _Px < _Modes; ++_Px)
+			{
+			const double * const _Profile = _Row_profiles.data() + _Px * _Xn;
+			complex<double> * const _Out = _Dest + _Px * _Plane + _Row * _Columns;
+			for (size_t _Col = 0; _Col < _Columns; ++_Col)
+				{
+				const double _Rv = _Profile[_Xs.second[_Col]];
+				_Out[_Col] = complex<double>(_Rv * _Phases[_Col].real(), _Rv * _Phases[_Col].imag());
+				}
+			}
+		}
+	}
+
+double assoc_legendre(const unsigned _Pl, const unsigned _Pm, const double _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::legendre_p(_Args...); },
+		_Pl, _Pm, _Px));
+	}
+
+float assoc_legendref(const unsigned _Pl, const unsigned _Pm, const float _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::legendre_p(_Args...); },
+		_Pl, _Pm, _Px));
+	}
+
+value_and_derivative<double> assoc_legendre_and_derivative(const unsigned _Pl, const unsigned _Pm,
+	const double _Px)
+	{
+	return (_Assoc_legendre_derivative(_Pl, _Pm, _Px));
+	}
+
+value_and_derivative<float> assoc_legendre_and_derivative(const unsigned _Pl, const unsigned _Pm,
+	const float _Px)
+	{
+	return (_Assoc_legendre_derivative(_Pl, _Pm, _Px));
+	}
+
+void assoc_legendre_and_derivative_batch(const unsigned _Pl, const unsigned _Pm, const double * const _First,
+	const double * const _Last, double * const _Values, double * const _Derivatives)
+	{
+	_Assoc_legendre_derivative_batch(_Pl, _Pm, _First, _Last, _Values, _Derivatives);
+	}
+
+void assoc_legendre_and_derivative_batch(const unsigned _Pl, const unsigned _Pm, const float * const _First,
+	const float * const _Last, float * const _Values, float * const _Derivatives)
+	{
+	_Assoc_legendre_derivative_batch(_Pl, _Pm, _First, _Last, _Values, _Derivatives);
+	}
+
+void assoc_legendre_and_derivative_batch(const unsigned _Pl, const unsigned _Pm,
+	const long double * const _First, const long double * const _Last, long double * const _Values,
+	long double * const _Derivatives)
+	{
+	_Assoc_legendre_derivative_batch(_Pl, _Pm, _First, _Last, _Values, _Derivatives);
+	}
+
+double beta(const double _Px, const double _Py)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::beta(_Args...); },
+		_Px, _Py));
+	}
+
+float betaf(const float _Px, const float _Py)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::beta(_Args...); },
+		_Px, _Py));
+	}
+
+namespace {
+constexpr double _Gamma_halves[] =
+	{	// Gamma(k / 2), k = 1, ..., 343; Gamma(172) overflows
+	1.7724538509055160272982e+00, 1.0000000000000000000000e+00, 8.8622692545275801364908e-01,
+	1.0000000000000000000000e+00, 1.3293403881791370204736e+00, 2.0000000000000000000000e+00,
+	3.3233509704478425511841e+00, 6.0000000000000000000000e+00, 1.1631728396567448929144e+01,
+	2.4000000000000000000000e+01, 5.2342777784553520181149e+01, 1.2000000000000000000000e+02,
+	2.8788527781504436099632e+02, 7.2000000000000000000000e+02, 1.8712543057977883464761e+03,
+	5.0400000000000000000000e+03, 1.4034407293483412598571e+04, 4.0320000000000000000000e+04,
+	1.1929246199460900708785e+05, 3.6288000000000000000000e+05, 1.1332783889487855673346e+06,
+	3.6288000000000000000000e+06, 1.1899423083962248457013e+07, 3.9916800000000000000000e+07,
+	1.3684336546556585725565e+08, 4.7900160000000000000000e+08, 1.7105420683195732156956e+09,
+	6.2270208000000000000000e+09, 2.3092317922314238411891e+10, 8.7178291200000000000000e+10,
+	3.3483860987355645697242e+11, 1.3076743680000000000000e+12, 5.1899984530401250830725e+12,
+	2.0922789888000000000000e+13, 8.5634974475162063870696e+13, 3.5568742809600000000000e+14,
+	1.4986120533153361177372e+15, 6.4023737057280000000000e+15, 2.7724322986333718178138e+16,
+	1.2164510040883200000000e+17, 5.4062429823350750447369e+17, 2.4329020081766400000000e+18,
+	1.1082798113786903841711e+19, 5.1090942171709440000000e+19, 2.3828015944641843259678e+20,
+	1.1240007277776076800000e+21, 5.3613035875444147334275e+21, 2.5852016738884976640000e+22,
+	1.2599063430729374623555e+23, 6.2044840173323943936000e+23, 3.0867705405286967827709e+24,
+	1.5511210043330985984000e+25, 7.8712648783481767960657e+25, 4.0329146112660563558400e+26,
+	2.0858851927622668509574e+27, 1.0888869450418352160768e+28, 5.7361842800962338401329e+28,
+	3.0488834461171386050150e+29, 1.6348125198274266444379e+30, 8.8417619937397019545436e+30,
+	4.8226969334909086010917e+31, 2.6525285981219105863631e+32, 1.4709225647147271233330e+33,
+	8.2228386541779228177256e+33, 4.6334060788513904384989e+34, 2.6313083693369353016722e+35,
+	1.5058569756267018925121e+36, 8.6833176188118864955182e+36, 5.0446208683494513399157e+37,
+	2.9523279903960414084762e+38, 1.7403941995805607122709e+39, 1.0333147966386144929667e+40,
+	6.1783994085109905285617e+40, 3.7199332678990121746800e+41, 2.2551157841065115429250e+42,
+	1.3763753091226345046316e+43, 8.4566841903994182859689e+43, 5.2302261746660111176001e+44,
+	3.2558234133037760400980e+45, 2.0397882081197443358640e+46, 1.2860502482549915358387e+47,
+	8.1591528324789773434561e+47, 5.2085035054327157201468e+48, 3.3452526613163807108170e+49,
+	2.1615289547545770238609e+50, 1.4050061177528798985431e+51, 9.1864980577069523514089e+51,
+	6.0415263063373835637355e+52, 3.9961266551025242728629e+53, 2.6582715747884487680436e+54,
+	1.7782763615206233014240e+55, 1.1962222086548019456196e+56, 8.0911574449188360214791e+56,
+	5.5026221598120889498503e+57, 3.7623882118872587499878e+58, 2.5862324151116818064296e+59,
+	1.7871344006464479062442e+60, 1.2413915592536072670862e+61, 8.6676018431352723452844e+61,
+	6.0828186403426756087225e+62, 4.2904629123519598109158e+63, 3.0414093201713378043613e+64,
+	2.1666837707377397045125e+65, 1.5511187532873822802242e+66, 1.1158421419299359478239e+67,
+	8.0658175170943878571661e+67, 5.8581712451321637260756e+68, 4.2748832840600255642980e+69,
+	3.1341216161457075934504e+70, 2.3084369733924138047209e+71, 1.7080962807994106384305e+72,
+	1.2696403353658275925965e+73, 9.4799343584367290432892e+73, 7.1099858780486345185405e+74,
+	5.3561629125167519094584e+75, 4.0526919504877216755681e+76, 3.0797936746971323479386e+77,
+	2.3505613312828785718295e+78, 1.8016792996978224235441e+79, 1.3868311854568983573794e+80,
+	1.0719991833202043420087e+81, 8.3209871127413901442763e+81, 6.4855950590872362691527e+82,
+	5.0758021387722479880086e+83, 3.9886409613386503055289e+84, 3.1469973260387937525653e+85,
+	2.4929006008366564409556e+86, 1.9826083154044400641161e+87, 1.5829918815312768400068e+88,
+	1.2688693218588416410343e+89, 1.0210297635876735618044e+90, 8.2476505920824706667232e+90,
+	6.6877449514992618298187e+91, 5.4434493907744306400373e+92, 4.4473503927470091168294e+93,
+	3.6471110918188685288250e+94, 3.0019615151042311538599e+95, 2.4800355424368305996010e+96,
+	2.0563436378463983403940e+97, 1.7112245242814131137247e+98, 1.4291588283032468465738e+99,
+	1.1978571669969891796073e+100, 1.0075569739537890268346e+101, 8.5047858856786231752117e+101,
+	7.2040323637695915418671e+102, 6.1234458376886086861524e+103, 5.2229234637329538678536e+104,
+	4.4701154615126843408913e+105, 3.8388487458437210928724e+106, 3.3078854415193864122595e+107,
+	2.8599423156535722141900e+108, 2.4809140811395398091946e+109, 2.1592564483184470217134e+110,
+	1.8854947016660502549879e+111, 1.6518311829636119716108e+112, 1.4518309202828586963407e+113,
+	1.2801691667967992779983e+114, 1.1324281178206297831458e+115, 1.0049327959354874332287e+116,
+	8.9461821307829752868514e+116, 7.9892157276871250941681e+117, 7.1569457046263802294812e+118,
+	6.4313186607881357008054e+119, 5.7971260207473679858797e+120, 5.2415247085423305961564e+121,
+	4.7536433370128417484214e+122, 4.3242578845474227418290e+123, 3.9455239697206586511897e+124,
+	3.6107553335970979894272e+125, 3.3142401345653532669994e+126, 3.0510882568895478010660e+127,
+	2.8171041143805502769495e+128, 2.6086804596405633699114e+129, 2.4227095383672732381766e+130,
+	2.2565085975890873149734e+131, 2.1077572983795277172136e+132, 1.9744450228904514006017e+133,
+	1.8548264225739843911480e+134, 1.7473838452580494895325e+135, 1.6507955160908461081217e+136,
+	1.5639085415059542931316e+137, 1.4857159644817614973095e+138, 1.4153372300628886352841e+139,
+	1.3520015276784029625517e+140, 1.2950335655075431012850e+141, 1.2438414054641307255475e+142,
+	1.1979060480944773686886e+143, 1.1567725070816415747592e+144, 1.1200421549683363397238e+145,
+	1.0873661566567430802737e+146, 1.0584398364450778410390e+147, 1.0329978488239059262600e+148,
+	1.0108100438050493381923e+149, 9.9167793487094968920957e+149, 9.7543169227187261135553e+150,
+	9.6192759682482119853328e+151, 9.5104589996507579607164e+152, 9.4268904488832477456262e+153,
+	9.3678021146559965913056e+154, 9.3326215443944152681699e+155, 9.3209631040827166083491e+156,
+	9.3326215443944152681699e+157, 9.3675679196031301913909e+158, 9.4259477598383594208516e+159,
+	9.5080814383971771442617e+160, 9.6144667150351266092687e+161, 9.7457834743571065728683e+162,
+	9.9029007164861804075467e+163, 1.0086885895959605302919e+165, 1.0299016745145627623849e+166,
+	1.0540795761277787541550e+167, 1.0813967582402909005041e+168, 1.1120539528148065856335e+169,
+	1.1462805637347083545343e+170, 1.1843374597477690136997e+171, 1.2265202031961379393518e+172,
+	1.2731627692288516897272e+173, 1.3246418194518289744999e+174, 1.3813816046133040833540e+175,
+	1.4438595832024935822049e+176, 1.5126128570515679712726e+177, 1.5882455415227429404254e+178,
+	1.6714372070419826082562e+179, 1.7629525510902446638722e+180, 1.8636524858518106082057e+181,
+	1.9745068572210740235368e+182, 2.0966090465832869342314e+183, 2.2311927486598136465966e+184,
+	2.3796512678720306703527e+185, 2.5435597334721875571201e+186, 2.7247007017134751175538e+187,
+	2.9250936934930156906882e+188, 3.1470293104790637607746e+189, 3.3931086844518982011983e+190,
+	3.6662891467081092813025e+191, 3.9699371608087208954020e+192, 4.3078897473820284055304e+193,
+	4.6845258497542906565743e+194, 5.1048493506477036605535e+195, 5.5745857612076058813234e+196,
+	6.1002949740240058743615e+197, 6.6895029134491270575881e+198, 7.3508554436989270786056e+199,
+	8.0942985252734437396816e+200, 8.9312893640941964005057e+201, 9.8750442008336013624116e+202,
+	1.0940829471015390590620e+204, 1.2146304367025329675766e+205, 1.3511924396704007379415e+206,
+	1.5061417415111408797950e+207, 1.6822345873896489187372e+208, 1.8826771768889260997438e+209,
+	2.1112044071740093930152e+210, 2.3721732428800468856771e+211, 2.6706735750751218821642e+212,
+	3.0126600184576595448100e+213, 3.4051088082207803997593e+214, 3.8562048236258042173568e+215,
+	4.3755648185637028136907e+216, 4.9745042224772874403902e+217, 5.6663564400399951437295e+218,
+	6.4668554892204736725073e+219, 7.3945951542521936625670e+220, 8.4715806908788205109846e+221,
+	9.7238926278416346662756e+222, 1.1182486511960043074500e+224, 1.2884157731890165932815e+225,
+	1.4872707060906857289085e+226, 1.7200350572073371520308e+227, 1.9929427461615188767373e+228,
+	2.3134471519438684694815e+229, 2.6904727073180504835954e+230, 3.1347208908839417761474e+231,
+	3.6590428819525486576897e+232, 4.2788940160565805244412e+233, 5.0128887482749916610349e+234,
+	5.8834792720777982211066e+235, 6.9177864726194884922282e+236, 8.1486187918277505362327e+237,
+	9.6157231969410890041972e+238, 1.1367323214599711998045e+240, 1.3462012475717524605876e+241,
+	1.5971089116512595357253e+242, 1.8981437590761709694285e+243, 2.2599091099865322430512e+244,
+	2.6953641378881627765885e+245, 3.2203704817308084463480e+246, 3.8543707171800727705216e+247,
+	4.6212316412837101205094e+248, 5.5502938327393047895511e+249, 6.6776797216549611241361e+250,
+	8.0479260574719919448490e+251, 9.7160239950079684356181e+252, 1.1749972043909108239480e+254,
+	1.4233975152686673758180e+255, 1.7272458904546389112035e+256, 2.0995113350212843793316e+257,
+	2.5563239178728655885812e+258, 3.1177743325066073033074e+259, 3.8089226376305697269860e+260,
+	4.6610726270973779184446e+261, 5.7133839564458545904789e+262, 7.0149143037815537672592e+263,
+	8.6272097742332404316232e+264, 1.0627595170229053957398e+266, 1.3113358856834525456067e+267,
+	1.6207082634599307285031e+268, 2.0063439050956823947783e+269, 2.4877871844109936682523e+270,
+	3.0897696138473508879586e+271, 3.8436311999149852174498e+272, 4.7891429014633938763358e+273,
+	5.9768465158678020131345e+274, 7.4710629262828944470838e+275, 9.3537647973331101505555e+276,
+	1.1729568794264144281922e+278, 1.4732179555799648487125e+279, 1.8532718694937347965436e+280,
+	2.3350504595942442852093e+281, 2.9467022724950383265043e+282, 3.7244054830528196349088e+283,
+	4.7147236359920613224069e+284, 5.9776708002997755140287e+285, 7.5907050539472187290752e+286,
+	9.6539383424841374551563e+287, 1.2296942187394494341102e+289, 1.5687649806536723364629e+290,
+	2.0044015765453025775996e+291, 2.5649307433687542701168e+292, 3.2872185855342962272633e+293,
+	4.2193110728416007743422e+294, 5.4239106661315887749845e+295, 6.9829598255528492815363e+296,
+	9.0036917057784373664743e+297, 1.1626628109545494053758e+299, 1.5036165148649990402012e+300,
+	1.9474602083488702540045e+301, 2.5260757449731983875380e+302, 3.2814704510678463779975e+303,
+	4.2690680090047052749393e+304, 5.5620924145599996107058e+305, 7.2574156153079989673967e+306,
+	9.4833675668247993362534e+307,
+	};
+
+constexpr double _Gamma_halves_reach = 171.5;
+
+inline bool _Gamma_tabulated(const double _Px)
+	{	// whether x is an integer or half an odd integer with Gamma(x) in _Gamma_halves
+	return ((0 < _Px) & (_Px <= _Gamma_halves_reach) & (2 * _Px == _CSTD floor(2 * _Px)));
+	}
+
+inline double _Gamma_from_table(const double _Px)
+	{
+	return (_Gamma_halves[static_cast<size_t>(2 * _Px) - 1]);
+	}
+
+double _Lbeta_lanczos(const double _Px, const double _Py)
+	{	// log B(a, b) for positive finite a and b, as Boost's beta takes B with a >= b:
+		//	B(a, b) = L(a) L(b) / L(c) (a + g - 1/2)^(a - 1/2) (b + g - 1/2)^b
+		//		/ (c + g - 1/2)^c sqrt(e / (b + g - 1/2)), c = a + b
+		// with (a + g - 1/2) / (c + g - 1/2) = 1 - b / (c + g - 1/2) through log1p
+	using _Lanczos = boost::math::lanczos::lanczos13m53;
+	const double _Big = _STD max(_Px, _Py);
+	const double _Small = _STD min(_Px, _Py);
+	const double _Sum = _Big + _Small;
+	if (_Sum < numeric_limits<double>::epsilon())
+		{	// B(a, b) = 1 / a + 1 / b to within c, which may overflow
+		return (_CSTD log(_Sum) - _CSTD log(_Big) - _CSTD log(_Small));
+		}
+
+	if (_Sum == _Big && _Small < numeric_limits<double>::epsilon())
+		{
+		return (-_CSTD log(_Small));
+		}
+
+	const double _Small_gh = _Small + (_Lanczos_g - 0.5);
+	const double _Sum_gh = _Sum + (_Lanczos_g - 0.5);
+	const double _Ratio = _Lanczos::lanczos_sum_expG_scaled(_Big)
+		* (_Lanczos::lanczos_sum_expG_scaled(_Small) / _Lanczos::lanczos_sum_expG_scaled(_Sum));
+	return (_CSTD log(_Ratio / _CSTD sqrt(_Small_gh)) + 0.5
+		+ (_Big - 0.5) * _CSTD log1p(-_Small / _Sum_gh)
+		+ _Small * _CSTD log(_Small_gh / _Sum_gh));
+	}
+
+template<class _Ty> inline
+	_Ty * _Lbeta_batch(const _Ty * _First_a, const size_t _Stride_a, const _Ty * _First_b,
+		const _Ty * const _Last_b, _Ty * _Dest)
+	{	// log B(a, b) for a at _First_a[i * _Stride_a] and b at _First_b[i], _Batch_lanes at a
+		// time in double, a fixed when _Stride_a is 0 and its Lanczos terms then evaluated
+		// once: a scalar pass gathers the lanes whose a, b, and a + b all have tabulated
+		// Gamma values and those the Lanczos form takes, leaving to lbeta whatever is
+		// nonpositive, below epsilon, infinite, or NaN
+	const _Lane_table& _Table = _Lane_table_in_use();
+	double _Exact_a[_Batch_lanes];
+	double _Exact_b[_Batch_lanes];
+	double _Lanczos_a[_Batch_lanes];
+	double _Lanczos_b[_Batch_lanes];
+	double _Num_a[_Batch_lanes];
+	double _Den_a[_Batch_lanes];
+	size_t _Exact_slot[_Batch_lanes];
+	size_t _Lanczos_slot[_Batch_lanes];
+	size_t _Scalar_slot[_Batch_lanes];
+	double _Fixed_num = 0;
+	double _Fixed_den = 1;
+	if (_Stride_a == 0)
+		{
+		const double _Pa = static_cast<double>(*_First_a);
+		if (numeric_limits<double>::epsilon() <= _Pa && _Pa <= numeric_limits<double>::max())
+			{
+			_Table._Lanczos(&_Pa, &_Fixed_num, &_Fixed_den, 1);
+			}
+		}
+
+	while (_First_b != _Last_b)
+		{	// gathered as in _Expint_batch
+		const size_t _Count = _STD min(static_cast<size_t>(_Last_b - _First_b), _Batch_lanes);
+		size_t _Exact_count = 0;
+		size_t _Lanczos_count = 0;
+		size_t _Scalar_count = 0;
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			const double _Pa = static_cast<double>(_First_a[_Idx * _Stride_a]);
+			const double _Pb = static_cast<double>(_First_b[_Idx]);
+			const double _Sum = _Pa + _Pb;
+			const bool _Exact = _Gamma_tabulated(_Pa) & _Gamma_tabulated(_Pb)
+				& _Gamma_tabulated(_Sum);
+			const bool _Lanes = (numeric_limits<double>::epsilon() <= _STD min(_Pa, _Pb))
+				& (_Sum <= numeric_limits<double>::max());
+			_Exact_slot[_Exact_count] = _Idx;
+			_Exact_a[_Exact_count] = _Pa;
+			_Exact_b[_Exact_count] = _Pb;
+			_Exact_count += _Exact;
+			_Lanczos_slot[_Lanczos_count] = _Idx;
+			_Lanczos_a[_Lanczos_count] = _Pa;
+			_Lanczos_b[_Lanczos_count] = _Pb;
+			_Lanczos_count += _Lanes & !_Exact;
+			_Scalar_slot[_Scalar_count] = _Idx;
+			_Scalar_count += !_Lanes & !_Exact;
+			}
+
+		for (size_t _Lane = 0; _Lane < _Exact_count; ++_Lane)
+			{	// B(a, b) rounded three times from exact Gamma values
+			_Exact_a[_Lane] = _Gamma_from_table(_Exact_a[_Lane])
+				* (_Gamma_from_table(_Exact_b[_Lane])
+					/ _Gamma_from_table(_Exact_a[_Lane] + _Exact_b[_Lane]));
+			_Exact_b[_Lane] = 0;
+			}
+
+		_Table._Lane_kernels<double>::_Log(_Exact_a, _Exact_b, _Exact_a, _Exact_count);
+		for (size_t _Lane = 0; _Lane < _Exact_count; ++_Lane)
+			{
+			_Dest[_Exact_slot[_Lane]] = static_cast<_Ty>(_Exact_a[_Lane]);
+			}
+
+		if (_Stride_a == 0)
+			{
+			_STD fill_n(_Num_a, _Lanczos_count, _Fixed_num);
+			_STD fill_n(_Den_a, _Lanczos_count, _Fixed_den);
+			}
+		else
+			{
+			_Table._Lanczos(_Lanczos_a, _Num_a, _Den_a, _Lanczos_count);
+			}
+
+		_Table._Lbeta(_Lanczos_a, _Lanczos_b, _Num_a, _Den_a, _Lanczos_a, _Lanczos_count);
+		for (size_t _Lane = 0; _Lane < _Lanczos_count; ++_Lane)
+			{
+			_Dest[_Lanczos_slot[_Lane]] = static_cast<_Ty>(_Lanczos_a[_Lane]);
+			}
+
+		for (size_t _Lane = 0; _Lane < _Scalar_count; ++_Lane)
+			{
+			const size_t _Idx = _Scalar_slot[_Lane];
+			_Dest[_Idx] = static_cast<_Ty>(_STD lbeta(static_cast<double>(_First_a[_Idx * _Stride_a]),
+				static_cast<double>(_First_b[_Idx])));
+			}
+
+		_First_a += _Count * _Stride_a;
+		_First_b += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+} // unnamed namespace
+
+double lbeta(const double _Px, const double _Py)
+	{
+	if (_CSTD isnan(_Px) || _CSTD isnan(_Py))
+		{
+		return (_Px + _Py);
+		}
+
+	if (_Px <= 0 || _Py <= 0)
+		{	// as for beta
+		errno = EDOM;
+		return (numeric_limits<double>::quiet_NaN());
+		}
+
+	if (_CSTD isinf(_Px) || _CSTD isinf(_Py))
+		{
+		return (-numeric_limits<double>::infinity());
+		}
+
+	const double _Sum = _Px + _Py;
+	if (_Gamma_tabulated(_Px) && _Gamma_tabulated(_Py) && _Gamma_tabulated(_Sum))
+		{
+		return (_CSTD log(_Gamma_from_table(_Px)
+			* (_Gamma_from_table(_Py) / _Gamma_from_table(_Sum))));
+		}
+
+	return (_Lbeta_lanczos(_Px, _Py));
+	}
+
+float lbetaf(const float _Px, const float _Py)
+	{
+	return (static_cast<float>(_STD lbeta(static_cast<double>(_Px), static_cast<double>(_Py))));
+	}
+
+double * lbeta_batch(const double * const _First_a, const double * const _Last_a,
+	const double * const _First_b, double * const _Dest)
+	{	// a and b trade places so that a runs from first to last
+	return (_Lbeta_batch(_First_b, 1, _First_a, _Last_a, _Dest));
+	}
+
+float * lbeta_batch(const float * const _First_a, const float * const _Last_a,
+	const float * const _First_b, float * const _Dest)
+	{
+	return (_Lbeta_batch(_First_b, 1, _First_a, _Last_a, _Dest));
+	}
+
+long double * lbeta_batch(const long double * const _First_a, const long double * const _Last_a,
+	const long double * const _First_b, long double * const _Dest)
+	{
+	return (_Lbeta_batch(_First_b, 1, _First_a, _Last_a, _Dest));
+	}
+
+double * lbeta_batch(const double _Pa, const double * const _First_b,
+	const double * const _Last_b, double * const _Dest)
+	{
+	return (_Lbeta_batch(&_Pa, 0, _First_b, _Last_b, _Dest));
+	}
+
+float * lbeta_batch(const float _Pa, const float * const _First_b, const float * const _Last_b,
+	float * const _Dest)
+	{
+	return (_Lbeta_batch(&_Pa, 0, _First_b, _Last_b, _Dest));
+	}
+
+long double * lbeta_batch(const long double _Pa, const long double * const _First_b,
+	const long double * const _Last_b, long double * const _Dest)
+	{
+	return (_Lbeta_batch(&_Pa, 0, _First_b, _Last_b, _Dest));
+	}
+
+namespace {
+	// Carlson's duplication step and its lanes are in special_math_kernels.hpp; here, the
+	// scalar forms and the special cases
+template<bool _With_rd,
+	bool _With_rj,
+	class _Ty = double> inline
+	_Carlson_state _Carlson_converge(_Carlson_state _State)
+	{
+	while (_Carlson_live<_With_rd, _With_rj, _Ty>(_State))
+		{
+		_State = _Carlson_step<_With_rd, _With_rj>(_State);
+		}
+
+	return (_State);
+	}
+
+double _Carlson_finish_rf(const _Carlson_state& _State)
+	{
+	const double _Mean = (_State._Xx + _State._Yy + _State._Zz) / 3;
+	const double _Dx = (_Mean - _State._Xx) / _Mean;
+	const double _Dy = (_Mean - _State._Yy) / _Mean;
+	const double _Dz = -(_Dx + _Dy);
+	const double _E2 = _Dx * _Dy - _Dz * _Dz;
+	const double _E3 = _Dx * _Dy * _Dz;
+	return ((1 - _E2 / 10 + _E3 / 14 + _E2 * _E2 / 24 - 3 * _E2 * _E3 / 44) / _CSTD sqrt(_Mean));
+	}
+
+double _Carlson_series(const double _E2, const double _E3, const double _E4, const double _E5)
+	{	// shared by R_D and R_J
+	return (1 - 3 * _E2 / 14 + _E3 / 6 + 9 * _E2 * _E2 / 88 - 3 * _E4 / 22
+		- 9 * _E2 * _E3 / 52 + 3 * _E5 / 26);
+	}
+
+double _Carlson_finish_rd(const _Carlson_state& _State)
+	{
+	const double _Mean = (_State._Xx + _State._Yy + 3 * _State._Zz) / 5;
+	const double _Dx = (_Mean - _State._Xx) / _Mean;
+	const double _Dy = (_Mean - _State._Yy) / _Mean;
+	const double _Dz = -(_Dx + _Dy) / 3;
+	const double _Dxy = _Dx * _Dy;
+	const double _Dzz = _Dz * _Dz;
+	const double _Series = _Carlson_series(_Dxy - 6 * _Dzz, (3 * _Dxy - 8 * _Dzz) * _Dz,
+		3 * (_Dxy - _Dzz) * _Dzz, _Dxy * _Dzz * _Dz);
+	return (_State._Scale * _Series / (_Mean * _CSTD sqrt(_Mean)) + 3 * _State._Sum_d);
+	}
+
+double _Carlson_finish_rj(const _Carlson_state& _State)
+	{
+	const double _Mean = (_State._Xx + _State._Yy + _State._Zz + 2 * _State._Pp) / 5;
+	const double _Dx = (_Mean - _State._Xx) / _Mean;
+	const double _Dy = (_Mean - _State._Yy) / _Mean;
+	const double _Dz = (_Mean - _State._Zz) / _Mean;
+	const double _Dp = -(_Dx + _Dy + _Dz) / 2;
+	const double _Dxyz = _Dx * _Dy * _Dz;
+	const double _Dpp = _Dp * _Dp;
+	const double _E2 = _Dx * _Dy + _Dx * _Dz + _Dy * _Dz - 3 * _Dpp;
+	const double _Series = _Carlson_series(_E2, _Dxyz + 2 * _E2 * _Dp + 4 * _Dpp * _Dp,
+		(2 * _Dxyz + _E2 * _Dp + 3 * _Dpp * _Dp) * _Dp, _Dxyz * _Dpp);
+	return (_State._Scale * _Series / (_Mean * _CSTD sqrt(_Mean)) + 3 * _State._Sum_j);
+	}
+
+bool _Carlson_in_range(const double _Value)
+	{	// arguments the duplication handles without overflow or a long climb out of
+		// the subnormals; Boost takes the rest
+	return (_Value == 0 || (0x1p-500 <= _Value && _Value <= 0x1p500));
+	}
+
+	// each _Carlson_*_special settles the arguments the duplication does not take: NaN
+	// passes through, a domain error gives NaN, and arguments outside _Carlson_in_range go
+	// to Boost; it clears _Handled for the rest
+double _Carlson_rf_special(const double _Xx, const double _Yy, const double _Zz, bool& _Handled)
+	{
+	_Handled = true;
+	if (_CSTD isnan(_Xx) || _CSTD isnan(_Yy) || _CSTD isnan(_Zz))
+		{
+		return (_Xx + _Yy + _Zz);
+		}
+	else if (_Xx < 0 || _Yy < 0 || _Zz < 0 || (_Xx == 0) + (_Yy == 0) + (_Zz == 0) > 1)
+		{
+		errno = EDOM;
+		return (numeric_limits<double>::quiet_NaN());
+		}
+	else if (!_Carlson_in_range(_Xx) || !_Carlson_in_range(_Yy) || !_Carlson_in_range(_Zz))
+		{
+		return (_Boost_call([](auto... _Args) { return boost::math::ellint_rf(_Args...); },
+			_Xx, _Yy, _Zz));
+		}
+
+	_Handled = false;
+	return (0);
+	}
+
+double _Carlson_rd_special(const double _Xx, const double _Yy, const double _Zz, bool& _Handled)
+	{
+	_Handled = true;
+	if (_CSTD isnan(_Xx) || _CSTD isnan(_Yy) || _CSTD isnan(_Zz))
+		{
+		return (_Xx + _Yy + _Zz);
+		}
+	else if (_Xx < 0 || _Yy < 0 || _Zz <= 0 || _Xx + _Yy == 0)
+		{
+		errno = EDOM;
+		return (numeric_limits<double>::quiet_NaN());
+		}
+	else if (!_Carlson_in_range(_Xx) || !_Carlson_in_range(_Yy) || !_Carlson_in_range(_Zz))
+		{
+		return (_Boost_call([](auto... _Args) { return boost::math::ellint_rd(_Args...); },
+			_Xx, _Yy, _Zz));
+		}
+
+	_Handled = false;
+	return (0);
+	}
+
+double _Carlson_rj_special(const double _Xx, const double _Yy, const double _Zz, const double _Pp,
+	bool& _Handled)
+	{
+	_Handled = true;
+	if (_CSTD isnan(_Xx) || _CSTD isnan(_Yy) || _CSTD isnan(_Zz) || _CSTD isnan(_Pp))
+		{
+		return (_Xx + _Yy + _Zz + _Pp);
+		}
+	else if (_Xx < 0 || _Yy < 0 || _Zz < 0 || _Pp == 0
+		|| (_Xx == 0) + (_Yy == 0) + (_Zz == 0) > 1)
+		{
+		errno = EDOM;
+		return (numeric_limits<double>::quiet_NaN());
+		}
+	else if (_Pp < 0 || !_Carlson_in_range(_Xx) || !_Carlson_in_range(_Yy)
+		|| !_Carlson_in_range(_Zz) || !_Carlson_in_range(_Pp))
+		{	// p < 0 is a Cauchy principal value
+		return (_Boost_call([](auto... _Args) { return boost::math::ellint_rj(_Args...); },
+			_Xx, _Yy, _Zz, _Pp));
+		}
+
+	_Handled = false;
+	return (0);
+	}
+
+template<class _Ty = double> inline
+	double _Carlson_rf(const double _Xx, const double _Yy, const double _Zz)
+	{
+	bool _Handled;
+	const double _Special = _Carlson_rf_special(_Xx, _Yy, _Zz, _Handled);
+	return (_Handled ? _Special
+		: _Carlson_finish_rf(_Carlson_converge<false, false, _Ty>(_Carlson_start(_Xx, _Yy, _Zz))));
+	}
+
+template<class _Ty = double> inline
+	double _Carlson_rd(const double _Xx, const double _Yy, const double _Zz)
+	{
+	bool _Handled;
+	const double _Special = _Carlson_rd_special(_Xx, _Yy, _Zz, _Handled);
+	return (_Handled ? _Special
+		: _Carlson_finish_rd(_Carlson_converge<true, false, _Ty>(_Carlson_start(_Xx, _Yy, _Zz))));
+	}
+
+template<class _Ty = double> inline
+	double _Carlson_rj(const double _Xx, const double _Yy, const double _Zz, const double _Pp)
+	{
+	bool _Handled;
+	const double _Special = _Carlson_rj_special(_Xx, _Yy, _Zz, _Pp, _Handled);
+	return (_Handled ? _Special
+		: _Carlson_finish_rj(_Carlson_converge<false, true, _Ty>(_Carlson_start(_Xx, _Yy, _Zz, _Pp))));
+	}
+
+template<bool _With_rd,
+	bool _With_rj,
+	class _Special,
+	class _Finish,
+	class _Ty> inline
+	_Ty * _Carlson_batch(const _Special& _Spec, const _Finish& _Fin,
+		const _Ty * _First_x, const _Ty * const _Last_x, const _Ty * _First_y,
+		const _Ty * _First_z, const _Ty * _First_p, _Ty * _Dest)
+	{	// run the duplication over blocks of _Batch_lanes argument sets at once; lanes that
+		// _Spec settles run (1, 1, 1, 1), which needs no steps. _First_p is null but for R_J.
+	const auto _Converge = _Lane_kernels_in_use<_Ty>()._Carlson_converge[_With_rd][_With_rj];
+	_Carlson_lanes _Lanes;
+	double _Settled[_Batch_lanes];
+	bool _Handled[_Batch_lanes];
+	while (_First_x != _Last_x)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last_x - _First_x), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			_Handled[_Idx] = true;
+			if (_Idx < _Count)
+				{
+				const double _Xx = static_cast<double>(_First_x[_Idx]);
+				const double _Yy = static_cast<double>(_First_y[_Idx]);
+				const double _Zz = static_cast<double>(_First_z[_Idx]);
+				const double _Pp = _First_p ? static_cast<double>(_First_p[_Idx]) : 1.0;
+				_Settled[_Idx] = _Spec(_Xx, _Yy, _Zz, _Pp, _Handled[_Idx]);
+				if (!_Handled[_Idx])
+					{
+					_Carlson_set(_Lanes, _Idx, _Carlson_start(_Xx, _Yy, _Zz, _Pp));
+					}
+				}
+
+			if (_Handled[_Idx])
+				{
+				_Carlson_set(_Lanes, _Idx, _Carlson_start(1, 1, 1, 1));
+				}
+			}
+
+		_Converge(_Lanes);
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			_Dest[_Idx] = static_cast<_Ty>(_Handled[_Idx] ? _Settled[_Idx] : _Fin(_Carlson_get(_Lanes, _Idx)));
+			}
+
+		_First_x += _Count;
+		_First_y += _Count;
+		_First_z += _Count;
+		_First_p = _First_p ? _First_p + _Count : _First_p;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+
+template<class _Ty> inline
+	_Ty * _Carlson_rf_batch(const _Ty * const _First_x, const _Ty * const _Last_x,
+		const _Ty * const _First_y, const _Ty * const _First_z, _Ty * const _Dest)
+	{
+	return (_Carlson_batch<false, false>(
+		[](double _Xx, double _Yy, double _Zz, double, bool& _Handled) {
+			return (_Carlson_rf_special(_Xx, _Yy, _Zz, _Handled)); },
+		_Carlson_finish_rf, _First_x, _Last_x, _First_y, _First_z,
+		static_cast<const _Ty *>(nullptr), _Dest));
+	}
+
+template<class _Ty> inline
+	_Ty * _Carlson_rd_batch(const _Ty * const _First_x, const _Ty * const _Last_x,
+		const _Ty * const _First_y, const _Ty * const _First_z, _Ty * const _Dest)
+	{
+	return (_Carlson_batch<true, false>(
+		[](double _Xx, double _Yy, double _Zz, double, bool& _Handled) {
+			return (_Carlson_rd_special(_Xx, _Yy, _Zz, _Handled)); },
+		_Carlson_finish_rd, _First_x, _Last_x, _First_y, _First_z,
+		static_cast<const _Ty *>(nullptr), _Dest));
+	}
+
+template<class _Ty> inline
+	_Ty * _Carlson_rj_batch(const _Ty * const _First_x, const _Ty * const _Last_x,
+		const _Ty * const _First_y, const _Ty * const _First_z, const _Ty * const _First_p,
+		_Ty * const _Dest)
+	{
+	return (_Carlson_batch<false, true>(_Carlson_rj_special, _Carlson_finish_rj,
+		_First_x, _Last_x, _First_y, _First_z, _First_p, _Dest));
+	}
+} // unnamed namespace
+
+double carlson_rd(const double _Px, const double _Py, const double _Pz)
+	{
+	return (_Carlson_rd(_Px, _Py, _Pz));
+	}
+
+float carlson_rd(const float _Px, const float _Py, const float _Pz)
+	{
+	return (static_cast<float>(_Carlson_rd<float>(_Px, _Py, _Pz)));
+	}
+
+double * carlson_rd_batch(const double * const _First_x, const double * const _Last_x,
+	const double * const _First_y, const double * const _First_z, double * const _Dest)
+	{
+	return (_Carlson_rd_batch(_First_x, _Last_x, _First_y, _First_z, _Dest));
+	}
+
+float * carlson_rd_batch(const float * const _First_x, const float * const _Last_x,
+	const float * const _First_y, const float * const _First_z, float * const _Dest)
+	{
+	return (_Carlson_rd_batch(_First_x, _Last_x, _First_y, _First_z, _Dest));
+	}
+
+long double * carlson_rd_batch(const long double * const _First_x, const long double * const _Last_x,
+	const long double * const _First_y, const long double * const _First_z, long double * const _Dest)
+	{
+	return (_Carlson_rd_batch(_First_x, _Last_x, _First_y, _First_z, _Dest));
+	}
+
+double carlson_rf(const double _Px, const double _Py, const double _Pz)
+	{
+	return (_Carlson_rf(_Px, _Py, _Pz));
+	}
+
+float carlson_rf(const float _Px, const float _Py, const float _Pz)
+	{
+	return (static_cast<float>(_Carlson_rf<float>(_Px, _Py, _Pz)));
+	}
+
+double * carlson_rf_batch(const double * const _First_x, const double * const _Last_x,
+	const double * const _First_y, const double * const _First_z, double * const _Dest)
+	{
+	return (_Carlson_rf_batch(_First_x, _Last_x, _First_y, _First_z, _Dest));
+	}
+
+float * carlson_rf_batch(const float * const _First_x, const float * const _Last_x,
+	const float * const _First_y, const float * const _First_z, float * const _Dest)
+	{
+	return (_Carlson_rf_batch(_First_x, _Last_x, _First_y, _First_z, _Dest));
+	}
+
+long double * carlson_rf_batch(const long double * const _First_x, const long double * const _Last_x,
+	const long double * const _First_y, const long double * const _First_z, long double * const _Dest)
+	{
+	return (_Carlson_rf_batch(_First_x, _Last_x, _First_y, _First_z, _Dest));
+	}
+
+double carlson_rj(const double _Px, const double _Py, const double _Pz, const double _Pp)
+	{
+	return (_Carlson_rj(_Px, _Py, _Pz, _Pp));
+	}
+
+float carlson_rj(const float _Px, const float _Py, const float _Pz, const float _Pp)
+	{
+	return (static_cast<float>(_Carlson_rj<float>(_Px, _Py, _Pz, _Pp)));
+	}
+
+double * carlson_rj_batch(const double * const _First_x, const double * const _Last_x,
+	const double * const _First_y, const double * const _First_z, const double * const _First_p,
+	double * const _Dest)
+	{
+	return (_Carlson_rj_batch(_First_x, _Last_x, _First_y, _First_z, _First_p, _Dest));
+	}
+
+float * carlson_rj_batch(const float * const _First_x, const float * const _Last_x,
+	const float * const _First_y, const float * const _First_z, const float * const _First_p,
+	float * const _Dest)
+	{
+	return (_Carlson_rj_batch(_First_x, _Last_x, _First_y, _First_z, _First_p, _Dest));
+	}
+
+long double * carlson_rj_batch(const long double * const _First_x, const long double * const _Last_x,
+	const long double * const _First_y, const long double * const _First_z,
+	const long double * const _First_p, long double * const _Dest)
+	{
+	return (_Carlson_rj_batch(_First_x, _Last_x, _First_y, _First_z, _First_p, _Dest));
+	}
+
+namespace {
+	// K(k) and E(k) to float accuracy as a + b log(1 / m1), a and b quartics in m1 = 1 - k^2
+	// [A&S 17.3.34, 17.3.36], within 2e-8 of either integral: one logarithm in place of the
+	// iteration double needs. Each table holds a then b, lowest order first.
+constexpr double _Comp_ellint_1_float[] =
+	{
+	1.38629436112, 0.09666344259, 0.03590092383, 0.03742563713, 0.01451196212,
+	0.5, 0.12498593597, 0.06880248576, 0.03328355346, 0.00441787012,
+	};
+
+constexpr double _Comp_ellint_2_float[] =
+	{
+	1.0, 0.44325141463, 0.06260601220, 0.04757383546, 0.01736506451,
+	0.0, 0.24998368310, 0.09200180037, 0.04069697526, 0.00526449639,
+	};
+
+double _Comp_ellint_fit(const double _Kx, const double (&_Coeff)[10])
+	{	// the integral _Coeff approximates, for 0 <= k < 1
+	constexpr size_t _Terms = 5;
+	const double _M1 = (1 - _Kx) * (1 + _Kx);	// without cancellation as k -> 1
+	double _Poly = _Coeff[_Terms - 1];
+	double _Log_poly = _Coeff[2 * _Terms - 1];
+	for (size_t _Idx = _Terms - 1; 0 < _Idx--; )
+		{
+		_Poly = _Poly * _M1 + _Coeff[_Idx];
+		_Log_poly = _Log_poly * _M1 + _Coeff[_Terms + _Idx];
+		}
+
+	return (_Poly - _Log_poly * _CSTD log(_M1));
+	}
+
+float _Comp_ellint_float(const float _Pk, const double (&_Coeff)[10], const double _At_unit)
+	{	// the integral _Coeff approximates, _At_unit at |k| = 1
+	const double _Kx = _CSTD fabs(_Pk);
+	if (_CSTD isnan(_Pk))
+		{
+		return (_Pk);
+		}
+	else if (_Kx > 1)
+		{
+		errno = EDOM;
+		return (numeric_limits<float>::quiet_NaN());
+		}
+	else if (_Kx == 1)
+		{
+		return (static_cast<float>(_At_unit));
+		}
+
+	return (static_cast<float>(_Comp_ellint_fit(_Kx, _Coeff)));
+	}
+} // unnamed namespace
+
+double comp_ellint_1(const double _Pk)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::ellint_1(_Args...); },
+		_Pk));
+	}
+
+float comp_ellint_1f(const float _Pk)
+	{
+	return (_Comp_ellint_float(_Pk, _Comp_ellint_1_float, numeric_limits<double>::infinity()));
+	}
+
+double comp_ellint_2(const double _Pk)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::ellint_2(_Args...); },
+		_Pk));
+	}
+
+float comp_ellint_2f(const float _Pk)
+	{
+	return (_Comp_ellint_float(_Pk, _Comp_ellint_2_float, 1));
+	}
+
+namespace {
+	// the AGM step for K(k) and E(k) and its lanes are in special_math_kernels.hpp; here,
+	// the scalar forms and the special cases
+inline complete_elliptic_integrals<double> _Complete_elliptic_finish(const _Complete_elliptic_state& _State)
+	{
+	constexpr _Compensated _Pi{0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53};
+	const _Compensated _First = _Compensated_quotient(_Pi, _Compensated_scale(_State._Arith, 2));
+	const _Compensated _Second = _Compensated_multiply(_First, _State._Sum);
+	return {_First._Hi + _First._Lo, _Second._Hi + _Second._Lo};
+	}
+
+complete_elliptic_integrals<double> _Complete_elliptic_special(const double _Pk)
+	{	// |k| >= 1 or NaN: NaN passes through, |k| > 1 is a domain error, and K(+/-1) = infinity
+	if (_CSTD isnan(_Pk))
+		{
+		return {_Pk, _Pk};
+		}
+	else if (_CSTD fabs(_Pk) > 1)
+		{
+		errno = EDOM;
+		return {numeric_limits<double>::quiet_NaN(), numeric_limits<double>::quiet_NaN()};
+		}
+	else
+		{
+		return {numeric_limits<double>::infinity(), 1};
+		}
+	}
+
+complete_elliptic_integrals<double> _Complete_elliptic(const double _Pk)
+	{
+	const double _Kx = _CSTD fabs(_Pk);
+	if (!(_Kx < 1))
+		{
+		return (_Complete_elliptic_special(_Pk));
+		}
+
+	_Complete_elliptic_state _State = _Complete_elliptic_start(_Kx);
+	for (double _Weight = 1; _Complete_elliptic_live(_State); _Weight *= 2)
+		{
+		_State = _Complete_elliptic_step(_State, _Weight);
+		}
+
+	return (_Complete_elliptic_finish(_State));
+	}
+
+template<class _Ty> inline
+	void _Complete_elliptic_batch(const _Ty * _First, const _Ty * const _Last,
+		_Ty * _First_kind, _Ty * _Second_kind)
+	{	// run the AGM over blocks of _Batch_lanes moduli at once; a lane stops changing
+		// when the scalar loop would stop, so results match comp_ellint_1_2 exactly. A null
+		// destination is skipped.
+	_Complete_elliptic_lanes _Lanes;
+	while (_First != _Last)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{	// the AGM needs k in [0, 1); other lanes, and the padding, run k = 0
+			const double _Kx = _Idx < _Count ? _CSTD fabs(static_cast<double>(_First[_Idx])) : 0.0;
+			_Complete_elliptic_set(_Lanes, _Idx, _Complete_elliptic_start(_Kx < 1 ? _Kx : 0.0));
+			}
+
+		_Lane_table_in_use()._Complete_elliptic_converge(_Lanes);
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			const double _Pk = static_cast<double>(_First[_Idx]);
+			const complete_elliptic_integrals<double> _Result = _CSTD fabs(_Pk) < 1
+				? _Complete_elliptic_finish(_Complete_elliptic_get(_Lanes, _Idx)) : _Complete_elliptic_special(_Pk);
+			if (_First_kind)
+				{
+				_First_kind[_Idx] = static_cast<_Ty>(_Result.first_kind);
+				}
+
+			if (_Second_kind)
+				{
+				_Second_kind[_Idx] = static_cast<_Ty>(_Result.second_kind);
+				}
+			}
+
+		_First += _Count;
+		_First_kind = _First_kind ? _First_kind + _Count : _First_kind;
+		_Second_kind = _Second_kind ? _Second_kind + _Count : _Second_kind;
+		}
+	}
+} // unnamed namespace
+
+complete_elliptic_integrals<double> comp_ellint_1_2(const double _Pk)
+	{
+	return (_Complete_elliptic(_Pk));
+	}
+
+complete_elliptic_integrals<float> comp_ellint_1_2(const float _Pk)
+	{
+	const auto _Result = _Complete_elliptic(_Pk);
+	return {static_cast<float>(_Result.first_kind), static_cast<float>(_Result.second_kind)};
+	}
+
+void comp_ellint_1_2_batch(const double * const _First, const double * const _Last,
+	double * const _First_kind, double * const _Second_kind)
+	{
+	_Complete_elliptic_batch(_First, _Last, _First_kind, _Second_kind);
+	}
+
+void comp_ellint_1_2_batch(const float * const _First, const float * const _Last,
+	float * const _First_kind, float * const _Second_kind)
+	{
+	_Complete_elliptic_batch(_First, _Last, _First_kind, _Second_kind);
+	}
+
+void comp_ellint_1_2_batch(const long double * const _First, const long double * const _Last,
+	long double * const _First_kind, long double * const _Second_kind)
+	{
+	_Complete_elliptic_batch(_First, _Last, _First_kind, _Second_kind);
+	}
+
+namespace {
+constexpr size_t _Cel_iterations = 16;	// k' >= 2^-27 for every double |k| < 1 settles in 8
+constexpr double _Cel_agreement = 0x1p-27;	// the error squares with the next step
+
+struct _Complete_third_sweep
+	{	// the k-only part of Bulirsch's cel(k', 1 - nu, 1, 1) = Pi(nu, k): its mean
+		// iteration never involves nu, so a sweep runs it once and each nu carries only
+		// the three terms that do
+	double _Scale[_Cel_iterations];
+	double _Mean;
+	size_t _Steps;
+
+	explicit _Complete_third_sweep(const double _Kx)
+		: _Mean(1), _Steps(0)
+		{	// needs |k| < 1
+		double _Geom = _CSTD sqrt((1 - _Kx) * (1 + _Kx));
+		double _Scaled = _Geom;
+		for (;;)
+			{
+			_Scale[_Steps++] = _Scaled;
+			const double _Prev = _Mean;
+			_Mean += _Geom;
+			if (_CSTD fabs(_Prev - _Geom) <= _Prev * _Cel_agreement || _Steps == _Cel_iterations)
+				{
+				break;
+				}
+
+			_Geom = 2 * _CSTD sqrt(_Scaled);
+			_Scaled = _Geom * _Mean;
+			}
+		}
+	};
+
+template<class _Ty> inline
+	_Ty * _Complete_third_batch(const double _Pk, const _Ty * _First, const _Ty * const _Last,
+		_Ty * _Dest)
+	{	// Pi(nu, k) for each nu in [_First, _Last): lanes of _Batch_lanes characteristics
+		// share one _Complete_third_sweep and step in lockstep, with no lane-dependent
+		// branch; nu >= 1, nu = -inf, NaNs, and any |k| >= 1 are settled by comp_ellint_3
+	if (!(_CSTD fabs(_Pk) < 1))
+		{
+		return (_STD transform(_First, _Last, _Dest,
+			[_Pk](const _Ty _Pnu) { return (static_cast<_Ty>(
+				_STD comp_ellint_3(_Pk, static_cast<double>(_Pnu)))); }));
+		}
+
+	const _Complete_third_sweep _Sweep(_CSTD fabs(_Pk));
+	const auto _Third_lanes = _Lane_table_in_use()._Complete_third;
+	double _Aa[_Batch_lanes];
+	double _Bb[_Batch_lanes];
+	double _Pp[_Batch_lanes];
+	while (_First != _Last)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{	// padding runs nu = 0
+			const double _Pnu = _Idx < _Count ? static_cast<double>(_First[_Idx]) : 0.0;
+			const double _Root = _CSTD sqrt(_Pnu < 1 ? 1 - _Pnu : 1.0);
+			_Aa[_Idx] = 1;
+			_Bb[_Idx] = 1 / _Root;
+			_Pp[_Idx] = _Root;
+			}
+
+		_Third_lanes(_Sweep._Scale, _Sweep._Steps, _Aa, _Bb, _Pp);
+
+		constexpr double _Half_pi = 0x1.921fb54442d18p+0;
+		const double _Mean = _Sweep._Mean;
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			const double _Pnu = static_cast<double>(_First[_Idx]);
+			_Dest[_Idx] = static_cast<_Ty>(_Pnu < 1 && -_Pnu <= numeric_limits<double>::max()
+				? _Half_pi * (_Bb[_Idx] + _Aa[_Idx] * _Mean) / (_Mean * (_Mean + _Pp[_Idx]))
+				: _STD comp_ellint_3(_Pk, _Pnu));
+			}
+
+		_First += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+} // unnamed namespace
+
+double comp_ellint_3(const double _Pk, const double _Pnu)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::ellint_3(_Args...); },
+		_Pk, _Pnu));
+	}
+
+float comp_ellint_3f(const float _Pk, const float _Pnu)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::ellint_3(_Args...); },
+		_Pk, _Pnu));
+	}
+
+double * comp_ellint_3_batch(const double _Pk, const double * const _First,
+	const double * const _Last, double * const _Dest)
+	{
+	return (_Complete_third_batch(_Pk, _First, _Last, _Dest));
+	}
+
+float * comp_ellint_3_batch(const float _Pk, const float * const _First,
+	const float * const _Last, float * const _Dest)
+	{
+	return (_Complete_third_batch(static_cast<double>(_Pk), _First, _Last, _Dest));
+	}
+
+long double * comp_ellint_3_batch(const long double _Pk, const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Complete_third_batch(static_cast<double>(_Pk), _First, _Last, _Dest));
+	}
+
+double cyl_bessel_i(const double _Pnu, const double _Px)
+	{
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_bessel_i(_Args...); },
+		_Pnu, _Px));
+	}
+
+float cyl_bessel_if(const float _Pnu, const float _Px)
+	{
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_bessel_i(_Args...); },
+		_Pnu, _Px));
+	}
+
+double cyl_bessel_j(const double _Pnu, const double _Px)
+	{
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_bessel_j(_Args...); },
+		_Pnu, _Px));
+	}
+
+float cyl_bessel_jf(const float _Pnu, const float _Px)
+	{	// orders 0 and +/-1 at finite x from the float fits, J_1 being odd in x and
+		// J_{-1} = -J_1; the rest from Boost
+	if ((_Pnu == 0 || _CSTD fabs(_Pnu) == 1) && _CSTD isfinite(_Px))
+		{
+		const bool _First = _Pnu != 0;
+		const double _Value = _Bessel_j_float(_First, _CSTD fabs(static_cast<double>(_Px)));
+		return (static_cast<float>(_First && ((_Pnu < 0) != (_Px < 0)) ? -_Value : _Value));
+		}
+
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_bessel_j(_Args...); },
+		_Pnu, _Px));
+	}
+
+double cyl_bessel_k(const double _Pnu, const double _Px)
+	{
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_bessel_k(_Args...); },
+		_Pnu, _Px));
+	}
+
+float cyl_bessel_kf(const float _Pnu, const float _Px)
+	{
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_bessel_k(_Args...); },
+		_Pnu, _Px));
+	}
+
+double cyl_neumann(const double _Pnu, const double _Px)
+	{
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_neumann(_Args...); },
+		_Pnu, _Px));
+	}
+
+float cyl_neumannf(const float _Pnu, const float _Px)
+	{
+	return (_Bessel_call([](auto... _Args) { return boost::math::cyl_neumann(_Args...); },
+		_Pnu, _Px));
+	}
+
+namespace {
+	// F, E, and Pi at amplitude r in [0, pi/2] all come from Carlson forms at the one point
+	// (x, y, z) = (cos^2 r, 1, 1 - k^2 sin^2 r) [DLMF 19.25.5, 19.25.10, 19.25.14, with every
+	// argument scaled by sin^2 r]:
+	//   F = s R_F(x, y, z)
+	//   E = (1 - k^2) s R_F(x, y, z) + k^2 (1 - k^2) s^3 R_D(x, y, z) / 3 + k^2 s c / sqrt(z)
+	//   Pi = s R_F(x, y, z) + nu s^3 R_J(x, y, z, 1 - nu s^2) / 3
+	// where s = sin r and c = cos r. This form of E has no cancellation. Larger amplitudes
+	// add whole periods of the complete integrals, the same forms at s = 1 and c = 0.
+constexpr _Compensated _Elliptic_pi{0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53};
+
+struct _Elliptic_amplitude
+	{
+	double _Reduced;	// |phi| - m pi, in [-pi/2, pi/2]
+	double _Periods;	// 2 m, or 2 |phi| / pi when m cannot be told from the period
+	};
+
+_Elliptic_amplitude _Reduce_amplitude(const double _Angle)
+	{	// _Angle >= 0
+	if (_Angle <= _Elliptic_pi._Hi / 2)
+		{
+		return {_Angle, 0};
+		}
+	else if (_Angle >= 0x1p52)
+		{	// no bits of phi are left below pi; like Boost, keep only the periods
+		return {0, 2 * _Angle / _Elliptic_pi._Hi};
+		}
+
+	// the quotient can round to the far period, leaving |r| a rounding error past pi/2, where
+	// cos r changes sign; clamp to keep c >= 0
+	const double _Mx = _CSTD nearbyint(_Angle / _Elliptic_pi._Hi);
+	const double _Rx = _CSTD fma(-_Mx, _Elliptic_pi._Hi, _Angle) - _Mx * _Elliptic_pi._Lo;
+	return {_STD max(-_Elliptic_pi._Hi / 2, _STD min(_Rx, _Elliptic_pi._Hi / 2)), 2 * _Mx};
+	}
+
+_Carlson_state _Elliptic_start(const double _Kx, const double _Pnu, const double _Sx,
+	const double _Cx)
+	{	// the duplication at the amplitude with sine _Sx >= 0 and cosine _Cx >= 0
+	const double _Kc = (1 - _Kx) * (1 + _Kx);
+	const double _Zz = _Cx * _Cx + _Kc * _Sx * _Sx;	// 1 - k^2 s^2, without cancellation
+	return (_Carlson_start(_Cx * _Cx, 1, _Zz, 1 - _Pnu * _Sx * _Sx));
+	}
+
+template<bool _With_second,
+	bool _With_third> inline
+	incomplete_elliptic_integrals<double> _Elliptic_finish(const double _Kx, const double _Pnu,
+		const double _Sx, const double _Cx, const _Carlson_state& _State)
+	{	// F, and E and Pi where asked for, from the converged _Elliptic_start(_Kx, _Pnu, _Sx, _Cx);
+		// needs |k| < 1 or _Cx > 0
+	const double _Nan = numeric_limits<double>::quiet_NaN();
+	const double _Rf = _Sx * _Carlson_finish_rf(_State);
+	const double _Sx3 = _Sx * _Sx * _Sx;
+	double _Second = _Nan;
+	if (_With_second)
+		{
+		const double _Kc = (1 - _Kx) * (1 + _Kx);
+		const double _Ksq = _Kx * _Kx;
+		_Second = _Kx == 1 ? _Sx
+			: _Kc * _Rf + _Ksq * _Kc * _Sx3 * _Carlson_finish_rd(_State) / 3
+				+ _Ksq * _Sx * _Cx / _CSTD sqrt(_Cx * _Cx + _Kc * _Sx * _Sx);
+		}
+
+	const double _Third = _With_third ? _Rf + _Pnu * _Sx3 * _Carlson_finish_rj(_State) / 3 : _Nan;
+	return {_Rf, _Second, _Third};
+	}
+
+template<class _Ty = double> inline
+	incomplete_elliptic_integrals<double> _Elliptic_carlson(const double _Kx, const double _Pnu,
+		const double _Sx, const double _Cx, const bool _With_third)
+	{	// F, E, and Pi at the amplitude with sine _Sx >= 0 and cosine _Cx >= 0, to the
+		// accuracy of _Ty; Pi only if _With_third
+	const _Carlson_state _Start = _Elliptic_start(_Kx, _Pnu, _Sx, _Cx);
+	return (_With_third
+		? _Elliptic_finish<true, true>(_Kx, _Pnu, _Sx, _Cx,
+			_Carlson_converge<true, true, _Ty>(_Start))
+		: _Elliptic_finish<true, false>(_Kx, _Pnu, _Sx, _Cx,
+			_Carlson_converge<true, false, _Ty>(_Start)));
+	}
+
+bool _Third_periodic(const double _Kx, const double _Pnu)
+	{	// whether Pi(nu, k) is an ordinary integral of modest arguments, so that whole
+		// periods of Pi can come from the duplication
+	return (_Kx < 1 && _Pnu < 1 && _Carlson_in_range(1 - _Pnu));
+	}
+
+template<class _Ty = double> inline
+	incomplete_elliptic_integrals<double> _Complete_carlson(const double _Kx, const double _Pnu,
+		const bool _With_third)
+	{	// K, E, and, if _With_third, Pi: the same forms at s = 1, c = 0; a float result
+		// wanting no Pi takes K and E from the fits comp_ellint_1f and comp_ellint_2f use
+	if (_Kx == 1)
+		{
+		return {numeric_limits<double>::infinity(), 1, numeric_limits<double>::quiet_NaN()};
+		}
+	else if (numeric_limits<_Ty>::digits < numeric_limits<double>::digits && !_With_third)
+		{
+		return {_Comp_ellint_fit(_Kx, _Comp_ellint_1_float),
+			_Comp_ellint_fit(_Kx, _Comp_ellint_2_float), numeric_limits<double>::quiet_NaN()};
+		}
+
+	return (_Elliptic_carlson<_Ty>(_Kx, _Pnu, 1, 0, _With_third));
+	}
+
+template<class _Ty = double,
+	class _Complete_fn> inline
+	incomplete_elliptic_integrals<double> _Incomplete_elliptic_with(const double _Pk,
+		const double _Pnu, const double _Pphi, const bool _With_third, const _Complete_fn& _Complete)
+	{	// ellint_1_2_3, taking the complete integrals from _Complete(|k|, _With_third) when
+		// phi has whole periods; without _With_third, Pi is not wanted and may be anything
+	if (_CSTD isnan(_Pk) || _CSTD isnan(_Pphi))
+		{
+		const double _Nan = _Pk + _Pphi;
+		return {_Nan, _Nan, _Nan};
+		}
+
+	const double _Kx = _CSTD fabs(_Pk);
+	if (_Kx > 1)
+		{
+		errno = EDOM;
+		return {numeric_limits<double>::quiet_NaN(), numeric_limits<double>::quiet_NaN(),
+			numeric_limits<double>::quiet_NaN()};
+		}
+
+	const _Elliptic_amplitude _Amplitude = _Reduce_amplitude(_CSTD fabs(_Pphi));
+	const double _Rx = _CSTD fabs(_Amplitude._Reduced);
+	const double _Sx = _CSTD sin(_Rx);
+	const double _Pp = 1 - _Pnu * _Sx * _Sx;
+
+	// Pi takes the shared duplication only where it is an ordinary integral of modest
+	// arguments; Boost handles the principal values and the extremes
+	const bool _Third_here = _With_third && _Pp > 0 && _Carlson_in_range(_Pp)
+		&& (_Amplitude._Periods == 0 || _Third_periodic(_Kx, _Pnu));
+
+	incomplete_elliptic_integrals<double> _Result =
+		_Elliptic_carlson<_Ty>(_Kx, _Pnu, _Sx, _CSTD cos(_Rx), _Third_here);
+	if (_Amplitude._Reduced < 0)
+		{
+		_Result = {-_Result.first_kind, -_Result.second_kind, -_Result.third_kind};
+		}
+
+	if (_Amplitude._Periods != 0)
+		{
+		const incomplete_elliptic_integrals<double> _Whole = _Complete(_Kx, _Third_here);
+		_Result.first_kind += _Amplitude._Periods * _Whole.first_kind;
+		_Result.second_kind += _Amplitude._Periods * _Whole.second_kind;
+		_Result.third_kind += _Amplitude._Periods * _Whole.third_kind;
+		}
+
+	if (_Pphi < 0)
+		{
+		_Result = {-_Result.first_kind, -_Result.second_kind, -_Result.third_kind};
+		}
+
+	if (_With_third && !_Third_here)
+		{
+		_Result.third_kind = _STD ellint_3(_Pk, _Pnu, _Pphi);
+		}
+
+	return (_Result);
+	}
+
+template<class _Ty = double> inline
+	incomplete_elliptic_integrals<double> _Incomplete_elliptic(const double _Pk,
+		const double _Pnu, const double _Pphi, const bool _With_third = true)
+	{
+	return (_Incomplete_elliptic_with<_Ty>(_Pk, _Pnu, _Pphi, _With_third,
+		[_Pnu](const double _Kx, const bool _Third) {
+			return (_Complete_carlson<_Ty>(_Kx, _Pnu, _Third));
+			}));
+	}
+
+template<class _Ty = double> inline
+	double _Elliptic_first_kind(const double _Pk, const double _Pphi)
+	{	// F(k, phi) alone, the duplication leaving out the RD sum that only E needs
+	if (_CSTD isnan(_Pk) || _CSTD isnan(_Pphi))
+		{
+		return (_Pk + _Pphi);
+		}
+
+	const double _Kx = _CSTD fabs(_Pk);
+	if (_Kx > 1)
+		{
+		errno = EDOM;
+		return (numeric_limits<double>::quiet_NaN());
+		}
+
+	const _Elliptic_amplitude _Amplitude = _Reduce_amplitude(_CSTD fabs(_Pphi));
+	const double _Rx = _CSTD fabs(_Amplitude._Reduced);
+	const double _Sx = _CSTD sin(_Rx);
+	const double _Cx = _CSTD cos(_Rx);
+	double _Result = _Elliptic_finish<false, false>(_Kx, 0, _Sx, _Cx,
+		_Carlson_converge<false, false, _Ty>(_Elliptic_start(_Kx, 0, _Sx, _Cx))).first_kind;
+	if (_Amplitude._Reduced < 0)
+		{
+		_Result = -_Result;
+		}
+
+	if (_Amplitude._Periods != 0)
+		{
+		_Result += _Amplitude._Periods * _Complete_carlson<_Ty>(_Kx, 0, false).first_kind;
+		}
+
+	return (_Pphi < 0 ? -_Result : _Result);
+	}
+
+template<bool _With_second,
+	class _Ty> inline
+	_Ty * _Elliptic_batch(const _Ty * _First_k, const _Ty * const _Last_k, const _Ty * _First_phi,
+		_Ty * _Dest)
+	{	// F(k, phi), or E(k, phi) if _With_second, over blocks of _Batch_lanes pairs at once.
+		// Each lane reduces its own phi; one set of lanes runs the duplication at the reduced
+		// amplitude, and where any lane has whole periods, a second set runs it at s = 1,
+		// c = 0 for the complete integrals. Lanes _Incomplete_elliptic settles, and lanes with
+		// no periods in the second set, run (1, 1, 1), which needs no steps.
+	const auto _Converge = _Lane_kernels_in_use<_Ty>()._Carlson_converge[_With_second][false];
+	_Carlson_lanes _Partial;
+	_Carlson_lanes _Complete;
+	double _Kx[_Batch_lanes];
+	double _Sx[_Batch_lanes];
+	double _Cx[_Batch_lanes];
+	double _Reduced[_Batch_lanes];
+	double _Periods[_Batch_lanes];
+	double _Settled[_Batch_lanes];
+	bool _Handled[_Batch_lanes];
+	const _Carlson_state _Idle = _Carlson_start(1, 1, 1);
+	while (_First_k != _Last_k)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last_k - _First_k), _Batch_lanes);
+		size_t _Periodic = 0;
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			_Handled[_Idx] = true;
+			_Periods[_Idx] = 0;
+			if (_Idx < _Count)
+				{
+				const double _Pk = static_cast<double>(_First_k[_Idx]);
+				const double _Pphi = static_cast<double>(_First_phi[_Idx]);
+				if (_CSTD isnan(_Pk) || _CSTD isnan(_Pphi) || !(_CSTD fabs(_Pk) < 1))
+					{	// NaN, domain errors, and k = +/-1, whose periods are infinite
+					const incomplete_elliptic_integrals<double> _Result =
+						_Incomplete_elliptic<_Ty>(_Pk, 0, _Pphi, false);
+					_Settled[_Idx] = _With_second ? _Result.second_kind : _Result.first_kind;
+					}
+				else
+					{
+					const _Elliptic_amplitude _Amplitude = _Reduce_amplitude(_CSTD fabs(_Pphi));
+					const double _Rx = _CSTD fabs(_Amplitude._Reduced);
+					_Handled[_Idx] = false;
+					_Kx[_Idx] = _CSTD fabs(_Pk);
+					_Sx[_Idx] = _CSTD sin(_Rx);
+					_Cx[_Idx] = _CSTD cos(_Rx);
+					_Reduced[_Idx] = _Pphi < 0 ? -_Amplitude._Reduced : _Amplitude._Reduced;
+					_Periods[_Idx] = _Pphi < 0 ? -_Amplitude._Periods : _Amplitude._Periods;
+					_Carlson_set(_Partial, _Idx, _Elliptic_start(_Kx[_Idx], 0, _Sx[_Idx], _Cx[_Idx]));
+					}
+				}
+
+			if (_Handled[_Idx])
+				{
+				_Carlson_set(_Partial, _Idx, _Idle);
+				}
+
+			if (_Periods[_Idx] != 0)
+				{
+				_Carlson_set(_Complete, _Idx, _Elliptic_start(_Kx[_Idx], 0, 1, 0));
+				++_Periodic;
+				}
+			else
+				{
+				_Carlson_set(_Complete, _Idx, _Idle);
+				}
+			}
+
+		_Converge(_Partial);
+
+		if (_Periodic != 0)
+			{
+			_Converge(_Complete);
+			}
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			double _Value = _Settled[_Idx];
+			if (!_Handled[_Idx])
+				{
+				const incomplete_elliptic_integrals<double> _Part = _Elliptic_finish<_With_second, false>(
+					_Kx[_Idx], 0, _Sx[_Idx], _Cx[_Idx], _Carlson_get(_Partial, _Idx));
+				_Value = _With_second ? _Part.second_kind : _Part.first_kind;
+				_Value = _Reduced[_Idx] < 0 ? -_Value : _Value;
+				if (_Periods[_Idx] != 0)
+					{
+					const incomplete_elliptic_integrals<double> _Whole = _Elliptic_finish<_With_second, false>(
+						_Kx[_Idx], 0, 1, 0, _Carlson_get(_Complete, _Idx));
+					_Value += _Periods[_Idx] * (_With_second ? _Whole.second_kind : _Whole.first_kind);
+					}
+				}
+
+			_Dest[_Idx] = static_cast<_Ty>(_Value);
+			}
+
+		_First_k += _Count;
+		_First_phi += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+
+template<bool _With_second,
+	bool _With_third>
+	double * _Elliptic_plan_batch(const double _Pk, const double _Pnu,
+		const incomplete_elliptic_integrals<double>& _Complete,
+		double incomplete_elliptic_integrals<double>::* const _Kind,
+		const double * _First, const double * const _Last, double * _Dest)
+	{	// one kind of integral at fixed k and nu for blocks of _Batch_lanes amplitudes, as
+		// _Elliptic_batch but with the whole periods taken from _Complete; F needs only R_F,
+		// E adds R_D, and Pi adds R_J
+	const double _Kx = _CSTD fabs(_Pk);
+	const bool _Lanes_apply = _Kx < 1;	// otherwise NaN, a domain error, or infinite periods
+	const bool _Periodic_third = _Third_periodic(_Kx, _Pnu);
+	const auto _Whole = [&](double, bool) { return (_Complete); };
+	const auto _Converge = _Lane_kernels_in_use<double>()._Carlson_converge[_With_second][_With_third];
+	_Carlson_lanes _Lanes;
+	double _Sx[_Batch_lanes];
+	double _Cx[_Batch_lanes];
+	double _Reduced[_Batch_lanes];
+	double _Periods[_Batch_lanes];
+	double _Settled[_Batch_lanes];
+	bool _Handled[_Batch_lanes];
+	while (_First != _Last)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			_Handled[_Idx] = true;
+			if (_Idx < _Count)
+				{
+				const double _Pphi = _First[_Idx];
+				if (!_Lanes_apply || _CSTD isnan(_Pphi))
+					{
+					_Settled[_Idx] = _Incomplete_elliptic_with(_Pk, _Pnu, _Pphi, _With_third,
+						_Whole).*_Kind;
+					}
+				else
+					{
+					const _Elliptic_amplitude _Amplitude = _Reduce_amplitude(_CSTD fabs(_Pphi));
+					const double _Rx = _CSTD fabs(_Amplitude._Reduced);
+					_Sx[_Idx] = _CSTD sin(_Rx);
+					_Cx[_Idx] = _CSTD cos(_Rx);
+					_Reduced[_Idx] = _Pphi < 0 ? -_Amplitude._Reduced : _Amplitude._Reduced;
+					_Periods[_Idx] = _Pphi < 0 ? -_Amplitude._Periods : _Amplitude._Periods;
+					const double _Pp = 1 - _Pnu * _Sx[_Idx] * _Sx[_Idx];
+					if (_With_third && !(_Pp > 0 && _Carlson_in_range(_Pp)
+						&& (_Amplitude._Periods == 0 || _Periodic_third)))
+						{	// as _Incomplete_elliptic, Boost takes the rest of Pi
+						_Settled[_Idx] = _STD ellint_3(_Pk, _Pnu, _Pphi);
+						}
+					else
+						{
+						_Handled[_Idx] = false;
+						_Carlson_set(_Lanes, _Idx, _Elliptic_start(_Kx, _Pnu, _Sx[_Idx], _Cx[_Idx]));
+						}
+					}
+				}
+
+			if (_Handled[_Idx])
+				{
+				_Carlson_set(_Lanes, _Idx, _Carlson_start(1, 1, 1, 1));
+				}
+			}
+
+		_Converge(_Lanes);
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			double _Value = _Settled[_Idx];
+			if (!_Handled[_Idx])
+				{
+				_Value = _Elliptic_finish<_With_second, _With_third>(
+					_Kx, _Pnu, _Sx[_Idx], _Cx[_Idx], _Carlson_get(_Lanes, _Idx)).*_Kind;
+				_Value = _Reduced[_Idx] < 0 ? -_Value : _Value;
+				if (_Periods[_Idx] != 0)
+					{
+					_Value += _Periods[_Idx] * _Complete.*_Kind;
+					}
+				}
+
+			_Dest[_Idx] = _Value;
+			}
+
+		_First += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+
+	// The inverse of F in phi is the Jacobi amplitude am(u, k). With K = K(k), u reduces to
+	// r in [-K, K] less m periods of 2K, each of which adds pi to phi. Past K/2, the amplitude
+	// psi of K - r gives phi = atan2(cos psi, k' sin psi) [sn(K - u) = cd(u), DLMF 22.4.3], so
+	// Newton only solves F(psi) = w for w in [0, K/2], where 1 - k^2 sin^2 psi >= k'. The start
+	// blends the k = 0 and k = 1 solutions, w and gd(w) = atan(sinh w), and each step
+	// psi -= (F(psi) - w) sqrt(1 - k^2 sin^2 psi) uses the closed-form derivative of F.
+constexpr int _Amplitude_iterations = 10;
+constexpr double _Amplitude_agreement = 0x1p-30;	// quadratic convergence takes a step this
+													// small to full precision
+
+struct _Amplitude_target
+	{	// am(u) = _Periods pi +/- psi, or the complement of psi, where F(psi) = _Target
+	double _Target;
+	double _Periods;
+	bool _Negate;
+	bool _Reflect;
+	};
+
+double _Amplitude_special(const double _Pk, const double _Pu, bool& _Handled)
+	{	// settle NaN, domain errors, k = +/-1, and infinite u; clear _Handled for the rest
+	_Handled = true;
+	if (_CSTD isnan(_Pk) || _CSTD isnan(_Pu))
+		{
+		return (_Pk + _Pu);
+		}
+
+	const double _Kx = _CSTD fabs(_Pk);
+	if (_Kx > 1)
+		{
+		errno = EDOM;
+		return (numeric_limits<double>::quiet_NaN());
+		}
+	else if (_Kx == 1)
+		{	// F(1, phi) = gd^-1(phi)
+		return (_CSTD atan(_CSTD sinh(_Pu)));
+		}
+	else if (_CSTD isinf(_Pu))
+		{
+		return (_Pu);
+		}
+
+	_Handled = false;
+	return (0);
+	}
+
+double _Quarter_period(const double _Kx)
+	{	// K(k) = R_F(0, k'^2, 1), from _Elliptic_finish at s = 1, c = 0 with R_F alone
+	return (_Elliptic_finish<false, false>(_Kx, 0, 1, 0,
+		_Carlson_converge<false, false>(_Elliptic_start(_Kx, 0, 1, 0))).first_kind);
+	}
+
+_Amplitude_target _Amplitude_reduce(const double _Quarter, const double _Pu)
+	{
+	const double _Mx = _CSTD nearbyint(_Pu / (2 * _Quarter));
+	double _Rx = _CSTD fma(-_Mx, 2 * _Quarter, _Pu);
+	const bool _Negate = _Rx < 0;
+	_Rx = _STD min(_CSTD fabs(_Rx), _Quarter);
+	const bool _Reflect = _Rx > _Quarter / 2;
+	return {_Reflect ? _Quarter - _Rx : _Rx, _Mx, _Negate, _Reflect};
+	}
+
+double _Amplitude_start(const double _Kx, const double _Target)
+	{
+	return (_Target + _Kx * _Kx * (_CSTD atan(_CSTD sinh(_Target)) - _Target));
+	}
+
+double _Amplitude_update(const double _Kx, const double _Target, const double _Psi,
+	const double _Sx, const double _Cx, const _Carlson_state& _State)
+	{	// one Newton step from _Psi, given the converged _Elliptic_start(_Kx, 0, sin psi, cos psi)
+	const double _Kc = (1 - _Kx) * (1 + _Kx);
+	const double _Fx = _Elliptic_finish<false, false>(_Kx, 0, _Sx, _Cx, _State).first_kind;
+	const double _Next = _Psi - (_Fx - _Target) * _CSTD sqrt(_Cx * _Cx + _Kc * _Sx * _Sx);
+	return (_STD max(0.0, _STD min(_Next, _Elliptic_pi._Hi / 2)));
+	}
+
+bool _Amplitude_live(const double _Psi, const double _Next)
+	{
+	return (_CSTD fabs(_Next - _Psi) > _Amplitude_agreement * _Psi);
+	}
+
+double _Amplitude_finish(const _Amplitude_target& _Where, const double _Kx, const double _Psi)
+	{
+	const double _Kc = (1 - _Kx) * (1 + _Kx);
+	double _Phi = _Where._Reflect
+		? _CSTD atan2(_CSTD cos(_Psi), _CSTD sqrt(_Kc) * _CSTD sin(_Psi)) : _Psi;
+	_Phi = _Where._Negate ? -_Phi : _Phi;
+	return (_Where._Periods == 0 ? _Phi
+		: _CSTD fma(_Where._Periods, _Elliptic_pi._Hi, _Where._Periods * _Elliptic_pi._Lo + _Phi));
+	}
+
+double _Amplitude_regular(const double _Kx, const double _Quarter, const double _Pu)
+	{	// am(u, k) for |k| < 1 and finite u, given K(k)
+	const _Amplitude_target _Where = _Amplitude_reduce(_Quarter, _Pu);
+	double _Psi = _Amplitude_start(_Kx, _Where._Target);
+	for (int _Iter = 0; _Iter < _Amplitude_iterations; ++_Iter)
+		{
+		const double _Sx = _CSTD sin(_Psi);
+		const double _Cx = _CSTD cos(_Psi);
+		const double _Next = _Amplitude_update(_Kx, _Where._Target, _Psi, _Sx, _Cx,
+			_Carlson_converge<false, false>(_Elliptic_start(_Kx, 0, _Sx, _Cx)));
+		const bool _Live = _Amplitude_live(_Psi, _Next);
+		_Psi = _Next;
+		if (!_Live)
+			{
+			break;
+			}
+		}
+
+	return (_Amplitude_finish(_Where, _Kx, _Psi));
+	}
+
+double _Jacobi_amplitude(const double _Pk, const double _Pu)
+	{
+	bool _Handled;
+	const double _Special = _Amplitude_special(_Pk, _Pu, _Handled);
+	if (_Handled)
+		{
+		return (_Special);
+		}
+
+	const double _Kx = _CSTD fabs(_Pk);
+	return (_Amplitude_regular(_Kx, _Quarter_period(_Kx), _Pu));
+	}
+
+template<class _Ty> inline
+	_Ty * _Amplitude_batch(const _Ty * _First_u, const _Ty * const _Last_u, const _Ty * _First_k,
+		const double _Plan_k, const double _Plan_quarter, _Ty * _Dest)
+	{	// am(u, k) over blocks of _Batch_lanes arguments at once; _First_k is null for a plan,
+		// whose modulus _Plan_k and K(k) _Plan_quarter every lane shares. Otherwise one pass of
+		// the lanes finds each K(k) first. Each Newton step then runs the duplication in every
+		// lane still moving, with the rest idle at (1, 1, 1).
+	const auto _Converge = _Lane_kernels_in_use<double>()._Carlson_converge[false][false];
+	_Carlson_lanes _Lanes;
+	double _Kx[_Batch_lanes];
+	double _Quarter[_Batch_lanes];
+	double _Psi[_Batch_lanes];
+	double _Sx[_Batch_lanes];
+	double _Cx[_Batch_lanes];
+	double _Settled[_Batch_lanes];
+	_Amplitude_target _Where[_Batch_lanes];
+	bool _Handled[_Batch_lanes];
+	bool _Live[_Batch_lanes];
+	const _Carlson_state _Idle = _Carlson_start(1, 1, 1);
+	while (_First_u != _Last_u)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last_u - _First_u), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			_Handled[_Idx] = true;
+			if (_Idx < _Count)
+				{
+				const double _Pk = _First_k ? static_cast<double>(_First_k[_Idx]) : _Plan_k;
+				_Settled[_Idx] = _Amplitude_special(_Pk, static_cast<double>(_First_u[_Idx]),
+					_Handled[_Idx]);
+				_Kx[_Idx] = _CSTD fabs(_Pk);
+				_Quarter[_Idx] = _Plan_quarter;
+				}
+
+			_Carlson_set(_Lanes, _Idx, _Handled[_Idx] || !_First_k ? _Idle : _Elliptic_start(_Kx[_Idx], 0, 1, 0));
+			}
+
+		if (_First_k)
+			{
+			_Converge(_Lanes);
+
+			for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+				{
+				if (!_Handled[_Idx])
+					{
+					_Quarter[_Idx] = _Elliptic_finish<false, false>(_Kx[_Idx], 0, 1, 0,
+						_Carlson_get(_Lanes, _Idx)).first_kind;
+					}
+				}
+			}
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			_Live[_Idx] = !_Handled[_Idx];
+			if (_Live[_Idx])
+				{
+				_Where[_Idx] = _Amplitude_reduce(_Quarter[_Idx], static_cast<double>(_First_u[_Idx]));
+				_Psi[_Idx] = _Amplitude_start(_Kx[_Idx], _Where[_Idx]._Target);
+				}
+			}
+
+		for (int _Iter = 0; _Iter < _Amplitude_iterations; ++_Iter)
+			{
+			size_t _Moving = 0;
+			for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+				{
+				if (_Idx < _Count && _Live[_Idx])
+					{
+					_Sx[_Idx] = _CSTD sin(_Psi[_Idx]);
+					_Cx[_Idx] = _CSTD cos(_Psi[_Idx]);
+					_Carlson_set(_Lanes, _Idx, _Elliptic_start(_Kx[_Idx], 0, _Sx[_Idx], _Cx[_Idx]));
+					++_Moving;
+					}
+				else
+					{
+					_Carlson_set(_Lanes, _Idx, _Idle);
+					}
+				}
+
+			if (_Moving == 0)
+				{
+				break;
+				}
+
+			_Converge(_Lanes);
+
+			for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+				{
+				if (_Live[_Idx])
+					{
+					const double _Next = _Amplitude_update(_Kx[_Idx], _Where[_Idx]._Target, _Psi[_Idx],
+						_Sx[_Idx], _Cx[_Idx], _Carlson_get(_Lanes, _Idx));
+					_Live[_Idx] = _Amplitude_live(_Psi[_Idx], _Next);
+					_Psi[_Idx] = _Next;
+					}
+				}
+			}
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			_Dest[_Idx] = static_cast<_Ty>(_Handled[_Idx]
+				? _Settled[_Idx] : _Amplitude_finish(_Where[_Idx], _Kx[_Idx], _Psi[_Idx]));
+			}
+
+		_First_u += _Count;
+		_First_k = _First_k ? _First_k + _Count : _First_k;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+} // unnamed namespace
+
+double ellint_1(const double _Pk, const double _Pphi)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::ellint_1(_Args...); },
+		_Pk, _Pphi));
+	}
+
+float ellint_1f(const float _Pk, const float _Pphi)
+	{
+	return (static_cast<float>(_Elliptic_first_kind<float>(_Pk, _Pphi)));
+	}
+
+double ellint_2(const double _Pk, const double _Pphi)
+	{
+	if (_CSTD fabs(_Pk) == 1 && _CSTD fabs(_Pphi) > 0x1.921fb54442d18p+0)
+		{	// E(1, phi) = 2n + sin r for phi = n pi + r, rising with phi as in the float, batch,
+			// and ellint_1_2_3 forms, where Boost gives sin phi
+		return (_Incomplete_elliptic(_Pk, 0, _Pphi, false).second_kind);
+		}
+
+	return (_Boost_call([](auto... _Args) { return boost::math::ellint_2(_Args...); },
+		_Pk, _Pphi));
+	}
+
+float ellint_2f(const float _Pk, const float _Pphi)
+	{
+	return (static_cast<float>(_Incomplete_elliptic<float>(_Pk, 0, _Pphi, false).second_kind));
+	}
+
+double ellint_3(const double _Pk, const double _Pnu, const double _Pphi)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::ellint_3(_Args...); },
+		_Pk, _Pnu, _Pphi));
+	}
+
+float ellint_3f(const float _Pk, const float _Pnu, const float _Pphi)
+	{
+	return (static_cast<float>(_Incomplete_elliptic<float>(_Pk, _Pnu, _Pphi).third_kind));
+	}
+
+incomplete_elliptic_integrals<double> ellint_1_2_3(const double _Pk, const double _Pnu, const double _Pphi)
+	{
+	return (_Incomplete_elliptic(_Pk, _Pnu, _Pphi));
+	}
+
+incomplete_elliptic_integrals<float> ellint_1_2_3(const float _Pk, const float _Pnu, const float _Pphi)
+	{
+	const auto _Result = _Incomplete_elliptic<float>(_Pk, _Pnu, _Pphi);
+	return {static_cast<float>(_Result.first_kind), static_cast<float>(_Result.second_kind),
+		static_cast<float>(_Result.third_kind)};
+	}
+
+double * ellint_1_batch(const double * const _First_k, const double * const _Last_k,
+	const double * const _First_phi, double * const _Dest)
+	{
+	return (_Elliptic_batch<false>(_First_k, _Last_k, _First_phi, _Dest));
+	}
+
+float * ellint_1_batch(const float * const _First_k, const float * const _Last_k,
+	const float * const _First_phi, float * const _Dest)
+	{
+	return (_Elliptic_batch<false>(_First_k, _Last_k, _First_phi, _Dest));
+	}
+
+long double * ellint_1_batch(const long double * const _First_k, const long double * const _Last_k,
+	const long double * const _First_phi, long double * const _Dest)
+	{
+	return (_Elliptic_batch<false>(_First_k, _Last_k, _First_phi, _Dest));
+	}
+
+double ellint_1_inverse(const double _Pk, const double _Pu)
+	{
+	return (_Jacobi_amplitude(_Pk, _Pu));
+	}
+
+float ellint_1_inverse(const float _Pk, const float _Pu)
+	{
+	return (static_cast<float>(_Jacobi_amplitude(_Pk, _Pu)));
+	}
+
+double * ellint_1_inverse_batch(const double * const _First_k, const double * const _Last_k,
+	const double * const _First_u, double * const _Dest)
+	{
+	return (_Amplitude_batch(_First_u, _First_u + (_Last_k - _First_k), _First_k, 0.0, 0.0, _Dest));
+	}
+
+float * ellint_1_inverse_batch(const float * const _First_k, const float * const _Last_k,
+	const float * const _First_u, float * const _Dest)
+	{
+	return (_Amplitude_batch(_First_u, _First_u + (_Last_k - _First_k), _First_k, 0.0, 0.0, _Dest));
+	}
+
+long double * ellint_1_inverse_batch(const long double * const _First_k, const long double * const _Last_k,
+	const long double * const _First_u, long double * const _Dest)
+	{
+	return (_Amplitude_batch(_First_u, _First_u + (_Last_k - _First_k), _First_k, 0.0, 0.0, _Dest));
+	}
+
+double * ellint_2_batch(const double * const _First_k, const double * const _Last_k,
+	const double * const _First_phi, double * const _Dest)
+	{
+	return (_Elliptic_batch<true>(_First_k, _Last_k, _First_phi, _Dest));
+	}
+
+float * ellint_2_batch(const float * const _First_k, const float * const _Last_k,
+	const float * const _First_phi, float * const _Dest)
+	{
+	return (_Elliptic_batch<true>(_First_k, _Last_k, _First_phi, _Dest));
+	}
+
+long double * ellint_2_batch(const long double * const _First_k, const long double * const _Last_k,
+	const long double * const _First_phi, long double * const _Dest)
+	{
+	return (_Elliptic_batch<true>(_First_k, _Last_k, _First_phi, _Dest));
+	}
+
+elliptic_plan::elliptic_plan(const double _Pk, const double _Pnu)
+	: _Modulus(_Pk), _Characteristic(_Pnu),
+		_Complete{numeric_limits<double>::quiet_NaN(), numeric_limits<double>::quiet_NaN(),
+			numeric_limits<double>::quiet_NaN()}
+	{	// a NaN or out-of-domain k leaves the complete integrals NaN; each evaluation then
+		// reports it as ellint_1_2_3 would
+	const double _Kx = _CSTD fabs(_Pk);
+	if (_Kx <= 1)
+		{
+		_Complete = _Complete_carlson(_Kx, _Pnu, _Third_periodic(_Kx, _Pnu));
+		}
+	}
+
+incomplete_elliptic_integrals<double> elliptic_plan::operator()(const double _Amplitude) const
+	{
+	return (_Incomplete_elliptic_with(_Modulus, _Characteristic, _Amplitude, true,
+		[this](double, bool) { return (_Complete); }));
+	}
+
+double elliptic_plan::amplitude(const double _Value) const
+	{
+	bool _Handled;
+	const double _Special = _Amplitude_special(_Modulus, _Value, _Handled);
+	return (_Handled ? _Special : _Amplitude_regular(_CSTD fabs(_Modulus), _Complete.first_kind, _Value));
+	}
+
+double * elliptic_plan::amplitude(const double * const _First, const double * const _Last,
+	double * const _Dest) const
+	{
+	return (_Amplitude_batch(_First, _Last, static_cast<const double *>(nullptr), _Modulus,
+		_Complete.first_kind, _Dest));
+	}
+
+double * elliptic_plan::first_kind(const double * const _First, const double * const _Last,
+	double * const _Dest) const
+	{
+	return (_Elliptic_plan_batch<false, false>(_Modulus, _Characteristic, _Complete,
+		&incomplete_elliptic_integrals<double>::first_kind, _First, _Last, _Dest));
+	}
+
+double * elliptic_plan::second_kind(const double * const _First, const double * const _Last,
+	double * const _Dest) const
+	{
+	return (_Elliptic_plan_batch<true, false>(_Modulus, _Characteristic, _Complete,
+		&incomplete_elliptic_integrals<double>::second_kind, _First, _Last, _Dest));
+	}
+
+double * elliptic_plan::third_kind(const double * const _First, const double * const _Last,
+	double * const _Dest) const
+	{
+	return (_Elliptic_plan_batch<false, true>(_Modulus, _Characteristic, _Complete,
+		&incomplete_elliptic_integrals<double>::third_kind, _First, _Last, _Dest));
+	}
+namespace {
+template<class _Ty,
+	class _Lane_ty> inline
+	_Ty * _Expint_batch(const _Ty * _First, const _Ty * const _Last, _Ty * _Dest,
+		_Lane_ty (* const _Scalar_fn)(_Lane_ty), const bool _Scaled)
+	{	// Ei(x), or e^-x Ei(x) if _Scaled, for each x in [_First, _Last), _Batch_lanes at a
+		// time in _Lane_ty arithmetic: a scalar pass gathers [-1 / 2, 6] for the logarithmic
+		// forms and the rest for the exponential ones, each then run across its own lanes;
+		// zero, NaN, subnormals, and arguments past _Lowest or _Highest, or for e^-x Ei(x)
+		// past 4 / epsilon, where it is 1 / x, go to _Scalar_fn
+	using _Rational = _Expint_rational<_Lane_ty>;
+	constexpr _Lane_ty _Reach = 4 / numeric_limits<_Lane_ty>::epsilon();
+	const _Lane_ty _Lowest = _Scaled ? -_Reach : _Rational::_Lowest;
+	const _Lane_ty _Highest = _Scaled ? _Reach : _Rational::_Highest;
+	const _Lane_kernels<_Lane_ty>& _Kernels = _Lane_table_in_use();
+	_Lane_ty _Log_args[_Batch_lanes];
+	_Lane_ty _Exp_args[_Batch_lanes];
+	size_t _Log_slot[_Batch_lanes];
+	size_t _Exp_slot[_Batch_lanes];
+	size_t _Scalar_slot[_Batch_lanes];
+	while (_First != _Last)
+		{	// every argument is written to all three lists and counted in one, so that the
+			// gathering does not branch on mixed regions either
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		size_t _Log_count = 0;
+		size_t _Exp_count = 0;
+		size_t _Scalar_count = 0;
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			const _Lane_ty _Px = static_cast<_Lane_ty>(_First[_Idx]);
+			const bool _Lanes = (_Lowest <= _Px) & (_Px <= _Highest)
+				& (numeric_limits<_Lane_ty>::min() <= _CSTD fabs(_Px));
+			const bool _Log_form = _Lanes & (static_cast<_Lane_ty>(-0.5) <= _Px) & (_Px <= 6);
+			_Log_slot[_Log_count] = _Idx;
+			_Log_args[_Log_count] = _Px;
+			_Log_count += _Log_form;
+			_Exp_slot[_Exp_count] = _Idx;
+			_Exp_args[_Exp_count] = _Px;
+			_Exp_count += _Lanes & !_Log_form;
+			_Scalar_slot[_Scalar_count] = _Idx;
+			_Scalar_count += !_Lanes;
+			}
+
+		_Kernels._Expint_log(_Log_args, _Log_args, _Log_count, _Scaled);
+		for (size_t _Lane = 0; _Lane < _Log_count; ++_Lane)
+			{
+			_Dest[_Log_slot[_Lane]] = static_cast<_Ty>(_Log_args[_Lane]);
+			}
+
+		_Kernels._Expint_exp(_Exp_args, _Exp_args, _Exp_count, _Scaled);
+		for (size_t _Lane = 0; _Lane < _Exp_count; ++_Lane)
+			{
+			_Dest[_Exp_slot[_Lane]] = static_cast<_Ty>(_Exp_args[_Lane]);
+			}
+
+		for (size_t _Lane = 0; _Lane < _Scalar_count; ++_Lane)
+			{
+			const size_t _Idx = _Scalar_slot[_Lane];
+			_Dest[_Idx] = static_cast<_Ty>(_Scalar_fn(static_cast<_Lane_ty>(_First[_Idx])));
+			}
+
+		_First += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+
+struct _Expint_float_fits
+	{	// the regions and forms of _Expint_rational<float>, fitted again to a few hundredths
+		// of a float ulp for expintf, which evaluates them in double; the float lanes keep
+		// their own, since these lose more than they gain in float arithmetic
+	static constexpr size_t _Log_degree = 5;
+	static constexpr double _Log_coeff[] =
+		{	// P then Q, lowest order first, for [-1 / 2, 0) then (0, 6]
+		1.000000000001683986284e+00, -1.215329491577138709690e-01, 1.554866195695402825150e-02,
+		5.847236063775536839791e-05, 0.0, 0.0,
+		1.000000000000000000000e+00, -3.715329492296411406649e-01, 5.287634260008591130520e-02,
+		-2.936569016985493725536e-03, 0.0, 0.0,
+		2.986772243847625851743e+00, 1.106453488835029835835e-01, 6.502375682777273846469e-01,
+		4.238045608402586650332e-02, 1.904642332427768786074e-02, 1.067838991631203356472e-03,
+		1.000000000000000000000e+00, -1.253166261925968250068e+00, 6.845610219242418414964e-01,
+		-2.052393328268905803302e-01, 3.404454828643251745879e-02, -2.521087663803642242577e-03,
+		};
+
+	static constexpr size_t _Exp_degree = 6;
+	static constexpr double _Exp_coeff[] =
+		{	// P then Q, lowest order first, for x < -1 / 2, (6, 22], then 22 < x
+		9.999999997932327300276e-01, -1.431536338808641417586e+01, 6.376096823405394076190e+01,
+		-1.045311281399771701217e+02, 5.883425127444588298431e+01, -8.463004958264242816313e+00,
+		7.491222192535457180540e-02,
+		1.000000000000000000000e+00, -1.531536321276026413329e+01, 7.707635558805309017316e+01,
+		-1.569754366459078198659e+02, 1.295895054214478250287e+02, -3.814860905206075614160e+01,
+		2.756201135850205652389e+00,
+		1.000006961727368803849e+00, -2.400787660813512047753e+01, 3.499798309558109394857e+02,
+		-2.602126661853798850643e+03, 1.363030008023189475352e+04, -3.473792278749962861184e+04,
+		8.075531755989382509142e+04,
+		1.000000000000000000000e+00, -2.500476794164082505745e+01, 3.726802446795040850702e+02,
+		-2.917142452075569053704e+03, 1.559739953057694583549e+04, -4.187051502844144124538e+04,
+		7.414140425962735025678e+04,
+		1.048872698550934678963e+00, -1.440669740632469775221e+00, 5.496897869819091786425e-01,
+		-5.437978895174511162480e-02, 4.023661733943687175176e-04, 0.0,
+		0.0,
+		1.000000000000000000000e+00, -1.423741022865538052855e+00, 5.915496167911941105544e-01,
+		-7.630029557785970861783e-02, 2.423413526415471672820e-03, 0.0,
+		0.0,
+		};
+	};
+
+template<class _Lane_ty>
+	_Lane_ty _Expint_n_scalar(const unsigned _Pn, const _Lane_ty _Px)
+	{	// E_n(x) for the arguments the lanes leave out, with the limits at 0 and infinity
+		// settled ahead of Boost
+	if (_CSTD isnan(_Px))
+		{
+		return (_Px);
+		}
+
+	if (_Px == 0)
+		{
+		return (_Pn <= 1 ? numeric_limits<_Lane_ty>::infinity()
+			: 1 / static_cast<_Lane_ty>(_Pn - 1));
+		}
+
+	if (_Px == numeric_limits<_Lane_ty>::infinity())
+		{
+		return (0);
+		}
+
+	return (_Boost_call([](auto... _Args) { return boost::math::expint(_Args...); },
+		_Pn, _Px));
+	}
+
+template<class _Ty,
+	class _Lane_ty> inline
+	_Ty * _Expint_n_batch(const unsigned _Pn, const _Ty * _First, const _Ty * const _Last,
+		_Ty * _Dest)
+	{	// E_n(x) for each x in [_First, _Last), _Batch_lanes at a time in _Lane_ty arithmetic:
+		// the series takes (0, 1) and the continued fraction, with one vector exponential,
+		// the rest up to -_Lowest; zero, negatives, NaN, subnormals, and larger arguments go
+		// to _Expint_n_scalar
+	using _Rational = _Expint_rational<_Lane_ty>;
+	const _Lane_kernels<_Lane_ty>& _Kernels = _Lane_table_in_use();
+	_Lane_ty _Series_args[_Batch_lanes];
+	_Lane_ty _Fraction_args[_Batch_lanes];
+	_Lane_ty _Fraction[_Batch_lanes];
+	size_t _Series_slot[_Batch_lanes];
+	size_t _Fraction_slot[_Batch_lanes];
+	size_t _Scalar_slot[_Batch_lanes];
+	while (_First != _Last)
+		{	// gathered as in _Expint_batch
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		size_t _Series_count = 0;
+		size_t _Fraction_count = 0;
+		size_t _Scalar_count = 0;
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			const _Lane_ty _Px = static_cast<_Lane_ty>(_First[_Idx]);
+			const bool _Lanes = (numeric_limits<_Lane_ty>::min() <= _Px)
+				& (_Px <= -_Rational::_Lowest);
+			const bool _Series = _Lanes & (_Px < 1) & (_Pn != 0);
+			_Series_slot[_Series_count] = _Idx;
+			_Series_args[_Series_count] = _Px;
+			_Series_count += _Series;
+			_Fraction_slot[_Fraction_count] = _Idx;
+			_Fraction_args[_Fraction_count] = _Px;
+			_Fraction_count += _Lanes & !_Series;
+			_Scalar_slot[_Scalar_count] = _Idx;
+			_Scalar_count += !_Lanes;
+			}
+
+		_Kernels._Expint_n_series(_Pn, _Series_args, _Series_args, _Series_count);
+		for (size_t _Lane = 0; _Lane < _Series_count; ++_Lane)
+			{
+			_Dest[_Series_slot[_Lane]] = static_cast<_Ty>(_Series_args[_Lane]);
+			}
+
+		_Kernels._Expint_n_fraction(_Pn, _Fraction_args, _Fraction, _Fraction_count);
+		for (size_t _Lane = 0; _Lane < _Fraction_count; ++_Lane)
+			{
+			_Fraction_args[_Lane] = -_Fraction_args[_Lane];
+			}
+
+		_Kernels._Exp(_Fraction_args, _Fraction_args, _Fraction_count);
+		for (size_t _Lane = 0; _Lane < _Fraction_count; ++_Lane)
+			{
+			_Dest[_Fraction_slot[_Lane]] = static_cast<_Ty>(_Fraction_args[_Lane] * _Fraction[_Lane]);
+			}
+
+		for (size_t _Lane = 0; _Lane < _Scalar_count; ++_Lane)
+			{
+			const size_t _Idx = _Scalar_slot[_Lane];
+			_Dest[_Idx] = static_cast<_Ty>(_Expint_n_scalar(_Pn, static_cast<_Lane_ty>(_First[_Idx])));
+			}
+
+		_First += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+
+template<class _Ty,
+	class _Lane_ty> inline
+	_Ty * _Expint_n_sequence(const unsigned _Max_order, const _Ty _Value, _Ty * const _Dest)
+	{	// E_1(x), ..., E_N(x) from E_m(x) at a single m, recurring with
+		//	E_(n+1)(x) = (e^-x - x E_n(x)) / n
+		// upward from m for n >= x and downward for n < x, the stable direction of each; for
+		// x >= 1, m = min(N, floor(x)) and the recurrence runs on e^x E_n(x), so that one
+		// e^-x at the end serves the whole sequence
+	using _Rational = _Expint_rational<_Lane_ty>;
+	const _Lane_ty _Px = static_cast<_Lane_ty>(_Value);
+	if (!(numeric_limits<_Lane_ty>::min() <= _Px && _Px <= -_Rational::_Lowest))
+		{	// as for _Expint_n_batch
+		for (unsigned _Nx = 1; _Nx <= _Max_order; ++_Nx)
+			{
+			_Dest[_Nx - 1] = static_cast<_Ty>(_Expint_n_scalar(_Nx, _Px));
+			}
+
+		return (_Dest + _Max_order);
+		}
+
+	if (_Max_order == 0)
+		{
+		return (_Dest);
+		}
+
+	unsigned _Anchor = 1;
+	_Lane_ty _Unit = 1;	// e^-x, or 1 for e^x E_n(x)
+	_Lane_ty _Anchor_value;
+	if (_Px < 1)
+		{
+		_Unit = _CSTD exp(-_Px);
+		_Expint_n_series_lanes(1, &_Px, &_Anchor_value, 1);
+		}
+	else
+		{
+		_Anchor = _STD min(_Max_order, static_cast<unsigned>(_Px));
+		_Expint_n_fraction_lanes(_Anchor, &_Px, &_Anchor_value, 1);
+		}
+
+	// each direction damps what it is given, so the rounding of 1 / x and 1 / n costs
+	// less than a division on every step would
+	const _Lane_ty _Inverse = 1 / _Px;
+	_Lane_ty _En = _Anchor_value;
+	_Dest[_Anchor - 1] = static_cast<_Ty>(_En);
+	for (unsigned _Nx = _Anchor; 1 < _Nx; --_Nx)
+		{
+		_En = (_Unit - static_cast<_Lane_ty>(_Nx - 1) * _En) * _Inverse;
+		_Dest[_Nx - 2] = static_cast<_Ty>(_En);
+		}
+
+	_En = _Anchor_value;
+	for (unsigned _Nx = _Anchor; _Nx < _Max_order; ++_Nx)
+		{
+		_En = (_Unit - _Px * _En) * (1 / static_cast<_Lane_ty>(_Nx));
+		_Dest[_Nx] = static_cast<_Ty>(_En);
+		}
+
+	if (1 <= _Px)
+		{
+		const _Lane_ty _Factor = _CSTD exp(-_Px);
+		for (unsigned _Nx = 0; _Nx < _Max_order; ++_Nx)
+			{
+			_Dest[_Nx] = static_cast<_Ty>(_Factor * static_cast<_Lane_ty>(_Dest[_Nx]));
+			}
+		}
+
+	return (_Dest + _Max_order);
+	}
+} // unnamed namespace
+
+double expint(const double _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::expint(_Args...); },
+		_Px));
+	}
+
+float expintf(const float _Px)
+	{	// the batch's float regions in double arithmetic, so that only the final rounding
+		// is seen; zero, NaN, and arguments past the float lanes' reach go to Boost
+	using _Rational = _Expint_float_fits;
+	if (!(_Expint_rational<float>::_Lowest <= _Px && _Px <= _Expint_rational<float>::_Highest)
+		|| _Px == 0)
+		{
+		return (_Boost_call([](auto... _Args) { return boost::math::expint(_Args...); },
+			_Px));
+		}
+
+	const double _Wx = _Px;
+	if (_Wx < -0.5)
+		{
+		return (static_cast<float>(_CSTD exp(_Wx) / _Wx
+			* _Rational_fit(_Rational::_Exp_coeff, _Rational::_Exp_degree, 0, 1 / _Wx)));
+		}
+
+	if (_Wx < 0)
+		{
+		return (static_cast<float>(_CSTD log(-_Wx) + _Euler_gamma
+			+ _Wx * _Rational_fit(_Rational::_Log_coeff, _Rational::_Log_degree, 0, _Wx)));
+		}
+
+	if (_Wx <= 6)
+		{	// log(x / x0) as log1p near the root, where Ei keeps its relative accuracy
+		const double _Offset = (_Wx - _Expint_root_hi) - _Expint_root_lo;
+		const double _Ratio = _Offset * _Expint_root_inverse_hi;
+		const double _Log = _CSTD fabs(_Ratio) <= 0.5
+			? _CSTD log1p(_Ratio) : _CSTD log(_Wx * _Expint_root_inverse_hi);
+		return (static_cast<float>(_Log + _Offset
+			* _Rational_fit(_Rational::_Log_coeff, _Rational::_Log_degree, 1, _Wx / 3 - 1)));
+		}
+
+	const double _Inverse = 1 / _Wx;
+	const double _Leading = _CSTD exp(_Wx) * _Inverse;
+	if (_Wx <= 22)
+		{
+		return (static_cast<float>(_Leading
+			* _Rational_fit(_Rational::_Exp_coeff, _Rational::_Exp_degree, 1, _Inverse)));
+		}
+
+	return (static_cast<float>(_Leading * (1 + _Inverse
+		* _Rational_fit(_Rational::_Exp_coeff, _Rational::_Exp_degree, 2, 44 * _Inverse - 1))));
+	}
+
+double * expint_batch(const double * const _First, const double * const _Last,
+	double * const _Dest)
+	{
+	return (_Expint_batch<double, double>(_First, _Last, _Dest, &expint, false));
+	}
+
+float * expint_batch(const float * const _First, const float * const _Last,
+	float * const _Dest)
+	{
+	return (_Expint_batch<float, float>(_First, _Last, _Dest, &expintf, false));
+	}
+
+long double * expint_batch(const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Expint_batch<long double, double>(_First, _Last, _Dest, &expint, false));
+	}
+
+double expint_scaled(const double _Px)
+	{
+	if (_CSTD isnan(_Px))
+		{
+		return (_Px);
+		}
+
+	if (4 / numeric_limits<double>::epsilon() < _CSTD fabs(_Px))
+		{	// e^-x Ei(x) = (1 + 1 / x + ...) / x, and 1 / x no longer registers
+		return (1 / _Px);
+		}
+
+	if (_CSTD fabs(_Px) <= _Expint_rational<double>::_Highest)
+		{
+		return (_CSTD exp(-_Px) * _STD expint(_Px));
+		}
+
+	double _Result;
+	_Expint_exp_lanes(&_Px, &_Result, 1, true);
+	return (_Result);
+	}
+
+float expint_scaledf(const float _Px)
+	{
+	return (static_cast<float>(_STD expint_scaled(static_cast<double>(_Px))));
+	}
+
+double * expint_scaled_batch(const double * const _First, const double * const _Last,
+	double * const _Dest)
+	{
+	return (_Expint_batch<double, double>(_First, _Last, _Dest, &expint_scaled, true));
+	}
+
+float * expint_scaled_batch(const float * const _First, const float * const _Last,
+	float * const _Dest)
+	{
+	return (_Expint_batch<float, float>(_First, _Last, _Dest, &expint_scaledf, true));
+	}
+
+long double * expint_scaled_batch(const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Expint_batch<long double, double>(_First, _Last, _Dest, &expint_scaled, true));
+	}
+
+double * expint_n_sequence(const unsigned _Max_order, const double _Px, double * const _Dest)
+	{
+	return (_Expint_n_sequence<double, double>(_Max_order, _Px, _Dest));
+	}
+
+float * expint_n_sequence(const unsigned _Max_order, const float _Px, float * const _Dest)
+	{
+	return (_Expint_n_sequence<float, float>(_Max_order, _Px, _Dest));
+	}
+
+long double * expint_n_sequence(const unsigned _Max_order, const long double _Px,
+	long double * const _Dest)
+	{
+	return (_Expint_n_sequence<long double, double>(_Max_order, _Px, _Dest));
+	}
+
+double * expint_n_batch(const unsigned _Pn, const double * const _First,
+	const double * const _Last, double * const _Dest)
+	{
+	return (_Expint_n_batch<double, double>(_Pn, _First, _Last, _Dest));
+	}
+
+float * expint_n_batch(const unsigned _Pn, const float * const _First,
+	const float * const _Last, float * const _Dest)
+	{
+	return (_Expint_n_batch<float, float>(_Pn, _First, _Last, _Dest));
+	}
+
+long double * expint_n_batch(const unsigned _Pn, const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Expint_n_batch<long double, double>(_Pn, _First, _Last, _Dest));
+	}
+
+namespace {
+struct _Rule_storage
+	{	// backing store for a quadrature_rule
+	vector<double> _Nodes;
+	vector<double> _Weights;
+
+	explicit _Rule_storage(const unsigned _Points)
+		: _Nodes(_Points), _Weights(_Points)
+		{
+		}
+
+	quadrature_rule _View() const
+		{
+		return {_Nodes.data(), _Weights.data(), _Nodes.size()};
+		}
+	};
+
+template<class _Key>
+	class _Rule_cache
+	{	// process-wide rules; entries are never erased, so handed-out views stay valid
+public:
+	template<class _Generator>
+		quadrature_rule _Get(const _Key& _Kx, _Generator _Gen)
+		{
+			{
+			lock_guard<mutex> _Lock(_Mtx);
+			const auto _Where = _Rules.find(_Kx);
+			if (_Where != _Rules.end())
+				{
+				return (_Where->second._View());
+				}
+			}
+
+		_Rule_storage _New = _Gen();	// generate outside the lock; large rules take a while
+
+		lock_guard<mutex> _Lock(_Mtx);	// if another thread got here first, keep its rule
+		return (_Rules.emplace(_Kx, _STD move(_New)).first->second._View());
+		}
+
+private:
+	mutex _Mtx;
+	map<_Key, _Rule_storage> _Rules;
+	};
+
+constexpr unsigned _Gauss_legendre_asymptotic_min = 101;
+
+constexpr double _Bessel_j0_zeros[] =
+	{	// j_{0,k}, k = 1, ..., 20
+	2.404825557695772768622e+00, 5.520078110286310649597e+00, 8.653727912911012216954e+00,
+	1.179153443901428161374e+01, 1.493091770848778594776e+01, 1.807106396791092254315e+01,
+	2.121163662987925895908e+01, 2.435247153074930273706e+01, 2.749347913204025479588e+01,
+	3.063460646843197511755e+01, 3.377582021357356868424e+01, 3.691709835366404397977e+01,
+	4.005842576462823929480e+01, 4.319979171317673035752e+01, 4.634118837166181401869e+01,
+	4.948260989739781717360e+01, 5.262405184111499602925e+01, 5.576551075501997931168e+01,
+	5.890698392608094213283e+01, 6.204846919022716988285e+01,
+	};
+
+constexpr double _Bessel_j1_squared_at_j0_zeros[] =
+	{	// J_1(j_{0,k})^2, k = 1, ..., 21
+	2.695141239419169261390e-01, 1.157801385822036958078e-01, 7.368635113640821514065e-02,
+	5.403757319811628204177e-02, 4.266142901724309126551e-02, 3.524210349099610135875e-02,
+	3.002107010305467267509e-02, 2.614739149530808859046e-02, 2.315912182469139226527e-02,
+	2.078382912226785760398e-02, 1.885045066931766781611e-02, 1.724615756966500829952e-02,
+	1.589351810592359780271e-02, 1.473762609647218958957e-02, 1.373846514538711791829e-02,
+	1.286618173761513287914e-02, 1.209805154862679754711e-02, 1.141647122449160851686e-02,
+	1.080759279118020401155e-02, 1.026037292628076281104e-02, 9.765897139791050540598e-03,
+	};
+
+double _Bessel_j0_zero(const unsigned _Kx)
+	{	// k-th positive zero of J_0: table, then McMahon's expansion
+	if (_Kx <= _STD size(_Bessel_j0_zeros))
+		{
+		return (_Bessel_j0_zeros[_Kx - 1]);
+		}
+
+	const double _Beta = boost::math::double_constants::pi * (_Kx - 0.25);
+	const double _Rx = 1 / _Beta;
+	const double _R2 = _Rx * _Rx;
+	return (_Beta + _Rx * (0.125 + _R2 * (-0.807291666666666666666666666667e-1
+		+ _R2 * (0.246028645833333333333333333333 + _R2 * (-1.82443876720610119047619047619
+		+ _R2 * (25.3364147973439050099206349206 + _R2 * (-567.644412135183381139802038240
+		+ _R2 * (18690.4765282320653831636345064 + _R2 * (-8.49353580299148769921876983660e5
+		+ _R2 * 5.09225462402226769498681286758e7)))))))));
+	}
+
+double _Bessel_j1_squared_at_j0_zero(const unsigned _Kx)
+	{	// J_1(j_{0,k})^2: table, then its large-k expansion
+	if (_Kx <= _STD size(_Bessel_j1_squared_at_j0_zeros))
+		{
+		return (_Bessel_j1_squared_at_j0_zeros[_Kx - 1]);
+		}
+
+	const double _Rx = 1 / (_Kx - 0.25);
+	const double _R2 = _Rx * _Rx;
+	return (_Rx * (0.202642367284675542887091843226 + _R2 * _R2 * (-0.303380429711290253026202643516e-3
+		+ _R2 * (0.198924364245969295201137972743e-3 + _R2 * (-0.228969902772111653038747229723e-3
+		+ _R2 * (0.433710719130746277915572905025e-3 + _R2 * (-0.123632349727175414724737657367e-2
+		+ _R2 * (0.496101423268883102872271417616e-2 + _R2 * (-0.266837393702323757700998557826e-1
+		+ _R2 * 0.185395398206345628711318848386)))))))));
+	}
+
+void _Gauss_legendre_asymptotic(const unsigned _Points, const unsigned _Kx, double& _Node,
+	double& _Weight)
+	{	// k-th node from x = 1 in O(1), after I. Bogaert, "Iteration-free computation of
+		// Gauss-Legendre quadrature nodes and weights", SIAM J. Sci. Comput. 36 (2014):
+		// an expansion of theta_k in powers of 1/(n+1/2) whose coefficients are
+		// Chebyshev interpolants in theta; accurate to double precision for n > 100
+	const double _Wx = 1 / (_Points + 0.5);
+	const double _Nu = _Bessel_j0_zero(_Kx);
+	const double _Theta0 = _Wx * _Nu;
+	const double _Tx = _Theta0 * _Theta0;
+
+	const double _Sf1 = (((((-1.29052996274280508473467968379e-12 * _Tx
+		+ 2.40724685864330121825976175184e-10) * _Tx - 3.13148654635992041468855740012e-8) * _Tx
+		+ 0.275573168962061235623801563453e-5) * _Tx - 0.148809523713909147898955880165e-3) * _Tx
+		+ 0.416666666665193394525296923981e-2) * _Tx - 0.416666666666662959639712457549e-1;
+	const double _Sf2 = (((((2.20639421781871003734786884322e-9 * _Tx
+		- 7.53036771373769326811030753538e-8) * _Tx + 0.161969259453836261731700382098e-5) * _Tx
+		- 0.253300326008232025914059965302e-4) * _Tx + 0.282116886057560434805998583817e-3) * _Tx
+		- 0.209022248387852902722635654229e-2) * _Tx + 0.815972221772932265640401128517e-2;
+	const double _Sf3 = (((((-2.97058225375526229899781956673e-8 * _Tx
+		+ 5.55845330223796209655886325712e-7) * _Tx - 0.567797841356833081642185432056e-5) * _Tx
+		+ 0.418498100329504574443885193835e-4) * _Tx - 0.251395293283965914823026348764e-3) * _Tx
+		+ 0.128654198542845137196151147483e-2) * _Tx - 0.416012165620204364833694266818e-2;
+
+	const double _Wsf1 = ((((((((-2.20902861044616638398573427475e-14 * _Tx
+		+ 2.30365726860377376873232578871e-12) * _Tx - 1.75257700735423807659851042318e-10) * _Tx
+		+ 1.03756066927916795821098009353e-8) * _Tx - 4.63968647553221331251529631098e-7) * _Tx
+		+ 0.149644593625028648361395938176e-4) * _Tx - 0.326278659594412170300449074873e-3) * _Tx
+		+ 0.436507936507598105249726413120e-2) * _Tx - 0.305555555555553028279487898503e-1) * _Tx
+		+ 0.833333333333333302184063103900e-1;
+	const double _Wsf2 = (((((((3.63117412152654783455929483029e-12 * _Tx
+		+ 7.67643545069893130779501844323e-11) * _Tx - 7.12912857233642220650643150625e-9) * _Tx
+		+ 2.11483880685947151466370130277e-7) * _Tx - 0.381817918680045468483009307090e-5) * _Tx
+		+ 0.465969530694968391417927388162e-4) * _Tx - 0.407297185611335764191683161117e-3) * _Tx
+		+ 0.268959435694729660779984493795e-2) * _Tx - 0.111111111111214923138249347172e-1;
+	const double _Wsf3 = (((((((2.01826791256703301806643264922e-9 * _Tx
+		- 4.38647122520206649251063212545e-8) * _Tx + 5.08898347288671653137451093208e-7) * _Tx
+		- 0.397933316519135275712977531366e-5) * _Tx + 0.200559326396458326778521795392e-4) * _Tx
+		- 0.422888059282921161626339411388e-4) * _Tx - 0.105646050254076140548678457002e-3) * _Tx
+		- 0.947969308958577323145923317955e-4) * _Tx + 0.656966489926484797412985260842e-2;
+
+	const double _Nu_over_sin = _Nu / _CSTD sin(_Theta0);
+	const double _B_nu_over_sin = _Bessel_j1_squared_at_j0_zero(_Kx) * _Nu_over_sin;
+	const double _Inv_sinc = _Wx * _Wx * _Nu_over_sin;
+	const double _Inv_sinc2 = _Inv_sinc * _Inv_sinc;
+
+	const double _Theta = _Wx * (_Nu + _Theta0 * _Inv_sinc
+		* (_Sf1 + _Inv_sinc2 * (_Sf2 + _Inv_sinc2 * _Sf3)));
+	_Node = _CSTD cos(_Theta);
+	_Weight = 2 * _Wx / (_B_nu_over_sin
+		+ _B_nu_over_sin * _Inv_sinc2 * (_Wsf1 + _Inv_sinc2 * (_Wsf2 + _Inv_sinc2 * _Wsf3)));
+	}
+
+value_and_derivative<double> _Legendre_compensated(const unsigned _Degree, const double _Px)
+	{	// P_n and P_n' in double-double, rounded at the end; the double recurrence loses
+		// about n ulp near x = 1, which the endpoint weights of the Newton rule inherit
+	const _Compensated _Xc{_Px, 0};
+	_Compensated _Pm1{0, 0};
+	_Compensated _Pl{1, 0};
+	_Compensated _Dm1{0, 0};
+	_Compensated _Dl{0, 0};
+	for (unsigned _Lx = 0; _Lx < _Degree; ++_Lx)
+		{	// (l+1)P_{l+1} = (2l+1)x P_l - l P_{l-1}, and its derivative
+		const _Compensated _Ax = _Compensated_multiply({2.0 * _Lx + 1, 0}, _Xc);
+		const _Compensated _Lm{-static_cast<double>(_Lx), 0};
+		const _Compensated _Pnext = _Compensated_divide(_Compensated_add(
+			_Compensated_multiply(_Ax, _Pl), _Compensated_multiply(_Lm, _Pm1)), _Lx + 1.0);
+		const _Compensated _Dnext = _Compensated_divide(_Compensated_add(
+			_Compensated_add(_Compensated_multiply({2.0 * _Lx + 1, 0}, _Pl),
+				_Compensated_multiply(_Ax, _Dl)),
+			_Compensated_multiply(_Lm, _Dm1)), _Lx + 1.0);
+		_Pm1 = _Pl;
+		_Pl = _Pnext;
+		_Dm1 = _Dl;
+		_Dl = _Dnext;
+		}
+
+	return {_Pl._Hi + _Pl._Lo, _Dl._Hi + _Dl._Lo};
+	}
+
+void _Gauss_legendre_newton(const unsigned _Points, const unsigned _Kx, double& _Node,
+	double& _Weight)
+	{	// k-th node from x = 1 by Newton's method on the Legendre recurrence, started
+		// from Tricomi's approximation
+	const double _Theta = boost::math::double_constants::pi * (_Kx - 0.25) / (_Points + 0.5);
+	double _Xx = (1 - (_Points - 1.0) / (8.0 * _Points * _Points * _Points)) * _CSTD cos(_Theta);
+	auto _Pd = _Recurrence_derivative(_Legendre_recurrence{}, _Points, _Xx);
+	for (int _Iter = 0; _Iter < 16; ++_Iter)
+		{
+		const double _Step = _Pd.value / _Pd.derivative;
+		_Xx -= _Step;
+		_Pd = _Recurrence_derivative(_Legendre_recurrence{}, _Points, _Xx);
+		if (_CSTD fabs(_Step) <= 2 * numeric_limits<double>::epsilon() * _CSTD fabs(_Xx))
+			{
+			break;
+			}
+		}
+
+	// w = 2 / ((1 - x^2) P_n'(x)^2) at the true root, not at the rounded node: carry the
+	// last Newton step delta to first order through 1 - x^2 and P_n', and form 1 - x^2
+	// as (1 - x)(1 + x), which does not cancel near the ends
+	_Pd = _Legendre_compensated(_Points, _Xx);
+	const double _Delta = _Pd.value / _Pd.derivative;
+	const double _One_minus_x2 = (1 - _Xx) * (1 + _Xx);
+	const double _Second = (2 * _Xx * _Pd.derivative
+		- _Points * (_Points + 1.0) * _Pd.value) / _One_minus_x2;
+	const double _Slope = _Pd.derivative - _Second * _Delta;
+	_Node = _Xx;
+	_Weight = 2 / ((_One_minus_x2 + 2 * _Xx * _Delta) * _Slope * _Slope);
+	}
+
+_Rule_storage _Make_gauss_legendre_rule(const unsigned _Points)
+	{	// the rule is symmetric, so generate the half nearest x = 1 and reflect it
+	const auto _Generate = _Points < _Gauss_legendre_asymptotic_min
+		? _Gauss_legendre_newton : _Gauss_legendre_asymptotic;
+	_Rule_storage _Rule(_Points);
+	for (unsigned _Kx = 1; _Kx <= _Points / 2; ++_Kx)
+		{
+		double _Node;
+		double _Weight;
+		_Generate(_Points, _Kx, _Node, _Weight);
+		_Rule._Nodes[_Points - _Kx] = _Node;
+		_Rule._Nodes[_Kx - 1] = -_Node;
+		_Rule._Weights[_Points - _Kx] = _Weight;
+		_Rule._Weights[_Kx - 1] = _Weight;
+		}
+
+	if (_Points % 2 != 0)
+		{	// the middle node is 0; only its weight is needed
+		const unsigned _Mid = _Points / 2;
+		const double _Dp = _Recurrence_derivative(_Legendre_recurrence{}, _Points, 0.0).derivative;
+		_Rule._Nodes[_Mid] = 0;
+		_Rule._Weights[_Mid] = 2 / (_Dp * _Dp);
+		}
+
+	return (_Rule);
+	}
+} // unnamed namespace
+
+namespace {
+	// Gauss rules from the three-term recurrence of an orthonormal family, written as the
+	// Jacobi matrix b_{j+1} q_{j+1}(x) = (x - a_j)q_j(x) - b_j q_{j-1}(x). The nodes are
+	// the zeros of q_n, and the weights are the Christoffel numbers mu_0 / sum_{j<n} q_j^2.
+struct _Orthonormal_values
+	{	// q_n, q_n', and sum_{j<n} q_j^2 at a point, scaled by 2^-_Exponent (the sum by
+		// 2^-2_Exponent) so that large n and |x| neither overflow nor underflow
+	double _Qn;
+	double _Dn;
+	double _Sum;
+	int _Exponent;
+	};
+
+template<class _Family>
+	_Orthonormal_values _Orthonormal_recurrence(const _Family& _Fam, const unsigned _Points,
+		const double _Px)
+	{	// run the recurrence from q_0 = 1, along with its derivative
+	constexpr int _Rescale = 256;
+	double _Qjm1 = 0;
+	double _Qj = 1;
+	double _Djm1 = 0;
+	double _Dj = 0;
+	double _Sum = 0;
+	int _Exponent = 0;
+	for (unsigned _Jx = 0; _Jx < _Points; ++_Jx)
+		{
+		_Sum += _Qj * _Qj;
+		const double _Ax = _Px - _Fam._Diagonal(_Jx);
+		const double _Bj = _Fam._Offdiagonal(_Jx);
+		const double _Bjp1 = _Fam._Offdiagonal(_Jx + 1);
+		const double _Qnext = (_Ax * _Qj - _Bj * _Qjm1) / _Bjp1;
+		const double _Dnext = (_Qj + _Ax * _Dj - _Bj * _Djm1) / _Bjp1;
+		_Qjm1 = _Qj;
+		_Qj = _Qnext;
+		_Djm1 = _Dj;
+		_Dj = _Dnext;
+		if (_CSTD fabs(_Qj) > 0x1p256 || _CSTD fabs(_Dj) > 0x1p256)
+			{
+			_Qjm1 = _CSTD ldexp(_Qjm1, -_Rescale);
+			_Qj = _CSTD ldexp(_Qj, -_Rescale);
+			_Djm1 = _CSTD ldexp(_Djm1, -_Rescale);
+			_Dj = _CSTD ldexp(_Dj, -_Rescale);
+			_Sum = _CSTD ldexp(_Sum, -2 * _Rescale);
+			_Exponent += _Rescale;
+			}
+		}
+
+	return {_Qj, _Dj, _Sum, _Exponent};
+	}
+
+template<class _Family>
+	unsigned _Orthonormal_count_below(const _Family& _Fam, const unsigned _Points, const double _Px)
+	{	// Sturm count: the number of zeros of q_n below _Px, from the signs of the pivots
+		// of the LDL^T factorization of J - xI
+	unsigned _Count = 0;
+	double _Pivot = 1;
+	for (unsigned _Jx = 0; _Jx < _Points; ++_Jx)
+		{
+		const double _Bj = _Fam._Offdiagonal(_Jx);
+		_Pivot = _Fam._Diagonal(_Jx) - _Px - (_Jx == 0 ? 0 : _Bj * _Bj / _Pivot);
+		if (_Pivot == 0)
+			{
+			_Pivot = -numeric_limits<double>::min();
+			}
+
+		_Count += _Pivot < 0;
+		}
+
+	return (_Count);
+	}
+
+template<class _Family>
+	bool _Orthonormal_is_zero(const _Family& _Fam, const unsigned _Points, const unsigned _Index,
+		const double _Px)
+	{	// is _Px the _Index-th (from 1) zero of q_n, rather than one of its neighbors?
+	const double _Delta = 1e-9 * _CSTD fabs(_Px);
+	return (_Delta > 0 && _Orthonormal_count_below(_Fam, _Points, _Px - _Delta) == _Index - 1
+		&& _Orthonormal_count_below(_Fam, _Points, _Px + _Delta) == _Index);
+	}
+
+template<class _Family>
+	double _Orthonormal_zero(const _Family& _Fam, const unsigned _Points, const unsigned _Index,
+		const double _Guess, double _Lo, double _Hi)
+	{	// the _Index-th zero of q_n in (_Lo, _Hi): Newton's method from an asymptotic
+		// guess, falling back to Sturm bisection and bracketed Newton should that land on
+		// the wrong zero
+	double _Xx = _Guess;
+	double _Last_step = numeric_limits<double>::infinity();
+	for (int _Iter = 0; _Iter < 32; ++_Iter)
+		{
+		const auto _Vals = _Orthonormal_recurrence(_Fam, _Points, _Xx);
+		const double _Step = _Vals._Qn / _Vals._Dn;
+		if (!(_CSTD fabs(_Step) < _Last_step))
+			{	// no longer converging; rounding has taken over
+			break;
+			}
+
+		_Xx -= _Step;
+		_Last_step = _CSTD fabs(_Step);
+		if (_Last_step <= 2 * numeric_limits<double>::epsilon() * _CSTD fabs(_Xx))
+			{
+			break;
+			}
+		}
+
+	if (_Orthonormal_is_zero(_Fam, _Points, _Index, _Xx))
+		{
+		return (_Xx);
+		}
+
+	unsigned _Count_lo = _Orthonormal_count_below(_Fam, _Points, _Lo);
+	unsigned _Count_hi = _Orthonormal_count_below(_Fam, _Points, _Hi);
+	while (_Count_lo != _Index - 1 || _Count_hi != _Index)
+		{	// bisect until (_Lo, _Hi) holds this zero alone
+		const double _Mid = (_Lo + _Hi) / 2;
+		if (_Mid <= _Lo || _Hi <= _Mid)
+			{
+			return (_Mid);
+			}
+
+		const unsigned _Count = _Orthonormal_count_below(_Fam, _Points, _Mid);
+		if (_Count < _Index)
+			{
+			_Lo = _Mid;
+			_Count_lo = _Count;
+			}
+		else
+			{
+			_Hi = _Mid;
+			_Count_hi = _Count;
+			}
+		}
+
+	const bool _Negative_at_lo = _Orthonormal_recurrence(_Fam, _Points, _Lo)._Qn < 0;
+	_Xx = (_Lo + _Hi) / 2;
+	for (int _Iter = 0; _Iter < 128; ++_Iter)
+		{	// q_n changes sign exactly once in the bracket, which each iteration shrinks
+		const auto _Vals = _Orthonormal_recurrence(_Fam, _Points, _Xx);
+		if (_Vals._Qn == 0)
+			{
+			break;
+			}
+
+		if ((_Vals._Qn < 0) == _Negative_at_lo)
+			{
+			_Lo = _Xx;
+			}
+		else
+			{
+			_Hi = _Xx;
+			}
+
+		double _Next = _Xx - _Vals._Qn / _Vals._Dn;
+		if (!(_Lo < _Next && _Next < _Hi))
+			{
+			_Next = (_Lo + _Hi) / 2;
+			}
+
+		const bool _Done = _CSTD fabs(_Next - _Xx) <= 2 * numeric_limits<double>::epsilon() * _CSTD fabs(_Xx);
+		_Xx = _Next;
+		if (_Done)
+			{
+			break;
+			}
+		}
+
+	return (_Xx);
+	}
+
+template<class _Family>
+	_Orthonormal_values _Orthonormal_compensated_recurrence(const _Family& _Fam,
+		const unsigned _Points, const double _Px)
+	{	// _Orthonormal_recurrence carrying q_j and the sum in twice the precision; near
+		// the origin the Laguerre recurrence loses about n ulps in working precision
+	constexpr int _Rescale = 256;
+	_Compensated _Qjm1{0, 0};
+	_Compensated _Qj{1, 0};
+	_Compensated _Sum{0, 0};
+	double _Djm1 = 0;
+	double _Dj = 0;
+	int _Exponent = 0;
+	for (unsigned _Jx = 0; _Jx < _Points; ++_Jx)
+		{
+		_Sum = _Compensated_add(_Sum, _Compensated_multiply(_Qj, _Qj));
+		const _Compensated _Ax = _Compensated_add({_Px, 0}, {-_Fam._Diagonal(_Jx), 0});
+		const double _Bj = _Fam._Offdiagonal(_Jx);
+		const double _Bjp1 = _Fam._Offdiagonal(_Jx + 1);
+		const _Compensated _Qnext = _Compensated_divide(_Compensated_add(
+			_Compensated_multiply(_Ax, _Qj), _Compensated_multiply({-_Bj, 0}, _Qjm1)), _Bjp1);
+		const double _Dnext = (_Qj._Hi + _Ax._Hi * _Dj - _Bj * _Djm1) / _Bjp1;
+		_Qjm1 = _Qj;
+		_Qj = _Qnext;
+		_Djm1 = _Dj;
+		_Dj = _Dnext;
+		if (_CSTD fabs(_Qj._Hi) > 0x1p256 || _CSTD fabs(_Dj) > 0x1p256)
+			{
+			_Qjm1 = {_CSTD ldexp(_Qjm1._Hi, -_Rescale), _CSTD ldexp(_Qjm1._Lo, -_Rescale)};
+			_Qj = {_CSTD ldexp(_Qj._Hi, -_Rescale), _CSTD ldexp(_Qj._Lo, -_Rescale)};
+			_Djm1 = _CSTD ldexp(_Djm1, -_Rescale);
+			_Dj = _CSTD ldexp(_Dj, -_Rescale);
+			_Sum = {_CSTD ldexp(_Sum._Hi, -2 * _Rescale), _CSTD ldexp(_Sum._Lo, -2 * _Rescale)};
+			_Exponent += _Rescale;
+			}
+		}
+
+	return {_Qj._Hi + _Qj._Lo, _Dj, _Sum._Hi + _Sum._Lo, _Exponent};
+	}
+
+template<class _Family>
+	pair<double, double> _Orthonormal_node_and_weight(const _Family& _Fam, const unsigned _Points,
+		double _Node)
+	{	// polish a zero found in working precision with compensated Newton steps, then
+		// take its weight from the same evaluation
+	auto _Vals = _Orthonormal_compensated_recurrence(_Fam, _Points, _Node);
+	for (int _Iter = 0; _Iter < 3; ++_Iter)
+		{
+		const double _Next = _Node - _Vals._Qn / _Vals._Dn;
+		if (_Next == _Node || !(_CSTD fabs(_Next - _Node) <= 1e-10 * _CSTD fabs(_Node)))
+			{	// converged, or the step would leave this zero's neighborhood
+			break;
+			}
+
+		_Node = _Next;
+		_Vals = _Orthonormal_compensated_recurrence(_Fam, _Points, _Node);
+		}
+
+	return {_Node, _Fam._Scale_weight(_CSTD ldexp(1 / _Vals._Sum, -2 * _Vals._Exponent))};
+	}
+
+double _Tricomi_laguerre_zero(const unsigned _Points, const double _Alpha, const unsigned _Kx)
+	{	// Tricomi's approximation to the k-th (from 1, ascending) zero of L_n^alpha:
+		// with nu = 4n + 2alpha + 2, solve theta - sin(theta) = pi (4n - 4k + 3) / nu
+		// and take x = nu t - (5/(4(1-t)^2) - 1/(1-t) - 1 + 3alpha^2) / (3nu), t = cos^2(theta/2)
+	const double _Nu = 4.0 * _Points + 2 * _Alpha + 2;
+	const double _Rhs = boost::math::double_constants::pi * (4.0 * _Points - 4.0 * _Kx + 3) / _Nu;
+	double _Theta = boost::math::double_constants::half_pi;
+	for (int _Iter = 0; _Iter < 10; ++_Iter)
+		{
+		_Theta -= (_Theta - _CSTD sin(_Theta) - _Rhs) / (1 - _CSTD cos(_Theta));
+		}
+
+	const double _Cx = _CSTD cos(_Theta / 2);
+	const double _Tx = _Cx * _Cx;
+	return (_Nu * _Tx - (5 / (4 * (1 - _Tx) * (1 - _Tx)) - 1 / (1 - _Tx) - 1 + 3 * _Alpha * _Alpha)
+		/ (3 * _Nu));
+	}
+
+struct _Hermite_orthonormal
+	{	// orthonormal under e^{-x^2}: a_j = 0, b_j = sqrt(j/2), mu_0 = sqrt(pi)
+	static double _Diagonal(unsigned)
+		{
+		return (0.0);
+		}
+
+	static double _Offdiagonal(const unsigned _Jx)
+		{
+		return (_CSTD sqrt(_Jx / 2.0));
+		}
+
+	static double _Scale_weight(const double _Christoffel)
+		{
+		return (boost::math::double_constants::root_pi * _Christoffel);
+		}
+	};
+
+struct _Laguerre_orthonormal
+	{	// orthonormal under x^alpha e^{-x}: a_j = 2j + alpha + 1, b_j = sqrt(j(j + alpha)),
+		// mu_0 = Gamma(alpha + 1)
+	double _Alpha;
+
+	double _Diagonal(const unsigned _Jx) const
+		{
+		return (2.0 * _Jx + _Alpha + 1);
+		}
+
+	double _Offdiagonal(const unsigned _Jx) const
+		{
+		return (_CSTD sqrt(_Jx * (_Jx + _Alpha)));
+		}
+
+	double _Scale_weight(const double _Christoffel) const
+		{	// Gamma(alpha + 1) overflows long before the weights do
+		return (_Alpha < boost::math::max_factorial<double>::value
+			? boost::math::tgamma(_Alpha + 1) * _Christoffel
+			: _CSTD exp(boost::math::lgamma(_Alpha + 1) + _CSTD log(_Christoffel)));
+		}
+	};
+
+_Rule_storage _Make_gauss_hermite_rule(const unsigned _Points)
+	{	// the rule is symmetric; with m = floor(n/2), the positive zeros of H_n are the
+		// square roots of those of L_m^{-1/2} (n even) or L_m^{1/2} (n odd), which supply
+		// the initial guesses
+	const _Hermite_orthonormal _Fam;
+	const unsigned _Half = _Points / 2;
+	const double _Alpha = _Points % 2 == 0 ? -0.5 : 0.5;
+	const double _Upper = _CSTD sqrt(2.0 * _Points) + 1;	// past the Gershgorin bound
+	_Rule_storage _Rule(_Points);
+	for (unsigned _Kx = 1; _Kx <= _Half; ++_Kx)
+		{
+		const double _Guess = _CSTD sqrt(_Tricomi_laguerre_zero(_Half, _Alpha, _Kx));
+		const auto _Pair = _Orthonormal_node_and_weight(_Fam, _Points,
+			_Orthonormal_zero(_Fam, _Points, _Points - _Half + _Kx, _Guess, 0.0, _Upper));
+		_Rule._Nodes[_Points - _Half + _Kx - 1] = _Pair.first;
+		_Rule._Nodes[_Half - _Kx] = -_Pair.first;
+		_Rule._Weights[_Points - _Half + _Kx - 1] = _Pair.second;
+		_Rule._Weights[_Half - _Kx] = _Pair.second;
+		}
+
+	if (_Points % 2 != 0)
+		{
+		_Rule._Nodes[_Half] = 0;
+		_Rule._Weights[_Half] = _Orthonormal_node_and_weight(_Fam, _Points, 0.0).second;
+		}
+
+	return (_Rule);
+	}
+
+_Rule_storage _Make_gauss_laguerre_rule(const unsigned _Points, const double _Alpha)
+	{
+	const _Laguerre_orthonormal _Fam{_Alpha};
+	const double _Upper = 4.0 * _Points + 2 * _Alpha + 2;	// past the Gershgorin bound
+	_Rule_storage _Rule(_Points);
+	for (unsigned _Kx = 1; _Kx <= _Points; ++_Kx)
+		{
+		const double _Guess = _Tricomi_laguerre_zero(_Points, _Alpha, _Kx);
+		const auto _Pair = _Orthonormal_node_and_weight(_Fam, _Points,
+			_Orthonormal_zero(_Fam, _Points, _Kx, _Guess, 0.0, _Upper));
+		_Rule._Nodes[_Kx - 1] = _Pair.first;
+		_Rule._Weights[_Kx - 1] = _Pair.second;
+		}
+
+	return (_Rule);
+	}
+} // unnamed namespace
+
+quadrature_rule gauss_hermite_rule(const unsigned _Points)
+	{
+	static _Rule_cache<unsigned> _Cache;
+	return (_Cache._Get(_Points, [=]{ return (_Make_gauss_hermite_rule(_Points)); }));
+	}
+
+quadrature_rule gauss_laguerre_rule(const unsigned _Points, const double _Alpha)
+	{
+	if (!(-1 < _Alpha && _Alpha < numeric_limits<double>::infinity()))
+		{	// the weight x^alpha e^{-x} is integrable only for alpha > -1
+		errno = EDOM;
+		return {nullptr, nullptr, 0};
+		}
+
+	static _Rule_cache<pair<unsigned, double>> _Cache;
+	return (_Cache._Get(pair<unsigned, double>(_Points, _Alpha),
+		[=]{ return (_Make_gauss_laguerre_rule(_Points, _Alpha)); }));
+	}
+
+quadrature_rule gauss_legendre_rule(const unsigned _Points)
+	{
+	static _Rule_cache<unsigned> _Cache;
+	return (_Cache._Get(_Points, [=]{ return (_Make_gauss_legendre_rule(_Points)); }));
+	}
+
+double hermite(const unsigned _Pn, const double _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::hermite(_Args...); },
+		_Pn, _Px));
+	}
+
+float hermitef(const unsigned _Pn, const float _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::hermite(_Args...); },
+		_Pn, _Px));
+	}
+
+double * hermite_batch(const unsigned _Pn, const double * const _First, const double * const _Last,
+	double * const _Dest)
+	{
+	return (_Recurrence_batch(_Hermite_recurrence{}, _Pn, _First, _Last, _Dest));
+	}
+
+float * hermite_batch(const unsigned _Pn, const float * const _First, const float * const _Last,
+	float * const _Dest)
+	{
+	return (_Recurrence_batch(_Hermite_recurrence{}, _Pn, _First, _Last, _Dest));
+	}
+
+long double * hermite_batch(const unsigned _Pn, const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Recurrence_batch(_Hermite_recurrence{}, _Pn, _First, _Last, _Dest));
+	}
+
+value_and_derivative<double> hermite_and_derivative(const unsigned _Pn, const double _Px)
+	{
+	return (_Recurrence_derivative(_Hermite_recurrence{}, _Pn, _Px));
+	}
+
+value_and_derivative<float> hermite_and_derivative(const unsigned _Pn, const float _Px)
+	{
+	return (_Recurrence_derivative(_Hermite_recurrence{}, _Pn, _Px));
+	}
+
+void hermite_and_derivative_batch(const unsigned _Pn, const double * const _First,
+	const double * const _Last, double * const _Values, double * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Hermite_recurrence{}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
+
+void hermite_and_derivative_batch(const unsigned _Pn, const float * const _First,
+	const float * const _Last, float * const _Values, float * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Hermite_recurrence{}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
+
+void hermite_and_derivative_batch(const unsigned _Pn, const long double * const _First,
+	const long double * const _Last, long double * const _Values, long double * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Hermite_recurrence{}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
+
+namespace {
+	// psi_{k+1}(x) = sqrt(2/(k+1)) x psi_k(x) - sqrt(k/(k+1)) psi_{k-1}(x). Its values stay
+	// bounded by pi^{-1/4}, but psi_0(x) = pi^{-1/4} e^{-x^2/2} underflows for |x| > 38
+	// while psi_n(x) is still O(1) out to sqrt(2n + 1), so the recurrence carries a
+	// mantissa and a separate power of two.
+struct _Hermite_function_origin
+	{	// psi_0(x) = _Mantissa * 2^_Exponent, with the argument the recurrence should use
+	double _Argument;
+	double _Mantissa;
+	long long _Exponent;
+
+	explicit _Hermite_function_origin(const double _Px)
+		: _Argument(_Px), _Mantissa(_Px), _Exponent(0)
+		{
+		if (_CSTD isnan(_Px))
+			{
+			return;
+			}
+
+		if (!(_CSTD fabs(_Px) < 0x1p20))
+			{	// past the turning point sqrt(2n + 1) of every unsigned n; psi_n(x) is 0,
+				// which a finite argument keeps from becoming inf * 0
+			_Argument = 0;
+			_Mantissa = 0;
+			return;
+			}
+
+		// e^{-x^2/2} = 2^-k e^{-r}: x^2/2 is split exactly and reduced by k ln 2 in
+		// extra precision, so large |x| loses nothing beyond the rounding of x itself
+		constexpr double _Ln2_hi = 0x1.62e42fefa39efp-1;
+		constexpr double _Ln2_lo = 0x1.abc9e3b39803fp-56;
+		constexpr double _Pi_quarter_root = 0.75112554446494248;	// pi^{-1/4}
+		const double _Sq = _Px * _Px;
+		const double _Sq_lo = _CSTD fma(_Px, _Px, -_Sq);
+		const double _Kx = _CSTD floor(_Sq / 2 * boost::math::double_constants::log2_e);
+		const double _Rx = _CSTD fma(-_Kx, _Ln2_lo, _CSTD fma(-_Kx, _Ln2_hi, _Sq / 2)) + _Sq_lo / 2;
+		_Mantissa = _Pi_quarter_root * _CSTD exp(-_Rx);
+		_Exponent = -static_cast<long long>(_Kx);
+		}
+	};
+
+double _Hermite_function_value(const double _Mantissa, const long long _Exponent)
+	{	// exponents below the range of int underflow all the same
+	constexpr long long _Floor = numeric_limits<int>::min();
+	return (_CSTD ldexp(_Mantissa, static_cast<int>(_STD max(_Exponent, _Floor))));
+	}
+
+struct _Hermite_function_coefficients
+	{	// sqrt(2/(k+1)) and sqrt(k/(k+1)) from sqrt(k), which the caller carries forward
+		// so that each step takes one square root
+	double _Ak;
+	double _Bk;
+	double _Root_next;
+
+	_Hermite_function_coefficients(const unsigned _Kx, const double _Root)
+		: _Ak(0), _Bk(0), _Root_next(_CSTD sqrt(_Kx + 1.0))
+		{
+		const double _Inv = 1 / _Root_next;
+		_Ak = boost::math::double_constants::root_two * _Inv;
+		_Bk = _Root * _Inv;
+		}
+	};
+
+struct _Hermite_function_state
+	{	// psi_{k-1}(x) and psi_k(x), sharing an exponent, and sqrt(k)
+	double _Px;
+	double _Prev;
+	double _Cur;
+	double _Root;
+	long long _Exponent;
+
+	explicit _Hermite_function_state(const double _Value)
+		: _Px(0), _Prev(0), _Cur(0), _Root(0), _Exponent(0)
+		{
+		const _Hermite_function_origin _Origin(_Value);
+		_Px = _Origin._Argument;
+		_Cur = _Origin._Mantissa;
+		_Exponent = _Origin._Exponent;
+		}
+
+	void _Advance(const unsigned _Kx)
+		{	// from psi_k to psi_{k+1}
+		const _Hermite_function_coefficients _Coef(_Kx, _Root);
+		const double _Next = _Coef._Ak * _Px * _Cur - _Coef._Bk * _Prev;
+		_Root = _Coef._Root_next;
+		_Prev = _Cur;
+		_Cur = _Next;
+		if (_CSTD fabs(_Cur) > _Hermite_function_rescale)
+			{
+			_Prev /= _Hermite_function_rescale;
+			_Cur /= _Hermite_function_rescale;
+			_Exponent += 256;
+			}
+		}
+
+	double _Value() const
+		{
+		return (_Hermite_function_value(_Cur, _Exponent));
+		}
+	};
+
+template<class _Ty>
+	_Ty * _Hermite_function_sequence(const unsigned _Max_degree, const _Ty _Value, _Ty * _Dest)
+	{
+	_Hermite_function_state _State(static_cast<double>(_Value));
+	*_Dest++ = static_cast<_Ty>(_State._Value());
+	for (unsigned _Kx = 0; _Kx < _Max_degree; ++_Kx)
+		{
+		_State._Advance(_Kx);
+		*_Dest++ = static_cast<_Ty>(_State._Value());
+		}
+
+	return (_Dest);
+	}
+
+template<class _Ty>
+	_Ty * _Hermite_function_batch(const unsigned _Degree, const _Ty * _First, const _Ty * const _Last,
+		_Ty * _Dest)
+	{	// as _Recurrence_batch, with the coefficients computed once for all arguments
+	const auto _Function_lanes = _Lane_table_in_use()._Hermite_function;
+	vector<double> _Ca(_Degree);
+	vector<double> _Cb(_Degree);
+	double _Root = 0;
+	for (unsigned _Kx = 0; _Kx < _Degree; ++_Kx)
+		{
+		const _Hermite_function_coefficients _Coef(_Kx, _Root);
+		_Ca[_Kx] = _Coef._Ak;
+		_Cb[_Kx] = _Coef._Bk;
+		_Root = _Coef._Root_next;
+		}
+
+	double _Xs[_Batch_lanes];
+	double _Prev[_Batch_lanes];
+	double _Cur[_Batch_lanes];
+	long long _Exponent[_Batch_lanes];
+	while (_First != _Last)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			const _Hermite_function_origin _Origin(_Idx < _Count ? static_cast<double>(_First[_Idx]) : 0.0);
+			_Xs[_Idx] = _Origin._Argument;
+			_Prev[_Idx] = 0;
+			_Cur[_Idx] = _Origin._Mantissa;
+			_Exponent[_Idx] = _Origin._Exponent;
+			}
+
+		_Function_lanes(_Degree, _Ca.data(), _Cb.data(), _Xs, _Prev, _Cur, _Exponent);
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			_Dest[_Idx] = static_cast<_Ty>(_Hermite_function_value(_Cur[_Idx], _Exponent[_Idx]));
+			}
+
+		_First += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+} // unnamed namespace
+
+double hermite_function(const unsigned _Pn, const double _Px)
+	{
+	_Hermite_function_state _State(_Px);
+	for (unsigned _Kx = 0; _Kx < _Pn; ++_Kx)
+		{
+		_State._Advance(_Kx);
+		}
+
+	return (_State._Value());
+	}
+
+float hermite_function(const unsigned _Pn, const float _Px)
+	{
+	return (static_cast<float>(_STD hermite_function(_Pn, static_cast<double>(_Px))));
+	}
+
+double * hermite_function_sequence(const unsigned _Pn, const double _Px, double * const _Dest)
+	{
+	return (_Hermite_function_sequence(_Pn, _Px, _Dest));
+	}
+
+float * hermite_function_sequence(const unsigned _Pn, const float _Px, float * const _Dest)
+	{
+	return (_Hermite_function_sequence(_Pn, _Px, _Dest));
 	}
 
-double sph_neumann(const unsigned _Pn, const double _Px)
+long double * hermite_function_sequence(const unsigned _Pn, const long double _Px,
+	long double * const _Dest)
+	{
+	return (_Hermite_function_sequence(_Pn, _Px, _Dest));
+	}
+
+double * hermite_function_batch(const unsigned _Pn, const double * const _First,
+	const double * const _Last, double * const _Dest)
+	{
+	return (_Hermite_function_batch(_Pn, _First, _Last, _Dest));
+	}
+
+float * hermite_function_batch(const unsigned _Pn, const float * const _First,
+	const float * const _Last, float * const _Dest)
+	{
+	return (_Hermite_function_batch(_Pn, _First, _Last, _Dest));
+	}
+
+long double * hermite_function_batch(const unsigned _Pn, const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Hermite_function_batch(_Pn, _First, _Last, _Dest));
+	}
+
+namespace {
+class _Chunk_pool
+	{	// worker threads kept between calls of the parallel array forms and of the
+		// hermite_transform products, started as the thread counts ask for them; one call
+		// runs on them at a time. The workers are detached and the pool is never destroyed,
+		// so nothing waits on them during static destruction or under a loader lock; they
+		// block until the process ends them
+public:
+	_Chunk_pool() = default;
+	_Chunk_pool(const _Chunk_pool&) = delete;
+	_Chunk_pool& operator=(const _Chunk_pool&) = delete;
+
+	void _Run(const size_t _Helpers, void (* const _Job)(const void *) noexcept,
+		const void * const _Context)
+		{	// _Job(_Context) on the calling thread and on up to _Helpers workers; a call
+			// made while another has the pool, or a thread that fails to start, leaves
+			// more of the work to the caller, which _Job must be able to finish alone
+		unique_lock<mutex> _Lock(_Mtx);
+		if (_Busy)
+			{
+			_Lock.unlock();
+			_Job(_Context);
+			return;
+			}
+
+		_Busy = true;
+		while (_Started < _Helpers)
+			{
+			try
+				{
+				thread(&_Chunk_pool::_Work, this, _Generation).detach();
+				++_Started;
+				}
+			catch (...)
+				{
+				break;
+				}
+			}
+
+		++_Generation;
+		_Current_job = _Job;
+		_Current_context = _Context;
+		_Wanted = _Helpers;
+		_Lock.unlock();
+		_Work_ready.notify_all();
+		_Job(_Context);
+
+		_Lock.lock();
+		_Wanted = 0;	// workers that have not started yet would find no chunks left
+		_Work_done.wait(_Lock, [this] { return (_Active == 0); });
+		_Busy = false;
+		}
+
+private:
+	void _Work(unsigned long long _Seen) noexcept
+		{	// join each job once, while it still wants helpers
+		unique_lock<mutex> _Lock(_Mtx);
+		for (;;)
+			{
+			_Work_ready.wait(_Lock, [&]
+				{
+				return (_Generation != _Seen && _Wanted != 0);
+				});
+			_Seen = _Generation;
+			--_Wanted;
+			++_Active;
+			const auto _Job = _Current_job;
+			const auto _Context = _Current_context;
+			_Lock.unlock();
+			_Job(_Context);
+			_Lock.lock();
+			if (--_Active == 0)
+				{
+				_Work_done.notify_all();
+				}
+			}
+		}
+
+	mutex _Mtx;
+	condition_variable _Work_ready;
+	condition_variable _Work_done;
+	size_t _Started = 0;
+	void (* _Current_job)(const void *) noexcept = nullptr;
+	const void * _Current_context = nullptr;
+	unsigned long long _Generation = 0;
+	size_t _Wanted = 0;
+	size_t _Active = 0;
+	bool _Busy = false;
+	};
+
+_Chunk_pool& _Worker_pool()
+	{	// leaked on purpose: see _Chunk_pool
+	static _Chunk_pool& _Pool = *new _Chunk_pool;
+	return (_Pool);
+	}
+
+	// C = A B for row-major A (M x K), B (K x N), and C (M x N). The caller and the pool's
+	// threads take parts in turn, each a band of rows of C, or of columns when there are
+	// too few rows to go around; within one, panels of B stay in cache while four rows of
+	// A at a time stream past them.
+constexpr size_t _Product_depth = 128;
+constexpr size_t _Product_width = 256;
+constexpr size_t _Product_rows = 4;
+constexpr double _Product_thread_work = 0x1p20;	// multiply-adds to be worth a thread
+
+void _Matrix_product_block(const double * const _Ap, const double * const _Bp, double * const _Cp,
+	const size_t _Kn, const size_t _Nn, const size_t _Row_first, const size_t _Row_last,
+	const size_t _Col_first, const size_t _Col_last)
+	{
+	for (size_t _Ix = _Row_first; _Ix < _Row_last; ++_Ix)
+		{
+		_STD fill(_Cp + _Ix * _Nn + _Col_first, _Cp + _Ix * _Nn + _Col_last, 0.0);
+		}
+
+	for (size_t _K0 = 0; _K0 < _Kn; _K0 += _Product_depth)
+		{
+		const size_t _K1 = _STD min(_Kn, _K0 + _Product_depth);
+		for (size_t _J0 = _Col_first; _J0 < _Col_last; _J0 += _Product_width)
+			{
+			const size_t _J1 = _STD min(_Col_last, _J0 + _Product_width);
+			size_t _Ix = _Row_first;
+			for (; _Row_last - _Ix >= _Product_rows; _Ix += _Product_rows)
+				{
+				double * const _C0 = _Cp + _Ix * _Nn;
+				double * const _C1 = _C0 + _Nn;
+				double * const _C2 = _C1 + _Nn;
+				double * const _C3 = _C2 + _Nn;
+				for (size_t _Kx = _K0; _Kx < _K1; ++_Kx)
+					{
+					const double _A0 = _Ap[_Ix * _Kn + _Kx];
+					const double _A1 = _Ap[(_Ix + 1) * _Kn + _Kx];
+					const double _A2 = _Ap[(_Ix + 2) * _Kn + _Kx];
+					const double _A3 = _Ap[(_Ix + 3) * _Kn + _Kx];
+					const double * const _Brow = _Bp + _Kx * _Nn;
+					for (size_t _Jx = _J0; _Jx < _J1; ++_Jx)
+						{
+						const double _Bv = _Brow[_Jx];
+						_C0[_Jx] += _A0 * _Bv;
+						_C1[_Jx] += _A1 * _Bv;
+						_C2[_Jx] += _A2 * _Bv;
+						_C3[_Jx] += _A3 * _Bv;
+						}
+					}
+				}
+
+			for (; _Ix < _Row_last; ++_Ix)
+				{
+				double * const _C0 = _Cp + _Ix * _Nn;
+				for (size_t _Kx = _K0; _Kx < _K1; ++_Kx)
+					{
+					const double _A0 = _Ap[_Ix * _Kn + _Kx];
+					const double * const _Brow = _Bp + _Kx * _Nn;
+					for (size_t _Jx = _J0; _Jx < _J1; ++_Jx)
+						{
+						_C0[_Jx] += _A0 * _Brow[_Jx];
+						}
+					}
+				}
+			}
+		}
+	}
+
+void _Matrix_product(const double * const _Ap, const double * const _Bp, double * const _Cp,
+	const size_t _Mn, const size_t _Kn, const size_t _Nn)
+	{	// every element of C sums over k in the same order however the work is divided,
+		// so the result does not depend on the thread count
+	const double _Work = static_cast<double>(_Mn) * _Kn * _Nn;
+	const size_t _Hardware = _STD max(thread::hardware_concurrency(), 1U);
+	const size_t _Threads = static_cast<size_t>(_STD min(static_cast<double>(_Hardware),
+		_STD max(1.0, _Work / _Product_thread_work)));
+	const bool _By_rows = _Mn >= _Threads * _Product_rows;
+	const size_t _Extent = _By_rows ? _Mn : _Nn;
+	const size_t _Parts = _STD min(_Threads, _Extent);
+	const auto _Run = [=](const size_t _Part)
+		{
+		const size_t _First = _Extent * _Part / _Parts;
+		const size_t _Last = _Extent * (_Part + 1) / _Parts;
+		if (_By_rows)
+			{
+			_Matrix_product_block(_Ap, _Bp, _Cp, _Kn, _Nn, _First, _Last, 0, _Nn);
+			}
+		else
+			{
+			_Matrix_product_block(_Ap, _Bp, _Cp, _Kn, _Nn, 0, _Mn, _First, _Last);
+			}
+		};
+
+	atomic<size_t> _Next{0};
+	const auto _Take_parts = [&]() noexcept
+		{
+		for (size_t _Part; (_Part = _Next.fetch_add(1, memory_order_relaxed)) < _Parts; )
+			{
+			_Run(_Part);
+			}
+		};
+
+	if (_Parts > 1)
+		{	// a busy pool, or a thread that fails to start, leaves more parts to this thread
+		_Worker_pool()._Run(_Parts - 1, [](const void * const _Context) noexcept
+			{
+			(*static_cast<const decltype(_Take_parts) *>(_Context))();
+			}, &_Take_parts);
+		}
+	else
+		{
+		_Take_parts();
+		}
+	}
+} // unnamed namespace
+
+hermite_transform::hermite_transform(const unsigned _Points)
+	: _Size(_Points), _Nodes(_STD gauss_hermite_rule(_Points).nodes),
+		_Analysis(static_cast<size_t>(_Points) * _Points), _Synthesis(static_cast<size_t>(_Points) * _Points)
+	{	// the Gauss-Hermite weights times e^{x_i^2} are the Christoffel numbers of the
+		// psi_n themselves, which unlike the weights neither underflow nor overflow
+	for (size_t _Ix = 0; _Ix < _Size; ++_Ix)
+		{
+		double * const _Row = _Analysis.data() + _Ix * _Size;
+		_STD hermite_function_sequence(_Points - 1, _Nodes[_Ix], _Row);
+		double _Sum = 0;
+		for (size_t _Nx = 0; _Nx < _Size; ++_Nx)
+			{
+			_Synthesis[_Nx * _Size + _Ix] = _Row[_Nx];
+			_Sum += _Row[_Nx] * _Row[_Nx];
+			}
+
+		const double _Lambda = 1 / _Sum;
+		for (size_t _Nx = 0; _Nx < _Size; ++_Nx)
+			{
+			_Row[_Nx] *= _Lambda;
+			}
+		}
+	}
+
+void hermite_transform::forward(const double * const _Values, double * const _Coefficients,
+	const size_t _Count) const
+	{	// c_n = sum_i lambda_i psi_n(x_i) f(x_i)
+	_Matrix_product(_Values, _Analysis.data(), _Coefficients, _Count, _Size, _Size);
+	}
+
+void hermite_transform::backward(const double * const _Coefficients, double * const _Values,
+	const size_t _Count) const
+	{	// f(x_i) = sum_n c_n psi_n(x_i)
+	_Matrix_product(_Coefficients, _Synthesis.data(), _Values, _Count, _Size, _Size);
+	}
+
+double laguerre(const unsigned _Pn, const double _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::laguerre(_Args...); },
+		_Pn, _Px));
+	}
+
+float laguerref(const unsigned _Pn, const float _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::laguerre(_Args...); },
+		_Pn, _Px));
+	}
+
+double * laguerre_batch(const unsigned _Pn, const double * const _First, const double * const _Last,
+	double * const _Dest)
+	{
+	return (_Recurrence_batch(_Laguerre_recurrence{}, _Pn, _First, _Last, _Dest));
+	}
+
+float * laguerre_batch(const unsigned _Pn, const float * const _First, const float * const _Last,
+	float * const _Dest)
+	{
+	return (_Recurrence_batch(_Laguerre_recurrence{}, _Pn, _First, _Last, _Dest));
+	}
+
+long double * laguerre_batch(const unsigned _Pn, const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Recurrence_batch(_Laguerre_recurrence{}, _Pn, _First, _Last, _Dest));
+	}
+
+value_and_derivative<double> laguerre_and_derivative(const unsigned _Pn, const double _Px)
+	{
+	return (_Recurrence_derivative(_Laguerre_recurrence{}, _Pn, _Px));
+	}
+
+value_and_derivative<float> laguerre_and_derivative(const unsigned _Pn, const float _Px)
+	{
+	return (_Recurrence_derivative(_Laguerre_recurrence{}, _Pn, _Px));
+	}
+
+void laguerre_and_derivative_batch(const unsigned _Pn, const double * const _First,
+	const double * const _Last, double * const _Values, double * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Laguerre_recurrence{}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
+
+void laguerre_and_derivative_batch(const unsigned _Pn, const float * const _First,
+	const float * const _Last, float * const _Values, float * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Laguerre_recurrence{}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
+
+void laguerre_and_derivative_batch(const unsigned _Pn, const long double * const _First,
+	const long double * const _Last, long double * const _Values, long double * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Laguerre_recurrence{}, _Pn, _First, _Last, _Values, _Derivatives);
+	}
+
+double * laguerre_sequence(const unsigned _Pn, const double _Px, double * const _Dest)
+	{
+	return (_Recurrence_sequence(_Laguerre_recurrence{}, _Pn, _Px, _Dest));
+	}
+
+float * laguerre_sequence(const unsigned _Pn, const float _Px, float * const _Dest)
+	{
+	return (_Recurrence_sequence(_Laguerre_recurrence{}, _Pn, _Px, _Dest));
+	}
+
+long double * laguerre_sequence(const unsigned _Pn, const long double _Px, long double * const _Dest)
+	{
+	return (_Recurrence_sequence(_Laguerre_recurrence{}, _Pn, _Px, _Dest));
+	}
+
+double legendre(const unsigned _Pl, const double _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::legendre_p(_Args...); },
+		_Pl, _Px));
+	}
+
+float legendref(const unsigned _Pl, const float _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::legendre_p(_Args...); },
+		_Pl, _Px));
+	}
+
+double * legendre_batch(const unsigned _Pl, const double * const _First, const double * const _Last,
+	double * const _Dest)
+	{
+	return (_Recurrence_batch(_Legendre_recurrence{}, _Legendre_degree(_Pl),
+		_First, _Last, _Dest));
+	}
+
+float * legendre_batch(const unsigned _Pl, const float * const _First, const float * const _Last,
+	float * const _Dest)
+	{
+	return (_Recurrence_batch(_Legendre_recurrence{}, _Legendre_degree(_Pl),
+		_First, _Last, _Dest));
+	}
+
+long double * legendre_batch(const unsigned _Pl, const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Recurrence_batch(_Legendre_recurrence{}, _Legendre_degree(_Pl),
+		_First, _Last, _Dest));
+	}
+
+value_and_derivative<double> legendre_and_derivative(const unsigned _Pl, const double _Px)
+	{
+	return (_Recurrence_derivative(_Legendre_recurrence{}, _Legendre_degree(_Pl), _Px));
+	}
+
+value_and_derivative<float> legendre_and_derivative(const unsigned _Pl, const float _Px)
+	{
+	return (_Recurrence_derivative(_Legendre_recurrence{}, _Legendre_degree(_Pl), _Px));
+	}
+
+void legendre_and_derivative_batch(const unsigned _Pl, const double * const _First,
+	const double * const _Last, double * const _Values, double * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Legendre_recurrence{}, _Legendre_degree(_Pl), _First, _Last,
+		_Values, _Derivatives);
+	}
+
+void legendre_and_derivative_batch(const unsigned _Pl, const float * const _First,
+	const float * const _Last, float * const _Values, float * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Legendre_recurrence{}, _Legendre_degree(_Pl), _First, _Last,
+		_Values, _Derivatives);
+	}
+
+void legendre_and_derivative_batch(const unsigned _Pl, const long double * const _First,
+	const long double * const _Last, long double * const _Values, long double * const _Derivatives)
+	{
+	_Recurrence_derivative_batch(_Legendre_recurrence{}, _Legendre_degree(_Pl), _First, _Last,
+		_Values, _Derivatives);
+	}
+
+namespace {
+constexpr double _Zeta_integer[] =
+	{	// zeta(n), n = 2, ..., 53; from n = 54 on zeta(n) rounds to 1
+	1.6449340668482264364724e+00, 1.2020569031595942853997e+00, 1.0823232337111381915160e+00,
+	1.0369277551433699263314e+00, 1.0173430619844491397145e+00, 1.0083492773819228268398e+00,
+	1.0040773561979443393787e+00, 1.0020083928260822144179e+00, 1.0009945751278180853371e+00,
+	1.0004941886041194645587e+00, 1.0002460865533080482986e+00, 1.0001227133475784891468e+00,
+	1.0000612481350587048293e+00, 1.0000305882363070204936e+00, 1.0000152822594086518717e+00,
+	1.0000076371976378997623e+00, 1.0000038172932649998399e+00, 1.0000019082127165539389e+00,
+	1.0000009539620338727961e+00, 1.0000004769329867878065e+00, 1.0000002384505027277330e+00,
+	1.0000001192199259653111e+00, 1.0000000596081890512595e+00, 1.0000000298035035146523e+00,
+	1.0000000149015548283650e+00, 1.0000000074507117898354e+00, 1.0000000037253340247885e+00,
+	1.0000000018626597235130e+00, 1.0000000009313274324197e+00, 1.0000000004656629065034e+00,
+	1.0000000002328311833677e+00, 1.0000000001164155017270e+00, 1.0000000000582077208790e+00,
+	1.0000000000291038504450e+00, 1.0000000000145519218910e+00, 1.0000000000072759598351e+00,
+	1.0000000000036379795474e+00, 1.0000000000018189896503e+00, 1.0000000000009094947840e+00,
+	1.0000000000004547473783e+00, 1.0000000000002273736846e+00, 1.0000000000001136868408e+00,
+	1.0000000000000568434199e+00, 1.0000000000000284217098e+00, 1.0000000000000142108548e+00,
+	1.0000000000000071054274e+00, 1.0000000000000035527137e+00, 1.0000000000000017763568e+00,
+	1.0000000000000008881784e+00, 1.0000000000000004440892e+00, 1.0000000000000002220446e+00,
+	1.000000000000000111022303e+00,	// next to a rounding tie, so two more digits
+	};
+
+constexpr double _Zeta_half_integer[] =
+	{	// zeta(n + 1/2), n = 0, ..., 52
+	-1.4603545088095868128895e+00, 2.6123753486854883433486e+00, 1.3414872572509171797568e+00,
+	1.1267338673170566464278e+00, 1.0547075107614542640230e+00, 1.0252045799546856945924e+00,
+	1.0120058998885247961008e+00, 1.0058267275365228077022e+00, 1.0028592508824156277133e+00,
+	1.0014125906121736622712e+00, 1.0007008426417361552195e+00, 1.0003486558834917599012e+00,
+	1.0001737517336431781934e+00, 1.0000866867274623381552e+00, 1.0000432810242567730309e+00,
+	1.0000216199042460691081e+00, 1.0000108031249001785477e+00, 1.0000053992970512034887e+00,
+	1.0000026988959441241278e+00, 1.0000013491977428110168e+00, 1.0000006745156181678561e+00,
+	1.0000003372300968778905e+00, 1.0000001686058207049631e+00, 1.0000000842998368482282e+00,
+	1.0000000421488945224975e+00, 1.0000000210741061102700e+00, 1.0000000105369393754545e+00,
+	1.0000000052684318038131e+00, 1.0000000026342032762603e+00, 1.0000000013170974301621e+00,
+	1.0000000006585473125700e+00, 1.0000000003292731888176e+00, 1.0000000001646364385954e+00,
+	1.0000000000823181673621e+00, 1.0000000000411590663698e+00, 1.0000000000205795274146e+00,
+	1.0000000000102897617839e+00, 1.0000000000051448802508e+00, 1.0000000000025724399117e+00,
+	1.0000000000012862198846e+00, 1.0000000000006431099186e+00, 1.0000000000003215549514e+00,
+	1.0000000000001607774730e+00, 1.0000000000000803887356e+00, 1.0000000000000401943675e+00,
+	1.0000000000000200971837e+00, 1.0000000000000100485918e+00, 1.0000000000000050242959e+00,
+	1.0000000000000025121479e+00, 1.0000000000000012560740e+00, 1.0000000000000006280370e+00,
+	1.0000000000000003140185e+00, 1.0000000000000001570092e+00,
+	};
+
+constexpr double _Zeta_negative_odd[] =
+	{	// zeta(1 - 2m) = -B_2m / 2m, m = 1, ..., 130; from m = 131 on it overflows
+	-8.3333333333333333333333e-02, 8.3333333333333333333333e-03, -3.9682539682539682539683e-03,
+	4.1666666666666666666667e-03, -7.5757575757575757575758e-03, 2.1092796092796092796093e-02,
+	-8.3333333333333333333333e-02, 4.4325980392156862745098e-01, -3.0539543302701197438040e+00,
+	2.6456212121212121212121e+01, -2.8146014492753623188406e+02, 3.6075105463980463980464e+03,
+	-5.4827583333333333333333e+04, 9.7493682385057471264368e+05, -2.0052695796688078946143e+07,
+	4.7238486772162990196078e+08, -1.2635724795916666666667e+10, 3.8087931125245368811553e+11,
+	-1.2850850499305083333333e+13, 4.8241448354850170371582e+14, -2.0040310656516252738108e+16,
+	9.1677436031953307756993e+17, -4.5979888343656503490438e+19, 2.5180471921451095697089e+21,
+	-1.5001733492153928733711e+23, 9.6899578874635940656498e+24, -6.7645882379292820990945e+26,
+	5.0890659468662289689766e+28, -4.1147288792557978697665e+30, 3.5666582095375556109685e+32,
+	-3.3066089876577576725680e+34, 3.2715634236478716264211e+36, -3.4473782558278053878256e+38,
+	3.8614279832705258893093e+40, -4.5892974432454332168864e+42, 5.7775386342770431824885e+44,
+	-7.6919858759507135167410e+46, 1.0813635449971654696354e+49, -1.6029364522008965406067e+51,
+	2.5019479041560462843657e+53, -4.1067052335810212479752e+55, 7.0798774408494580617453e+57,
+	-1.2804546887939508790191e+60, 2.4267340392333524078021e+62, -4.8143218874045769355130e+64,
+	9.9875574175727530680653e+66, -2.1645634868435185631335e+69, 4.8962327039620553206849e+71,
+	-1.1549023923963519663954e+74, 2.8382249570693706959264e+76, -7.2612008803606716303677e+78,
+	1.9323514233419812003332e+81, -5.3450160425288624005396e+83, 1.5356028846422423070207e+86,
+	-4.5789872682265797653899e+88, 1.4162025212194809258360e+91, -4.5400652296092655249187e+93,
+	1.5076656758807859775595e+96, -5.1830949148264563776122e+98, 1.8435647427256529118574e+101,
+	-6.7805554753090958896903e+103, 2.5773326702754604502896e+106, -1.0119112875704597605008e+109,
+	4.1016346161542292108908e+111, -1.7155244534032019392207e+114, 7.4003425705269094271692e+116,
+	-3.2909225357054443486771e+119, 1.5079831534164771205683e+122, -7.1169879188254548628676e+124,
+	3.4580429141577771791992e+127, -1.7290907606676748316749e+130, 8.8936991695032969088767e+132,
+	-4.7038470619636014515138e+135, 2.5571938231060205874986e+138, -1.4284067500443527700581e+141,
+	8.1952152218313782940919e+143, -4.8276485422727371781610e+146, 2.9189612374770323650041e+149,
+	-1.8108932162568904016053e+152, 1.1523577220021168579805e+155, -7.5192311951981769750008e+157,
+	5.0294016576411049724684e+160, -3.4473420444477676704609e+163, 2.4207458645868514718314e+166,
+	-1.7409465920377676507574e+169, 1.2819489863482242737809e+172, -9.6624121108560918424317e+174,
+	7.4526910304300895730939e+177, -5.8808393311674371248221e+180, 4.7462718654907615399221e+183,
+	-3.9169132594772825468290e+186, 3.3045071443226032228307e+189, -2.8492890550994582758115e+192,
+	2.5103329345077586512960e+195, -2.2593901995475253204956e+198, 2.0769138004287608043462e+201,
+	-1.9494732174927259130873e+204, 1.8680731471265913899840e+207, -1.8270752662814576943866e+210,
+	1.8235386322595677181069e+213, -1.8568690810125945098191e+216, 1.9287189851195602092887e+219,
+	-2.0431170460286447575076e+222, 2.2068411644527845507683e+225, -2.4300821796490274251390e+228,
+	2.7274887879083469529027e+231, -3.1197421573755084594516e+234, 3.6358938724282600149348e+237,
+	-4.3168300030760883268140e+240, 5.2204244879387199972045e+243, -6.4292606949769304851989e+246,
+	8.0623033870130843813520e+249, -1.0292714737903011157580e+253, 1.3375329699780524021138e+256,
+	-1.7689480902797379757566e+259, 2.3806479018092397252255e+262, -3.2597127947194184823502e+265,
+	4.5404962371601213191862e+268, -6.4328575193147850610689e+271, 9.2687048675749311115251e+274,
+	-1.3579619500285181473892e+278, 2.0227839736049321681177e+281, -3.0629906992208336065539e+284,
+	4.7143085300742652128262e+287, -7.3741045871355757650658e+290, 1.1720962767050826576509e+294,
+	-1.8928866644685657388539e+297, 3.1055517596048926896025e+300, -5.1754977470366797965164e+303,
+	8.7601563446229215149041e+306,
+	};
+
+constexpr double _Zeta_unit = 53;	// zeta(s) rounds to 1 for every s > 53
+
+double _Zeta_near_one(const double _Ux)
+	{	// zeta(1 + u) for 0 < |u| <= 1, u exact; the even and odd halves of the series
+		// run side by side, halving the chain of dependent steps
+	const double _Usq = _Ux * _Ux;
+	double _Even = 0;
+	double _Odd = 0;
+	for (size_t _Idx = _STD size(_Zeta_laurent); 0 < _Idx; _Idx -= 2)
+		{
+		_Odd = _Odd * _Usq + _Zeta_laurent[_Idx - 1];
+		_Even = _Even * _Usq + _Zeta_laurent[_Idx - 2];
+		}
+
+	return (1 / _Ux + (_Even + _Ux * _Odd));
+	}
+
+double _Zeta_tabulated(const double _Px, bool& _Handled)
+	{	// settle integers other than the pole, half-integers s >= 1/2, and s > 53 from the
+		// tables; clear _Handled for the rest
+	_Handled = true;
+	if (_Px > _Zeta_unit)
+		{
+		return (1);
+		}
+	else if (_Px <= -0x1p53)
+		{	// an even integer, or -inf
+		return (0);
+		}
+
+	const double _Twice = 2 * _Px;
+	if (0 <= _Px && _Px != 1 && _Twice == _CSTD nearbyint(_Twice))
+		{
+		const size_t _Idx = static_cast<size_t>(_Px);
+		return (_Px != _Idx ? _Zeta_half_integer[_Idx]
+			: _Idx == 0 ? -0.5
+			: _Zeta_integer[_Idx - 2]);
+		}
+	else if (_Px < 0 && _Px == _CSTD nearbyint(_Px))
+		{
+		const double _Mx = (1 - _Px) / 2;
+		if (_Mx != _CSTD nearbyint(_Mx))
+			{	// trivial zero
+			return (0);
+			}
+		else if (_Mx <= _STD size(_Zeta_negative_odd))
+			{	// s = 1 - 2m
+			return (_Zeta_negative_odd[static_cast<size_t>(_Mx) - 1]);
+			}
+
+		return (_Mx / 2 != _CSTD nearbyint(_Mx / 2)
+			? -numeric_limits<double>::infinity() : numeric_limits<double>::infinity());
+		}
+
+	_Handled = false;
+	return (0);
+	}
+
+double _Zeta_reflect(const double _Px, const double _Zeta_t)
+	{	// zeta(s) = 2 (2 pi)^(-t) sin(pi s / 2) Gamma(t) zeta(t) for s < 0, given zeta(t) for
+		// t = 1 - s as rounded, or _Zeta_near_one(-s) for s > -1: the
+		// sine takes s, which is exact, and the rest is corrected for the rounding of t and
+		// of pi; past Gamma's range the duplication formula splits 2 (2 pi)^(-t) Gamma(t)
+		// into Gamma(t / 2) pi^(-t / 2) times Gamma((t + 1) / 2) pi^(-(t + 1) / 2), and
+		// the sine is applied before the halves meet, so neither overflows short of the
+		// result
+	constexpr double _Pi_hi = 0x1.921fb54442d18p+1;
+	constexpr double _Pi_error = 0x1.678afae35cdd1p-55;	// pi = _Pi_hi (1 + _Pi_error)
+	constexpr double _Log_two_pi = 1.837877066409345483561;
+	constexpr double _Log_pi = 1.144729885849400174143;
+	constexpr double _Gamma_limit = 170;	// Gamma(t) is finite below
+	constexpr double _Overflow_limit = 342;	// Gamma(t / 2) overflows above, and so does zeta(s)
+	const double _Sine = boost::math::sin_pi(_Px / 2);
+	const _Compensated _Tx = _Compensated_add({1, 0}, {-_Px, 0});
+	const double _Tt = _Tx._Hi;
+	if (_Px > -1)
+		{	// t = 1 + u with u = -s exact: (2 pi)^(-t) comes from s itself, and the rounding
+			// of t costs Gamma(t), with |psi(t)| < 0.6 here, under a third of an ulp
+		return (2 * boost::math::tgamma(_Tt) * (_CSTD pow(2 * _Pi_hi, _Px) / (2 * _Pi_hi))
+			* _Sine * _Zeta_t * (1 - _Tt * _Pi_error));
+		}
+	else if (_Tt > _Overflow_limit)
+		{
+		return (_CSTD copysign(numeric_limits<double>::infinity(), _Sine));
+		}
+
+	// t rounds only where s and t straddle a power of 2; then
+	// d/dt log((2 pi)^(-t) Gamma(t)) = psi(t) - log(2 pi), with psi(t) ~ log(t) - 1 / 2t
+	const double _Correction = 1 - _Tt * _Pi_error
+		+ (_Tx._Lo == 0 ? 0 : _Tx._Lo * (_CSTD log(_Tt) - 0.5 / _Tt - _Log_two_pi));
+	if (_Tt < _Gamma_limit)
+		{
+		return (2 * boost::math::tgamma(_Tt) * _CSTD pow(2 * _Pi_hi, -_Tt)
+			* _Sine * _Zeta_t * _Correction);
+		}
+
+	// (t + 1) / 2 may round as well, with d/dx log(pi^(-x) Gamma(x)) = psi(x) - log(pi)
+	const double _Half = _Tt / 2;
+	const _Compensated _Next = _Compensated_add({_Half, 0}, {0.5, 0});
+	const double _Lower = boost::math::tgamma(_Half) * _CSTD pow(_Pi_hi, -_Half);
+	const double _Upper = boost::math::tgamma(_Next._Hi) * _CSTD pow(_Pi_hi, -_Next._Hi)
+		* (1 + _Next._Lo * (_CSTD log(_Next._Hi) - 0.5 / _Next._Hi - _Log_pi));
+	return ((_Lower * _Sine) * (_Upper * _Zeta_t * _Correction));
+	}
+
+double _Riemann_zeta(const double _Px)
+	{	// zeta(s) for s not NaN: tables at the integers and half-integers, the Laurent
+		// series on [0, 2], reflection below 0, and Boost above 2 and at the pole
+	bool _Handled;
+	const double _Tabulated = _Zeta_tabulated(_Px, _Handled);
+	if (_Handled)
+		{
+		return (_Tabulated);
+		}
+	else if (_CSTD fabs(_Px) < 0x1p-54)
+		{	// zeta(s) = -1/2 - s log(2 pi) / 2 + O(s^2)
+		return (-0.5 - 0.91893853320467274 * _Px);
+		}
+	else if (0 < _Px && _Px < 2 && _Px != 1)
+		{
+		return (_Zeta_near_one(_Px - 1));
+		}
+	else if (_Px < 0)
+		{
+		return (_Zeta_reflect(_Px, _Px > -1 ? _Zeta_near_one(-_Px) : _Riemann_zeta(1 - _Px)));
+		}
+
+	return (_Boost_call([](auto... _Args) { return boost::math::zeta(_Args...); },
+		_Px));
+	}
+
+template<class _Ty> inline
+	_Ty * _Riemann_zeta_batch(const _Ty * _First, const _Ty * const _Last, _Ty * _Dest)
+	{	// zeta(s) for each s in [_First, _Last), _Batch_lanes at a time: a scalar pass settles
+		// what the tables can and gathers the rest, reflection's zeta(1 - s) included, for
+		// the pole series and the Euler-Maclaurin sum, each run across its own lanes; the
+		// pole and |s| < 2^-54 go to _Riemann_zeta
+	const auto _Near_one_lanes = _Lane_table_in_use()._Zeta_near_one;
+	const auto _Series_lanes = _Lane_kernels_in_use<_Ty>()._Zeta_series;
+	double _Zeta[_Batch_lanes];	// zeta(s), or zeta(1 - s) where _Reflect is set
+	bool _Reflect[_Batch_lanes];
+	double _Near[_Batch_lanes];
+	double _Series[_Batch_lanes];
+	size_t _Near_slot[_Batch_lanes];
+	size_t _Series_slot[_Batch_lanes];
+	while (_First != _Last)
+		{
+		const size_t _Count = _STD min(static_cast<size_t>(_Last - _First), _Batch_lanes);
+		size_t _Near_count = 0;
+		size_t _Series_count = 0;
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			const double _Px = static_cast<double>(_First[_Idx]);
+			bool _Handled = true;
+			_Reflect[_Idx] = false;
+			_Zeta[_Idx] = _CSTD isnan(_Px) ? _Px : _Zeta_tabulated(_Px, _Handled);
+			if (_Handled)
+				{	// NaN, or settled by the tables
+				continue;
+				}
+
+			if (_CSTD fabs(_Px) < 0x1p-54 || _Px == 1)
+				{
+				_Zeta[_Idx] = _Riemann_zeta(_Px);
+				}
+			else if (0 < _Px && _Px < 2)
+				{
+				_Near_slot[_Near_count] = _Idx;
+				_Near[_Near_count++] = _Px - 1;
+				}
+			else if (0 < _Px)
+				{
+				_Series_slot[_Series_count] = _Idx;
+				_Series[_Series_count++] = _Px;
+				}
+			else if (_Px > -1)
+				{
+				_Reflect[_Idx] = true;
+				_Near_slot[_Near_count] = _Idx;
+				_Near[_Near_count++] = -_Px;
+				}
+			else
+				{	// t = 1 - s >= 2; past 53 the tables give 1
+				_Reflect[_Idx] = true;
+				_Zeta[_Idx] = _Zeta_tabulated(1 - _Px, _Handled);
+				if (!_Handled)
+					{
+					_Series_slot[_Series_count] = _Idx;
+					_Series[_Series_count++] = 1 - _Px;
+					}
+				}
+			}
+
+		_Near_one_lanes(_Near, _Near, _Near_count);
+		for (size_t _Lane = 0; _Lane < _Near_count; ++_Lane)
+			{
+			_Zeta[_Near_slot[_Lane]] = _Near[_Lane];
+			}
+
+		_Series_lanes(_Series, _Series, _Series_count);
+		for (size_t _Lane = 0; _Lane < _Series_count; ++_Lane)
+			{
+			_Zeta[_Series_slot[_Lane]] = _Series[_Lane];
+			}
+
+		for (size_t _Idx = 0; _Idx < _Count; ++_Idx)
+			{
+			_Dest[_Idx] = static_cast<_Ty>(_Reflect[_Idx]
+				? _Zeta_reflect(static_cast<double>(_First[_Idx]), _Zeta[_Idx])
+				: _Zeta[_Idx]);
+			}
+
+		_First += _Count;
+		_Dest += _Count;
+		}
+
+	return (_Dest);
+	}
+} // unnamed namespace
+
+double riemann_zeta(const double _Px)
 	{
 	if (_CSTD isnan(_Px))
 		{
 		return (_Px);
 		}
 
-	return (_Boost_call([=]{ return boost::math::sph_neumann(_Pn, _Px); }));
+	return (_Riemann_zeta(_Px));
 	}
 
-float sph_neumannf(const unsigned _Pn, const float _Px)
+float riemann_zetaf(const float _Px)
 	{
 	if (_CSTD isnan(_Px))
 		{
 		return (_Px);
 		}
 
-	return (_Boost_call([=]{ return boost::math::sph_neumann(_Pn, _Px); }));
+	return (static_cast<float>(_Riemann_zeta(_Px)));
+	}
+
+double * riemann_zeta_batch(const double * const _First, const double * const _Last,
+	double * const _Dest)
+	{
+	return (_Riemann_zeta_batch(_First, _Last, _Dest));
+	}
+
+float * riemann_zeta_batch(const float * const _First, const float * const _Last,
+	float * const _Dest)
+	{
+	return (_Riemann_zeta_batch(_First, _Last, _Dest));
+	}
+
+long double * riemann_zeta_batch(const long double * const _First,
+	const long double * const _Last, long double * const _Dest)
+	{
+	return (_Riemann_zeta_batch(_First, _Last, _Dest));
+	}
+
+double sph_bessel(const unsigned _Pn, const double _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::sph_bessel(_Args...); },
+		_Pn, _Px));
+	}
+
+float sph_besself(const unsigned _Pn, const float _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::sph_bessel(_Args...); },
+		_Pn, _Px));
+	}
+
+double sph_legendre(const unsigned _Pl, const unsigned _Pm, const double _Ptheta)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::spherical_harmonic_r(_Args...); },
+		_Pl, _Pm, _Ptheta, 0.0));
+	}
+
+float sph_legendref(const unsigned _Pl, const unsigned _Pm, const float _Ptheta)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::spherical_harmonic_r(_Args...); },
+		_Pl, _Pm, _Ptheta, 0.0f));
+	}
+
+double sph_neumann(const unsigned _Pn, const double _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::sph_neumann(_Args...); },
+		_Pn, _Px));
+	}
+
+float sph_neumannf(const unsigned _Pn, const float _Px)
+	{
+	return (_Boost_call([](auto... _Args) { return boost::math::sph_neumann(_Args...); },
+		_Pn, _Px));
 	}
 
 namespace {
@@ -562,4 +5171,96 @@ float hypot(const float _Dx, const float _Dy, const float _Dz)
 	{
 	return (_Hypot3<float>(_Dx, _Dy, _Dz));
 	}
+
+batch_isa current_batch_isa() noexcept
+	{
+	return (_Batch_isa_in_use().load(memory_order_relaxed));
+	}
+
+bool batch_isa_available(const batch_isa _Isa) noexcept
+	{
+	return (_Batch_isa_supported(_Isa));
+	}
+
+batch_isa batch_isa_compiled(const batch_isa _Isa) noexcept
+	{
+	return (static_cast<batch_isa>(_Lane_table_for(_Isa)._Compiled_isa));
+	}
+
+bool set_batch_isa(const batch_isa _Isa) noexcept
+	{
+	if (!_Batch_isa_supported(_Isa))
+		{
+		return (false);
+		}
+
+	_Batch_isa_in_use().store(_Isa, memory_order_relaxed);
+	return (true);
+	}
+
+#if _HAS_CXX20
+namespace {
+	// elements per chunk of the array forms: whole blocks of the batch functions, and enough
+	// chunks at modest sizes to keep many threads busy
+constexpr size_t _Array_chunk = 16 * _Batch_lanes;
+
+atomic<unsigned>& _Parallel_threads_requested() noexcept
+	{	// 0 until set_parallel_threads asks for a count
+	static atomic<unsigned> _Threads{0};
+	return (_Threads);
+	}
+} // unnamed namespace
+
+void set_parallel_threads(const unsigned _Threads) noexcept
+	{
+	_Parallel_threads_requested().store(_Threads, memory_order_relaxed);
+	}
+
+unsigned parallel_threads() noexcept
+	{
+	const unsigned _Threads = _Parallel_threads_requested().load(memory_order_relaxed);
+	return (_Threads != 0 ? _Threads : _STD max(thread::hardware_concurrency(), 1U));
+	}
+
+void _Run_chunks(const size_t _Count, const bool _Parallel,
+	void (* const _Chunk)(const void *, size_t, size_t), const void * const _Context)
+	{	// the caller and the pool's threads take the next chunk as they finish one, but the
+		// chunks are the same for any thread count, and each records its own errno for the
+		// caller to take the lowest failing one's, so neither the results nor errno depend
+		// on the scheduling
+	const size_t _Chunks = (_Count + _Array_chunk - 1) / _Array_chunk;
+	const size_t _Threads = _Parallel
+		? _STD min(static_cast<size_t>(_STD parallel_threads()), _Chunks) : 1;
+	vector<int> _Errors(_Chunks);
+	atomic<size_t> _Next{0};
+	const auto _Run = [&]() noexcept
+		{	// an exception from a chunk terminates, as for the standard parallel algorithms
+		for (size_t _Idx; (_Idx = _Next.fetch_add(1, memory_order_relaxed)) < _Chunks; )
+			{
+			errno = 0;
+			_Chunk(_Context, _Idx * _Array_chunk, _STD min(_Count, (_Idx + 1) * _Array_chunk));
+			_Errors[_Idx] = errno;
+			}
+		};
+
+	const int _Saved_errno = errno;
+	if (_Threads > 1)
+		{
+		_Worker_pool()._Run(_Threads - 1, [](const void * const _Run_context) noexcept
+			{
+			(*static_cast<const decltype(_Run) *>(_Run_context))();
+			}, &_Run);
+		}
+	else
+		{
+		_Run();
+		}
+
+	const auto _Failed = _STD find_if(_Errors.begin(), _Errors.end(), [](const int _Error)
+		{
+		return (_Error != 0);
+		});
+	errno = _Failed != _Errors.end() ? *_Failed : _Saved_errno;
+	}
+#endif /* _HAS_CXX20 */
 _STD_END
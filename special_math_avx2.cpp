@@ -0,0 +1,4 @@
+// the lane kernels of special_math_kernels.hpp, compiled for AVX2 and FMA under namespace
+// std::_Avx2; the batch functions call them where the processor runs both
+#define _SMF_BATCH_ISA _Avx2
+#include "special_math_kernels.hpp"
@@ -0,0 +1,4 @@
+// the lane kernels of special_math_kernels.hpp, compiled for AVX-512 under namespace
+// std::_Avx512; the batch functions call them where the processor runs it
+#define _SMF_BATCH_ISA _Avx512
+#include "special_math_kernels.hpp"
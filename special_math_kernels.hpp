@@ -0,0 +1,1368 @@
+#pragma once
+
+// The lane kernels of the batch functions: the loops that carry _Batch_lanes arguments at
+// once. special_math.cpp includes this file for its own build, and special_math_avx2.cpp and
+// special_math_avx512.cpp include it again under their /arch, with _SMF_BATCH_ISA naming a
+// namespace for the copy; the batch functions call the kernels through the _Lane_table of
+// the build _Batch_isa_in_use picks. The builds share only the types ahead of the kernels.
+// The kernels have internal linkage and call no inline function or template from a header,
+// only their own and the C library, so that no code the builds share is compiled for more
+// than one instruction set.
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+_STD_BEGIN
+constexpr size_t _Batch_lanes = 64;
+
+struct _Carlson_lanes
+	{	// _Carlson_state for _Batch_lanes argument sets, one array per component
+	double _Xx[_Batch_lanes];
+	double _Yy[_Batch_lanes];
+	double _Zz[_Batch_lanes];
+	double _Pp[_Batch_lanes];
+	double _Scale[_Batch_lanes];
+	double _Delta[_Batch_lanes];
+	double _Sum_d[_Batch_lanes];
+	double _Sum_j[_Batch_lanes];
+	};
+
+struct _Complete_elliptic_lanes
+	{	// _Complete_elliptic_state for _Batch_lanes moduli, one array per component
+	double _Arith_hi[_Batch_lanes];
+	double _Arith_lo[_Batch_lanes];
+	double _Geom_hi[_Batch_lanes];
+	double _Geom_lo[_Batch_lanes];
+	double _Sum_hi[_Batch_lanes];
+	double _Sum_lo[_Batch_lanes];
+	double _Gap[_Batch_lanes];
+	};
+
+template<class _Ty>
+	struct _Lane_kernels
+	{	// the kernels of one build that run in _Ty lanes, float or double, or that stop at
+		// the accuracy a _Ty result needs
+	void (*_Exp)(const _Ty *, _Ty *, size_t);
+	void (*_Log)(const _Ty *, const _Ty *, _Ty *, size_t);
+	void (*_Expint_log)(const _Ty *, _Ty *, size_t, bool);
+	void (*_Expint_exp)(const _Ty *, _Ty *, size_t, bool);
+	void (*_Expint_n_series)(unsigned, const _Ty *, _Ty *, size_t);
+	void (*_Expint_n_fraction)(unsigned, const _Ty *, _Ty *, size_t);
+	void (*_Carlson_converge[2][2])(_Carlson_lanes&);	// with R_D, with R_J
+	void (*_Zeta_series)(const double *, double *, size_t);
+	};
+
+struct _Lane_table
+	: _Lane_kernels<float>, _Lane_kernels<double>
+	{	// every kernel of one build; these run in double for every result type
+	int _Compiled_isa;	// the batch_isa the compiler targeted for this build
+	void (*_Hermite)(unsigned, const double *, double *, double *);
+	void (*_Hermite_derivative)(unsigned, const double *, double *, double *, double *, double *);
+	void (*_Laguerre)(unsigned, unsigned, const double *, double *, double *);
+	void (*_Laguerre_derivative)(unsigned, unsigned, const double *, double *, double *,
+		double *, double *);
+	void (*_Legendre)(unsigned, unsigned, const double *, double *, double *);
+	void (*_Legendre_derivative)(unsigned, unsigned, const double *, double *, double *,
+		double *, double *);
+	void (*_Hermite_function)(unsigned, const double *, const double *, const double *,
+		double *, double *, long long *);
+	void (*_Lanczos)(const double *, double *, double *, size_t);
+	void (*_Lbeta)(const double *, const double *, const double *, const double *, double *,
+		size_t);
+	void (*_Complete_elliptic_converge)(_Complete_elliptic_lanes&);
+	void (*_Complete_third)(const double *, size_t, double *, double *, double *);
+	void (*_Zeta_near_one)(const double *, double *, size_t);
+	};
+
+namespace _Avx2 {
+const _Lane_table& _Isa_lane_table() noexcept;
+} // namespace _Avx2
+
+namespace _Avx512 {
+const _Lane_table& _Isa_lane_table() noexcept;
+} // namespace _Avx512
+
+#ifdef _SMF_BATCH_ISA
+namespace _SMF_BATCH_ISA {
+#endif /* _SMF_BATCH_ISA */
+namespace {
+template<class _Ty> constexpr
+	bool _Lane_single = sizeof(_Ty) < sizeof(double);	// float, as against double or long double
+
+template<class _Ty> inline
+	_Ty _Lane_min(const _Ty _Left, const _Ty _Right)
+	{	// _STD min, which the builds would share
+	return (_Right < _Left ? _Right : _Left);
+	}
+
+template<class _Ty> inline
+	_Ty _Lane_max(const _Ty _Left, const _Ty _Right)
+	{	// _STD max, likewise
+	return (_Left < _Right ? _Right : _Left);
+	}
+
+template<class _Ty> inline
+	_Ty _Lane_abs(const _Ty _Value)
+	{	// |x| up to the sign of zero; _CSTD fabs of a float is inline in some libraries
+	return (_Value < 0 ? -_Value : _Value);
+	}
+
+	// double-double arithmetic, for the few places where a double result needs more than
+	// double precision along the way
+struct _Compensated
+	{	// an unevaluated sum _Hi + _Lo with |_Lo| <= ulp(_Hi) / 2
+	double _Hi;
+	double _Lo;
+	};
+
+_Compensated _Compensated_normalize(const double _Hi, const double _Lo)
+	{
+	const double _Sum = _Hi + _Lo;
+	return {_Sum, _Lo - (_Sum - _Hi)};
+	}
+
+_Compensated _Compensated_add(const _Compensated _Left, const _Compensated _Right)
+	{
+	const double _Sum = _Left._Hi + _Right._Hi;
+	const double _Bv = _Sum - _Left._Hi;
+	const double _Err = (_Left._Hi - (_Sum - _Bv)) + (_Right._Hi - _Bv);
+	return (_Compensated_normalize(_Sum, _Err + _Left._Lo + _Right._Lo));
+	}
+
+_Compensated _Compensated_multiply(const _Compensated _Left, const _Compensated _Right)
+	{
+	const double _Prod = _Left._Hi * _Right._Hi;
+	const double _Err = _CSTD fma(_Left._Hi, _Right._Hi, -_Prod);
+	return (_Compensated_normalize(_Prod, _Err + (_Left._Hi * _Right._Lo + _Left._Lo * _Right._Hi)));
+	}
+
+_Compensated _Compensated_divide(const _Compensated _Left, const double _Right)
+	{
+	const double _Quot = _Left._Hi / _Right;
+	const double _Rem = _CSTD fma(-_Quot, _Right, _Left._Hi) + _Left._Lo;
+	return (_Compensated_normalize(_Quot, _Rem / _Right));
+	}
+
+_Compensated _Compensated_negate(const _Compensated _Value)
+	{
+	return {-_Value._Hi, -_Value._Lo};
+	}
+
+_Compensated _Compensated_scale(const _Compensated _Value, const double _Power_of_two)
+	{	// exact, barring underflow
+	return {_Value._Hi * _Power_of_two, _Value._Lo * _Power_of_two};
+	}
+
+_Compensated _Compensated_quotient(const _Compensated _Left, const _Compensated _Right)
+	{
+	const double _Quot = _Left._Hi / _Right._Hi;
+	const _Compensated _Rem = _Compensated_add(_Left,
+		_Compensated_multiply(_Right, {-_Quot, 0}));
+	return (_Compensated_normalize(_Quot, _Rem._Hi / _Right._Hi));
+	}
+
+_Compensated _Compensated_sqrt(const _Compensated _Value)
+	{	// one Newton step from the double square root; _Value._Hi must be positive
+	const double _Root = _CSTD sqrt(_Value._Hi);
+	const double _Rem = _CSTD fma(-_Root, _Root, _Value._Hi) + _Value._Lo;
+	return (_Compensated_normalize(_Root, _Rem / (2 * _Root)));
+	}
+
+constexpr double _Exp_remez[] =
+	{	// r - r^2 P(r^2) = r (e^r + 1) / (e^r - 1) - 2 on |r| <= log(2) / 2, P of degree 4 (fdlibm)
+	1.66666666666666019037e-01, -2.77777777770155933842e-03, 6.61375632143793436117e-05,
+	-1.65339022054652515390e-06, 4.13813679705723846039e-08,
+	};
+
+void _Exp_lanes(const double * const _Args, double * const _Out, const size_t _Count)
+	{	// e^x for each of _Count lanes, |x| < 708, with no library call so that the loop
+		// vectorizes: x = k log(2) + r with |r| <= log(2) / 2, e^r = 1 + r + r c / (2 - c)
+		// with c = r - r^2 P(r^2), and 2^k assembled in the exponent field from the low bits
+		// of x / log(2) + 1.5 2^52
+	constexpr double _Log2e = 1.442695040888963407360;
+	constexpr double _Log2_hi = 0x1.62e42fee00000p-1;	// k _Log2_hi is exact
+	constexpr double _Log2_lo = 0x1.a39ef35793c76p-33;
+	constexpr double _Shift = 0x1.8p52;
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const double _Shifted = _Args[_Lane] * _Log2e + _Shift;
+		const double _Kx = _Shifted - _Shift;
+		const double _Rx = (_Args[_Lane] - _Kx * _Log2_hi) - _Kx * _Log2_lo;
+		const double _Rsq = _Rx * _Rx;
+		const double _Cx = _Rx - _Rsq * (_Exp_remez[0] + _Rsq * (_Exp_remez[1]
+			+ _Rsq * (_Exp_remez[2] + _Rsq * (_Exp_remez[3] + _Rsq * _Exp_remez[4]))));
+
+		_STD uint64_t _Bits;
+		_CSTD memcpy(&_Bits, &_Shifted, sizeof(_Bits));
+		_Bits = (_Bits + 1023) << 52;
+		double _Scale;
+		_CSTD memcpy(&_Scale, &_Bits, sizeof(_Scale));
+		_Out[_Lane] = (1 + (_Rx + _Rx * _Cx / (2 - _Cx))) * _Scale;
+		}
+	}
+
+constexpr float _Exp_remez_float[] =
+	{	// _Exp_remez for float, P of degree 2 (fdlibm)
+	1.6666625440e-01f, -2.7667332906e-03f,
+	};
+
+void _Exp_lanes(const float * const _Args, float * const _Out, const size_t _Count)
+	{	// e^x for each of _Count lanes, |x| < 88, as for double in float arithmetic
+	constexpr float _Log2e = 1.4426950216f;
+	constexpr float _Log2_hi = 6.9314575195e-01f;	// k _Log2_hi is exact
+	constexpr float _Log2_lo = 1.4286067653e-06f;
+	constexpr float _Shift = 0x1.8p23f;
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const float _Shifted = _Args[_Lane] * _Log2e + _Shift;
+		const float _Kx = _Shifted - _Shift;
+		const float _Rx = (_Args[_Lane] - _Kx * _Log2_hi) - _Kx * _Log2_lo;
+		const float _Rsq = _Rx * _Rx;
+		const float _Cx = _Rx - _Rsq * (_Exp_remez_float[0] + _Rsq * _Exp_remez_float[1]);
+
+		_STD uint32_t _Bits;
+		_CSTD memcpy(&_Bits, &_Shifted, sizeof(_Bits));
+		_Bits = (_Bits + 127) << 23;
+		float _Scale;
+		_CSTD memcpy(&_Scale, &_Bits, sizeof(_Scale));
+		_Out[_Lane] = (1 + (_Rx + _Rx * _Cx / (2 - _Cx))) * _Scale;
+		}
+	}
+
+constexpr double _Log_remez[] =
+	{	// R(z) = log((1 + s) / (1 - s)) / s - 2 on z = s^2 <= 0.0295, odd then even powers of
+		// w = z^2 as fdlibm splits them
+	6.666666666666735130e-01, 3.999999999940941908e-01, 2.857142874366239149e-01,
+	2.222219843214978396e-01, 1.818357216161805012e-01, 1.531383769920937332e-01,
+	1.479819860511658591e-01,
+	};
+
+void _Log_lanes(const double * const _Hi, const double * const _Lo, double * const _Out,
+	const size_t _Count)
+	{	// log(hi + lo) for each of _Count lanes, hi positive and normal and |lo| <= ulp(hi),
+		// as log(hi) + lo / hi with no library call: hi = 2^k (1 + f), sqrt(2) / 2 <= 1 + f
+		// < sqrt(2), k and 1 + f taken from the bits with the mantissa biased so that no
+		// branch halves it, and log(1 + f) = f - f^2 / 2 + s (f^2 / 2 + R(s^2)),
+		// s = f / (2 + f)
+	constexpr double _Log2_hi = 6.93147180369123816490e-01;	// k _Log2_hi is exact
+	constexpr double _Log2_lo = 1.90821492927058770002e-10;
+	constexpr _STD uint64_t _Root_half = 0x3fe6a09eull << 32;	// high bits of sqrt(2) / 2
+	constexpr _STD uint64_t _Bias = (0x3ff00000ull << 32) - _Root_half;
+	constexpr _STD uint64_t _Two52 = 0x4330000000000000ull;
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_STD uint64_t _Bits;
+		_CSTD memcpy(&_Bits, &_Hi[_Lane], sizeof(_Bits));
+		_Bits += _Bias;
+		_STD uint64_t _Exponent = _Two52 | (_Bits >> 52);	// 2^52 + k + 1023
+		_Bits = (_Bits & 0x000fffffffffffffull) + _Root_half;
+		double _Kx;
+		_CSTD memcpy(&_Kx, &_Exponent, sizeof(_Kx));
+		_Kx -= 0x1p52 + 1023;
+		double _Mantissa;
+		_CSTD memcpy(&_Mantissa, &_Bits, sizeof(_Mantissa));
+
+		const double _Fx = _Mantissa - 1;
+		const double _Half_sq = 0.5 * _Fx * _Fx;
+		const double _Sx = _Fx / (2 + _Fx);
+		const double _Zx = _Sx * _Sx;
+		const double _Wx = _Zx * _Zx;
+		const double _Even = _Wx * (_Log_remez[1] + _Wx * (_Log_remez[3]
+			+ _Wx * _Log_remez[5]));
+		const double _Odd = _Zx * (_Log_remez[0] + _Wx * (_Log_remez[2]
+			+ _Wx * (_Log_remez[4] + _Wx * _Log_remez[6])));
+		_Out[_Lane] = _Sx * (_Half_sq + (_Even + _Odd))
+			+ (_Kx * _Log2_lo + _Lo[_Lane] / _Hi[_Lane]) - _Half_sq + _Fx + _Kx * _Log2_hi;
+		}
+	}
+
+constexpr float _Log_remez_float[] =
+	{	// _Log_remez for float, of degree 3 in z
+	6.6666662693e-01f, 4.0000972152e-01f, 2.8498786688e-01f, 2.4279078841e-01f,
+	};
+
+void _Log_lanes(const float * const _Hi, const float * const _Lo, float * const _Out,
+	const size_t _Count)
+	{	// log(hi + lo) for each of _Count lanes as for double in float arithmetic
+	constexpr float _Log2_hi = 6.9313812256e-01f;	// k _Log2_hi is exact
+	constexpr float _Log2_lo = 9.0580006145e-06f;
+	constexpr _STD uint32_t _Root_half = 0x3f3504f3;	// sqrt(2) / 2
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_STD uint32_t _Bits;
+		_CSTD memcpy(&_Bits, &_Hi[_Lane], sizeof(_Bits));
+		_Bits += 0x3f800000 - _Root_half;
+		const float _Kx = static_cast<float>(static_cast<_STD int32_t>(_Bits >> 23) - 127);
+		_Bits = (_Bits & 0x007fffff) + _Root_half;
+		float _Mantissa;
+		_CSTD memcpy(&_Mantissa, &_Bits, sizeof(_Mantissa));
+
+		const float _Fx = _Mantissa - 1;
+		const float _Half_sq = 0.5f * _Fx * _Fx;
+		const float _Sx = _Fx / (2 + _Fx);
+		const float _Zx = _Sx * _Sx;
+		const float _Wx = _Zx * _Zx;
+		const float _Even = _Wx * (_Log_remez_float[1] + _Wx * _Log_remez_float[3]);
+		const float _Odd = _Zx * (_Log_remez_float[0] + _Wx * _Log_remez_float[2]);
+		_Out[_Lane] = _Sx * (_Half_sq + (_Even + _Odd))
+			+ (_Kx * _Log2_lo + _Lo[_Lane] / _Hi[_Lane]) - _Half_sq + _Fx + _Kx * _Log2_hi;
+		}
+	}
+
+	// the steps of the three-term recurrences; each _Next reproduces the arithmetic of the
+	// corresponding boost::math *_next function so that values agree with the scalar wrappers
+struct _Hermite_step
+	{	// H_{n+1}(x) = 2xH_n(x) - 2nH_{n-1}(x)
+	double _Next(const unsigned _Nx, const double _Px, const double _Pn, const double _Pnm1) const
+		{
+		return (2 * _Px * _Pn - 2 * _Nx * _Pnm1);
+		}
+
+	double _Next_derivative(const unsigned _Nx, const double _Px, const double _Pn,
+		const double _Dn, const double _Dnm1) const
+		{
+		return (2 * _Pn + 2 * _Px * _Dn - 2 * _Nx * _Dnm1);
+		}
+	};
+
+struct _Laguerre_step
+	{	// (n+1)L_{n+1}^m(x) = (2n+m+1-x)L_n^m(x) - (n+m)L_{n-1}^m(x); m = 0 for laguerre
+	unsigned _Order;
+
+	double _Next(const unsigned _Nx, const double _Px, const double _Pn, const double _Pnm1) const
+		{
+		return (((2 * _Nx + _Order + 1 - _Px) * _Pn - (_Nx + _Order) * _Pnm1) / (_Nx + 1));
+		}
+
+	double _Next_derivative(const unsigned _Nx, const double _Px, const double _Pn,
+		const double _Dn, const double _Dnm1) const
+		{
+		return (((2 * _Nx + _Order + 1 - _Px) * _Dn - _Pn - (_Nx + _Order) * _Dnm1) / (_Nx + 1));
+		}
+	};
+
+struct _Legendre_step
+	{	// (l+1-m)P_{l+1}^m(x) = (2l+1)xP_l^m(x) - (l+m)P_{l-1}^m(x), index n of the recurrence
+		// being l = m + n; m = 0 for legendre
+	unsigned _Order;
+
+	double _Next(const unsigned _Nx, const double _Px, const double _Pn, const double _Pnm1) const
+		{
+		const unsigned _Lx = _Order + _Nx;
+		return (((2 * _Lx + 1) * _Px * _Pn - (_Lx + _Order) * _Pnm1) / (_Lx + 1 - _Order));
+		}
+
+	double _Next_derivative(const unsigned _Nx, const double _Px, const double _Pn,
+		const double _Dn, const double _Dnm1) const
+		{
+		const unsigned _Lx = _Order + _Nx;
+		return (((2 * _Lx + 1) * (_Pn + _Px * _Dn) - (_Lx + _Order) * _Dnm1) / (_Lx + 1 - _Order));
+		}
+	};
+
+template<class _Step> inline
+	void _Recurrence_lanes(const _Step& _Rec, const unsigned _Degree, const double * const _Xs,
+		double * const _Pnm1, double * const _Pn)
+	{	// from P_0 in _Pnm1 and P_1 in _Pn, P_{_Degree - 1} and P__Degree in each of
+		// _Batch_lanes lanes
+	for (unsigned _Nx = 1; _Nx < _Degree; ++_Nx)
+		{
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			const double _Next = _Rec._Next(_Nx, _Xs[_Idx], _Pn[_Idx], _Pnm1[_Idx]);
+			_Pnm1[_Idx] = _Pn[_Idx];
+			_Pn[_Idx] = _Next;
+			}
+		}
+	}
+
+template<class _Step> inline
+	void _Recurrence_derivative_lanes(const _Step& _Rec, const unsigned _Degree,
+		const double * const _Xs, double * const _Pnm1, double * const _Pn, double * const _Dnm1,
+		double * const _Dn)
+	{	// as _Recurrence_lanes, also carrying the differentiated recurrence
+	for (unsigned _Nx = 1; _Nx < _Degree; ++_Nx)
+		{
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			const double _Dnext = _Rec._Next_derivative(_Nx, _Xs[_Idx], _Pn[_Idx], _Dn[_Idx],
+				_Dnm1[_Idx]);
+			const double _Pnext = _Rec._Next(_Nx, _Xs[_Idx], _Pn[_Idx], _Pnm1[_Idx]);
+			_Dnm1[_Idx] = _Dn[_Idx];
+			_Dn[_Idx] = _Dnext;
+			_Pnm1[_Idx] = _Pn[_Idx];
+			_Pn[_Idx] = _Pnext;
+			}
+		}
+	}
+
+void _Hermite_lanes(const unsigned _Degree, const double * const _Xs, double * const _Pnm1,
+	double * const _Pn)
+	{
+	_Recurrence_lanes(_Hermite_step{}, _Degree, _Xs, _Pnm1, _Pn);
+	}
+
+void _Hermite_derivative_lanes(const unsigned _Degree, const double * const _Xs,
+	double * const _Pnm1, double * const _Pn, double * const _Dnm1, double * const _Dn)
+	{
+	_Recurrence_derivative_lanes(_Hermite_step{}, _Degree, _Xs, _Pnm1, _Pn, _Dnm1, _Dn);
+	}
+
+void _Laguerre_lanes(const unsigned _Order, const unsigned _Degree, const double * const _Xs,
+	double * const _Pnm1, double * const _Pn)
+	{
+	_Recurrence_lanes(_Laguerre_step{_Order}, _Degree, _Xs, _Pnm1, _Pn);
+	}
+
+void _Laguerre_derivative_lanes(const unsigned _Order, const unsigned _Degree,
+	const double * const _Xs, double * const _Pnm1, double * const _Pn, double * const _Dnm1,
+	double * const _Dn)
+	{
+	_Recurrence_derivative_lanes(_Laguerre_step{_Order}, _Degree, _Xs, _Pnm1, _Pn, _Dnm1, _Dn);
+	}
+
+void _Legendre_lanes(const unsigned _Order, const unsigned _Degree, const double * const _Xs,
+	double * const _Pnm1, double * const _Pn)
+	{
+	_Recurrence_lanes(_Legendre_step{_Order}, _Degree, _Xs, _Pnm1, _Pn);
+	}
+
+void _Legendre_derivative_lanes(const unsigned _Order, const unsigned _Degree,
+	const double * const _Xs, double * const _Pnm1, double * const _Pn, double * const _Dnm1,
+	double * const _Dn)
+	{
+	_Recurrence_derivative_lanes(_Legendre_step{_Order}, _Degree, _Xs, _Pnm1, _Pn, _Dnm1, _Dn);
+	}
+
+constexpr double _Hermite_function_rescale = 0x1p256;
+
+void _Hermite_function_lanes(const unsigned _Degree, const double * const _Ca,
+	const double * const _Cb, const double * const _Xs, double * const _Prev, double * const _Cur,
+	long long * const _Exponent)
+	{	// psi_{k+1} = _Ca[k] x psi_k - _Cb[k] psi_{k-1} up to psi__Degree in each of
+		// _Batch_lanes lanes, the lanes rescaled every _Stride steps: over that many steps
+		// values grow by at most (sqrt(2) 2^20 + 1)^_Stride, well inside the headroom above 2^256
+	constexpr unsigned _Stride = 16;
+	for (unsigned _Kx = 0; _Kx < _Degree; )
+		{
+		const unsigned _Stop = _Degree - _Kx < _Stride ? _Degree : _Kx + _Stride;
+		for (; _Kx < _Stop; ++_Kx)
+			{
+			const double _Ak = _Ca[_Kx];
+			const double _Bk = _Cb[_Kx];
+			for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+				{
+				const double _Next = _Ak * _Xs[_Idx] * _Cur[_Idx] - _Bk * _Prev[_Idx];
+				_Prev[_Idx] = _Cur[_Idx];
+				_Cur[_Idx] = _Next;
+				}
+			}
+
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			if (_Lane_max(_CSTD fabs(_Prev[_Idx]), _CSTD fabs(_Cur[_Idx])) > _Hermite_function_rescale)
+				{
+				_Prev[_Idx] /= _Hermite_function_rescale;
+				_Cur[_Idx] /= _Hermite_function_rescale;
+				_Exponent[_Idx] += 256;
+				}
+			}
+		}
+	}
+
+	// Boost's lanczos13m53, as lanczos_sum_expG_scaled evaluates it:
+	// L(z) = Gamma(z) e^(z + g - 1/2) / (z + g - 1/2)^(z - 1/2) = P(z) / Q(z),
+	// Q(z) = z (z + 1) ... (z + 11)
+constexpr double _Lanczos_g = 6.024680040776729583740234375;
+constexpr double _Lanczos_num[] =
+	{	// P, lowest order first
+	5.6906521913471563880908e+07, 1.0379404311634454519063e+08, 8.6363131288138591455469e+07,
+	4.3338889324676138347737e+07, 1.4605578087685068084142e+07, 3.4817121549806459088207e+06,
+	6.0185961716810987866702e+05, 7.5999293040145426498753e+04, 6.9559996025153761403563e+03,
+	4.4994455690631681194469e+02, 1.9519927882476174828479e+01, 5.0984166556566761881252e-01,
+	6.0618423462489065257838e-03,
+	};
+
+constexpr double _Lanczos_denom[] =
+	{	// Q, lowest order first
+	0, 39916800, 120543840, 150917976, 105258076, 45995730, 13339535, 2637558, 357423, 32670,
+	1925, 66, 1,
+	};
+
+constexpr size_t _Lanczos_degree = 12;
+
+void _Lanczos_lanes(const double * const _Args, double * const _Num, double * const _Den,
+	const size_t _Count)
+	{	// P(z) and Q(z) for each of _Count lanes, z positive and finite; above 1 both are
+		// taken as z^-12 P(z) and z^-12 Q(z), polynomials in 1 / z with the coefficients
+		// reversed, so that neither overflows and P / Q is unchanged
+	double _Var[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const double _Inverse = 1 / _Args[_Lane];
+		_Var[_Lane] = _Args[_Lane] <= 1 ? _Args[_Lane] : _Inverse;
+		_Num[_Lane] = 0;
+		_Den[_Lane] = 0;
+		}
+
+	for (size_t _Idx = 0; _Idx <= _Lanczos_degree; ++_Idx)
+		{
+		const double _Num_up = _Lanczos_num[_Lanczos_degree - _Idx];
+		const double _Num_down = _Lanczos_num[_Idx];
+		const double _Den_up = _Lanczos_denom[_Lanczos_degree - _Idx];
+		const double _Den_down = _Lanczos_denom[_Idx];
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			const bool _Small = _Args[_Lane] <= 1;
+			_Num[_Lane] = _Num[_Lane] * _Var[_Lane] + (_Small ? _Num_up : _Num_down);
+			_Den[_Lane] = _Den[_Lane] * _Var[_Lane] + (_Small ? _Den_up : _Den_down);
+			}
+		}
+	}
+
+void _Lbeta_lanes(const double * const _Pa, const double * const _Pb,
+	const double * const _Num_a, const double * const _Den_a, double * const _Out,
+	const size_t _Count)
+	{	// _Lbeta_lanczos for each of _Count lanes, a and b at least epsilon with a finite sum,
+		// P(a) and Q(a) given; the three quotients L(a) L(b) / L(c) share one division
+	double _Sum[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Sum[_Lane] = _Pa[_Lane] + _Pb[_Lane];
+		}
+
+	double _Num_b[_Batch_lanes];
+	double _Den_b[_Batch_lanes];
+	double _Num_c[_Batch_lanes];
+	double _Den_c[_Batch_lanes];
+	_Lanczos_lanes(_Pb, _Num_b, _Den_b, _Count);
+	_Lanczos_lanes(_Sum, _Num_c, _Den_c, _Count);
+	double _Scaled[_Batch_lanes];	// L(a) L(b) / L(c) / sqrt(b + g - 1/2)
+	double _Near_one[_Batch_lanes];	// 1 - b / (c + g - 1/2), an unevaluated sum
+	double _Near_one_lo[_Batch_lanes];
+	double _Quotient[_Batch_lanes];	// (b + g - 1/2) / (c + g - 1/2)
+	double _Zero[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const double _Small = _Lane_min(_Pa[_Lane], _Pb[_Lane]);
+		const double _Small_gh = _Small + (_Lanczos_g - 0.5);
+		const double _Sum_gh = _Sum[_Lane] + (_Lanczos_g - 0.5);
+		_Scaled[_Lane] = (_Num_a[_Lane] * _Num_b[_Lane] * _Den_c[_Lane])
+			/ (_Den_a[_Lane] * _Den_b[_Lane] * _Num_c[_Lane] * _CSTD sqrt(_Small_gh));
+		const double _Step = -_Small / _Sum_gh;
+		_Near_one[_Lane] = 1 + _Step;
+		_Near_one_lo[_Lane] = (1 - _Near_one[_Lane]) + _Step;
+		_Quotient[_Lane] = _Small_gh / _Sum_gh;
+		_Zero[_Lane] = 0;
+		}
+
+	_Log_lanes(_Scaled, _Zero, _Scaled, _Count);
+	_Log_lanes(_Near_one, _Near_one_lo, _Near_one, _Count);
+	_Log_lanes(_Quotient, _Zero, _Quotient, _Count);
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const double _Big = _Lane_max(_Pa[_Lane], _Pb[_Lane]);
+		const double _Small = _Lane_min(_Pa[_Lane], _Pb[_Lane]);
+		_Out[_Lane] = _Scaled[_Lane] + 0.5 + (_Big - 0.5) * _Near_one[_Lane]
+			+ _Small * _Quotient[_Lane];
+		}
+	}
+
+	// Carlson's duplication theorem: replacing each argument t by (t + lambda)/4, where
+	// lambda = sqrt(x)sqrt(y) + sqrt(y)sqrt(z) + sqrt(z)sqrt(x), leaves R_F unchanged and
+	// R_D and R_J unchanged up to one term each, collected in _Sum_d and _Sum_j. Once the
+	// arguments agree to 2^-9 (2^-10 for R_D and R_J, whose series has larger terms), a
+	// fifth-order series in their deviations from the mean finishes each form
+	// [DLMF 19.36.1-2]. The step is the same for all three, so one loop serves any subset of
+	// them at a shared (x, y, z).
+
+struct _Carlson_state
+	{
+	double _Xx;
+	double _Yy;
+	double _Zz;
+	double _Pp;
+	double _Scale;	// 4^-m after m steps
+	double _Delta;	// (p - x)(p - y)(p - z) 4^-3m
+	double _Sum_d;
+	double _Sum_j;
+	};
+
+_Carlson_state _Carlson_start(const double _Xx, const double _Yy, const double _Zz, const double _Pp = 1)
+	{
+	return {_Xx, _Yy, _Zz, _Pp, 1, (_Pp - _Xx) * (_Pp - _Yy) * (_Pp - _Zz), 0, 0};
+	}
+
+template<bool _With_rd,
+	bool _With_rj,
+	class _Ty = double> inline
+	bool _Carlson_live(const _Carlson_state& _State)
+	{	// whether the arguments still disagree by more than the series at the finish
+		// allows for a _Ty result; float accepts a wider spread, and so fewer steps
+	double _Lo = _Lane_min(_Lane_min(_State._Xx, _State._Yy), _State._Zz);
+	double _Hi = _Lane_max(_Lane_max(_State._Xx, _State._Yy), _State._Zz);
+	if (_With_rj)
+		{
+		_Lo = _Lane_min(_Lo, _State._Pp);
+		_Hi = _Lane_max(_Hi, _State._Pp);
+		}
+
+	const bool _Single = _Lane_single<_Ty>;
+	const double _Agreement = _With_rd || _With_rj ? (_Single ? 0x1p-4 : 0x1p-10)
+		: (_Single ? 0x1p-3 : 0x1p-9);
+	return (_Hi - _Lo > _Agreement * _Lo);
+	}
+
+double _Carlson_rc(const double _Alpha, const double _Beta, const double _Delta)
+	{	// R_C(alpha^2, beta^2) for positive alpha and beta, given beta^2 - alpha^2 = _Delta
+		// computed without cancellation; then R_C = R_C(1, 1 + e) / alpha with e = _Delta / alpha^2
+	const double _Ex = _Delta / (_Alpha * _Alpha);
+	if (_CSTD fabs(_Ex) < 0x1p-12)
+		{	// the next term, e^5/11, is below 2^-63
+		return ((1 + _Ex * (-1.0 / 3 + _Ex * (1.0 / 5 + _Ex * (-1.0 / 7 + _Ex / 9)))) / _Alpha);
+		}
+	else if (_Ex > 0)
+		{
+		const double _Root = _CSTD sqrt(_Ex);
+		return (_CSTD atan(_Root) / (_Root * _Alpha));
+		}
+
+	const double _Root = _CSTD sqrt(-_Ex);
+	if (_Root < 0.5)
+		{
+		return (_CSTD atanh(_Root) / (_Root * _Alpha));
+		}
+
+	// 1 - root = (beta / alpha)^2 / (1 + root) cancels as e -> -1, so take atanh(root) as
+	// log((1 + root) alpha / beta)
+	return (_CSTD log((1 + _Root) * _Alpha / _Beta) / (_Root * _Alpha));
+	}
+
+template<bool _With_rd,
+	bool _With_rj> inline
+	_Carlson_state _Carlson_step(const _Carlson_state& _State)
+	{
+	const double _Rx = _CSTD sqrt(_State._Xx);
+	const double _Ry = _CSTD sqrt(_State._Yy);
+	const double _Rz = _CSTD sqrt(_State._Zz);
+	const double _Lambda = _Rx * (_Ry + _Rz) + _Ry * _Rz;
+	_Carlson_state _Next = _State;
+	if (_With_rd)
+		{
+		_Next._Sum_d += _State._Scale / (_Rz * (_State._Zz + _Lambda));
+		}
+
+	if (_With_rj)
+		{
+		const double _Alpha = _State._Pp * (_Rx + _Ry + _Rz) + _Rx * _Ry * _Rz;
+		const double _Beta = _CSTD sqrt(_State._Pp) * (_State._Pp + _Lambda);
+		_Next._Sum_j += _State._Scale * _Carlson_rc(_Alpha, _Beta, _State._Delta);
+		_Next._Pp = (_State._Pp + _Lambda) / 4;
+		_Next._Delta = _State._Delta / 64;
+		}
+
+	_Next._Xx = (_State._Xx + _Lambda) / 4;
+	_Next._Yy = (_State._Yy + _Lambda) / 4;
+	_Next._Zz = (_State._Zz + _Lambda) / 4;
+	_Next._Scale = _State._Scale / 4;
+	return (_Next);
+	}
+
+_Carlson_state _Carlson_get(const _Carlson_lanes& _Lanes, const size_t _Idx)
+	{
+	return {_Lanes._Xx[_Idx], _Lanes._Yy[_Idx], _Lanes._Zz[_Idx], _Lanes._Pp[_Idx],
+		_Lanes._Scale[_Idx], _Lanes._Delta[_Idx], _Lanes._Sum_d[_Idx], _Lanes._Sum_j[_Idx]};
+	}
+
+void _Carlson_set(_Carlson_lanes& _Lanes, const size_t _Idx, const _Carlson_state& _State)
+	{
+	_Lanes._Xx[_Idx] = _State._Xx;
+	_Lanes._Yy[_Idx] = _State._Yy;
+	_Lanes._Zz[_Idx] = _State._Zz;
+	_Lanes._Pp[_Idx] = _State._Pp;
+	_Lanes._Scale[_Idx] = _State._Scale;
+	_Lanes._Delta[_Idx] = _State._Delta;
+	_Lanes._Sum_d[_Idx] = _State._Sum_d;
+	_Lanes._Sum_j[_Idx] = _State._Sum_j;
+	}
+
+template<bool _With_rd,
+	bool _With_rj,
+	class _Ty> inline
+	bool _Carlson_step_lanes(_Carlson_lanes& _Lanes)
+	{	// advance every lane whose arguments still disagree, returning whether any did
+	size_t _Live = 0;
+	for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+		{	// step unconditionally and select, keeping the loop free of branches
+		const _Carlson_state _State = _Carlson_get(_Lanes, _Idx);
+		const _Carlson_state _Next = _Carlson_step<_With_rd, _With_rj>(_State);
+		const bool _Take = _Carlson_live<_With_rd, _With_rj, _Ty>(_State);
+		_Lanes._Xx[_Idx] = _Take ? _Next._Xx : _State._Xx;
+		_Lanes._Yy[_Idx] = _Take ? _Next._Yy : _State._Yy;
+		_Lanes._Zz[_Idx] = _Take ? _Next._Zz : _State._Zz;
+		_Lanes._Pp[_Idx] = _Take ? _Next._Pp : _State._Pp;
+		_Lanes._Scale[_Idx] = _Take ? _Next._Scale : _State._Scale;
+		_Lanes._Delta[_Idx] = _Take ? _Next._Delta : _State._Delta;
+		_Lanes._Sum_d[_Idx] = _Take ? _Next._Sum_d : _State._Sum_d;
+		_Lanes._Sum_j[_Idx] = _Take ? _Next._Sum_j : _State._Sum_j;
+		_Live += _Take;
+		}
+
+	return (_Live != 0);
+	}
+
+template<bool _With_rd,
+	bool _With_rj,
+	class _Ty> inline
+	void _Carlson_converge_lanes(_Carlson_lanes& _Lanes)
+	{	// run every lane to the agreement a _Ty result needs
+	while (_Carlson_step_lanes<_With_rd, _With_rj, _Ty>(_Lanes))
+		{
+		}
+	}
+
+	// K(k) = pi / (2 M) and E(k) = K(k) (1 - k^2/2 - sum_{n>=1} 2^{n-1} c_n^2), where M is
+	// the limit of a_{n+1} = (a_n + b_n)/2, b_{n+1} = sqrt(a_n b_n), c_{n+1} = (a_n - b_n)/2
+	// from a_0 = 1, b_0 = sqrt(1 - k^2). Carried in double-double, so that neither the
+	// 1 - k^2 in b_0 nor the cancellation in the sum for E costs accuracy as k -> 1.
+struct _Complete_elliptic_state
+	{
+	_Compensated _Arith;
+	_Compensated _Geom;
+	_Compensated _Sum;
+	double _Gap;
+	};
+
+inline _Complete_elliptic_state _Complete_elliptic_start(const double _Kx)
+	{	// _Kx in [0, 1)
+	const _Compensated _Ksq = _Compensated_multiply({_Kx, 0}, {_Kx, 0});
+	return {{1, 0}, _Compensated_sqrt(_Compensated_add({1, 0}, _Compensated_negate(_Ksq))),
+		_Compensated_add({1, 0}, _Compensated_negate(_Compensated_scale(_Ksq, 0.5))), _Kx};
+	}
+
+inline bool _Complete_elliptic_live(const _Complete_elliptic_state& _State)
+	{	// once c_n < 2^-40 a_n, c_{n+1} is below the last bit of a double-double
+	return (_State._Gap > 0x1p-40 * _State._Arith._Hi);
+	}
+
+inline _Complete_elliptic_state _Complete_elliptic_step(const _Complete_elliptic_state& _State,
+	const double _Weight)
+	{	// _Weight is 2^{n-1} for the step to c_n
+	const _Compensated _Half_gap = _Compensated_scale(
+		_Compensated_add(_State._Arith, _Compensated_negate(_State._Geom)), 0.5);
+	return {_Compensated_scale(_Compensated_add(_State._Arith, _State._Geom), 0.5),
+		_Compensated_sqrt(_Compensated_multiply(_State._Arith, _State._Geom)),
+		_Compensated_add(_State._Sum, _Compensated_negate(_Compensated_scale(
+			_Compensated_multiply(_Half_gap, _Half_gap), _Weight))),
+		_Half_gap._Hi};
+	}
+
+_Complete_elliptic_state _Complete_elliptic_get(const _Complete_elliptic_lanes& _Lanes,
+	const size_t _Idx)
+	{
+	return {{_Lanes._Arith_hi[_Idx], _Lanes._Arith_lo[_Idx]}, {_Lanes._Geom_hi[_Idx], _Lanes._Geom_lo[_Idx]},
+		{_Lanes._Sum_hi[_Idx], _Lanes._Sum_lo[_Idx]}, _Lanes._Gap[_Idx]};
+	}
+
+void _Complete_elliptic_set(_Complete_elliptic_lanes& _Lanes, const size_t _Idx,
+	const _Complete_elliptic_state& _State)
+	{
+	_Lanes._Arith_hi[_Idx] = _State._Arith._Hi;
+	_Lanes._Arith_lo[_Idx] = _State._Arith._Lo;
+	_Lanes._Geom_hi[_Idx] = _State._Geom._Hi;
+	_Lanes._Geom_lo[_Idx] = _State._Geom._Lo;
+	_Lanes._Sum_hi[_Idx] = _State._Sum._Hi;
+	_Lanes._Sum_lo[_Idx] = _State._Sum._Lo;
+	_Lanes._Gap[_Idx] = _State._Gap;
+	}
+
+bool _Complete_elliptic_step_lanes(_Complete_elliptic_lanes& _Lanes, const double _Weight)
+	{	// advance every lane still converging, returning whether any was
+	size_t _Live = 0;
+	for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+		{	// step unconditionally and select, keeping the loop free of branches
+		const _Complete_elliptic_state _State = _Complete_elliptic_get(_Lanes, _Idx);
+		const _Complete_elliptic_state _Next = _Complete_elliptic_step(_State, _Weight);
+		const bool _Take = _Complete_elliptic_live(_State);
+		_Lanes._Arith_hi[_Idx] = _Take ? _Next._Arith._Hi : _State._Arith._Hi;
+		_Lanes._Arith_lo[_Idx] = _Take ? _Next._Arith._Lo : _State._Arith._Lo;
+		_Lanes._Geom_hi[_Idx] = _Take ? _Next._Geom._Hi : _State._Geom._Hi;
+		_Lanes._Geom_lo[_Idx] = _Take ? _Next._Geom._Lo : _State._Geom._Lo;
+		_Lanes._Sum_hi[_Idx] = _Take ? _Next._Sum._Hi : _State._Sum._Hi;
+		_Lanes._Sum_lo[_Idx] = _Take ? _Next._Sum._Lo : _State._Sum._Lo;
+		_Lanes._Gap[_Idx] = _Take ? _Next._Gap : _State._Gap;
+		_Live += _Take;
+		}
+
+	return (_Live != 0);
+	}
+
+void _Complete_elliptic_converge_lanes(_Complete_elliptic_lanes& _Lanes)
+	{	// a lane stops changing when the scalar loop would stop
+	for (double _Weight = 1; _Complete_elliptic_step_lanes(_Lanes, _Weight); _Weight *= 2)
+		{
+		}
+	}
+
+void _Complete_third_lanes(const double * const _Scale, const size_t _Steps, double * const _Aa,
+	double * const _Bb, double * const _Pp)
+	{	// the terms of Bulirsch's cel that involve nu, in each of _Batch_lanes lanes, through
+		// the _Steps scales of a _Complete_third_sweep
+	for (size_t _Step = 0; _Step < _Steps; ++_Step)
+		{
+		const double _Scaled = _Scale[_Step];
+		for (size_t _Idx = 0; _Idx < _Batch_lanes; ++_Idx)
+			{
+			const double _Prev = _Aa[_Idx];
+			const double _Ratio = _Scaled / _Pp[_Idx];
+			_Aa[_Idx] += _Bb[_Idx] / _Pp[_Idx];
+			_Bb[_Idx] = 2 * (_Bb[_Idx] + _Prev * _Ratio);
+			_Pp[_Idx] += _Ratio;
+			}
+		}
+	}
+
+template<class _Ty>
+	struct _Expint_rational;
+
+template<>
+	struct _Expint_rational<double>
+	{	// minimax P / Q for the regions of _Expint_log_lanes and _Expint_exp_lanes, each
+		// table padded to the highest degree among its regions
+	static constexpr double _Lowest = -700;	// Ei(x) normal and e^x finite
+	static constexpr double _Highest = 700;
+	static constexpr size_t _Log_degree = 8;
+	static constexpr double _Log_coeff[] =
+		{	// P then Q, lowest order first, for [-1 / 2, 0) then (0, 6]
+		1.000000000000000000000e+00, -1.583801134143934530307e-01, 2.294860417610307401493e-02,
+		-8.165857153473170693819e-04, 1.005300056387490854979e-05, 0.0,
+		0.0, 0.0, 0.0,
+		1.000000000000000000000e+00, -4.083801134143928979192e-01, 6.948807697417606898949e-02,
+		-5.917487546337418802267e-03, 2.162690212894262755706e-04, 0.0,
+		0.0, 0.0, 0.0,
+		2.986772243435985796367e+00, -1.432680642088410838397e-01, 7.557755926375360200353e-01,
+		-1.037127923463041466456e-02, 3.973423575614837277570e-02, 5.478327833970077958073e-04,
+		5.101586579691809062928e-04, 1.407208502876279025055e-05, 7.724573884569736638547e-07,
+		1.000000000000000000000e+00, -1.338178908022519486565e+00, 8.295804394589840757845e-01,
+		-3.122427873199412617922e-01, 7.833995410866678721362e-02, -1.347352724801475359895e-02,
+		1.558715715564700388801e-03, -1.114966849152128065652e-04, 3.798422658419832041217e-06,
+		};
+
+	static constexpr size_t _Exp_degree = 11;
+	static constexpr double _Exp_coeff[] =
+		{	// P then Q, lowest order first, for x < -1 / 2, (6, 22], then 22 < x
+		1.000000000000000000000e+00, -4.028877956854346820137e+01, 6.305161613233260595734e+02,
+		-4.970942788011554512195e+03, 2.146970949323759123217e+04, -5.194165472194029280217e+04,
+		6.945941833376437716652e+04, -4.912505508120320155285e+04, 1.690570836946623603581e+04,
+		-2.427945057112492122542e+03, 1.040422802105536987938e+02, -2.829437082834735939230e-01,
+		1.000000000000000000000e+00, -4.128877956854333319825e+01, 6.698049408919458755918e+02,
+		-5.564170169749576416507e+03, 2.591800246058189077303e+04, -6.987921563433743722271e+04,
+		1.090469924731187347788e+05, -9.606992615100239345338e+04, 4.535055505422759597423e+04,
+		-1.045327655528087052517e+04, 9.901306238368706544861e+02, -2.590654784793933629317e+01,
+		9.999426811154159544515e-01, -2.191209392332829608563e+01, 6.945909000511194335559e+02,
+		-6.801061346927152953867e+03, 1.133196494911833724473e+05, -3.481562079298595199361e+05,
+		4.432955330517119728029e+06, 3.640780559269864857197e+07, -1.627273849925291240215e+08,
+		1.997492123776345729828e+09, -9.236697702121288776398e+08, 0.0,
+		1.000000000000000000000e+00, -2.292596151430180384523e+01, 7.170410226152023369650e+02,
+		-7.578383534601477549586e+03, 1.239256719776236132020e+05, -5.908583646837084088475e+05,
+		7.507458180629630573094e+06, -8.675327111782563850284e+06, 1.751876653722503185272e+08,
+		1.076483806511366367340e+08, 1.117179008873390436172e+09, 0.0,
+		1.048872698766103894741e+00, -3.484420534022474313929e+00, 6.456623586600533926116e+00,
+		-7.352577681924690189419e+00, 5.486403833227823767515e+00, -2.606100375012297742927e+00,
+		7.398567006821697988883e-01, -1.046020239370586968342e-01, 5.062391093514270398734e-03,
+		-1.646965810377609923474e-05, 0.0, 0.0,
+		1.000000000000000000000e+00, -3.372262321595226097770e+00, 6.321062824687849079908e+00,
+		-7.314264788421527718754e+00, 5.574116712118801331144e+00, -2.737879052771503118890e+00,
+		8.234490271135725958374e-01, -1.322100695841166850819e-01, 9.106702509981683124618e-03,
+		-1.847961221979100047367e-04, 0.0, 0.0,
+		};
+	};
+
+template<>
+	struct _Expint_rational<float>
+	{	// _Expint_rational for float, fitted to float accuracy and so of lower degree
+	static constexpr float _Lowest = -80;
+	static constexpr float _Highest = 88;
+	static constexpr size_t _Log_degree = 5;
+	static constexpr float _Log_coeff[] =
+		{	// P then Q, lowest order first, for [-1 / 2, 0) then (0, 6]
+		1.00000000e+00f, -1.20567992e-01f, 1.54521137e-02f,
+		6.25571454e-05f, 0.0f, 0.0f,
+		1.00000000e+00f, -3.70567992e-01f, 5.25385558e-02f,
+		-2.90164083e-03f, 0.0f, 0.0f,
+		2.98677224e+00f, 9.28071976e-02f, 6.48670540e-01f,
+		3.88334271e-02f, 1.86850121e-02f, 1.00904992e-03f,
+		1.00000000e+00f, -1.25913864e+00f, 6.91742004e-01f,
+		-2.08823713e-01f, 3.49325852e-02f, -2.61401072e-03f,
+		};
+
+	static constexpr size_t _Exp_degree = 5;
+	static constexpr float _Exp_coeff[] =
+		{	// P then Q, lowest order first, for x < -1 / 2, (6, 22], then 22 < x
+		9.99999995e-01f, -1.04397172e+01f, 3.03454524e+01f,
+		-2.69108679e+01f, 5.66021169e+00f, -7.11264378e-02f,
+		1.00000000e+00f, -1.14397142e+01f, 3.97854428e+01f,
+		-4.98066505e+01f, 2.07529303e+01f, -2.02066989e+00f,
+		9.98162407e-01f, 6.77799757e+00f, -1.61513353e+02f,
+		2.36284903e+03f, -9.43594076e+03f, 3.42679760e+04f,
+		1.00000000e+00f, 5.58455433e+00f, -1.60711476e+02f,
+		2.31651883e+03f, -9.17298103e+03f, 2.60407536e+04f,
+		1.04887270e+00f, 3.32212666e-01f, -4.34732920e-01f,
+		5.27875812e-02f, -3.76922493e-04f, 0.0f,
+		1.00000000e+00f, 2.66533123e-01f, -4.31855129e-01f,
+		7.04893008e-02f, -2.35983826e-03f, 0.0f,
+		};
+	};
+
+constexpr double _Expint_root_hi = 0x1.7d72952b4b5fcp-2;	// x0, Ei(x0) = 0
+constexpr double _Expint_root_lo = 1.314018341438602755367e-17;
+constexpr double _Expint_root_inverse_hi = 0x1.579e09014632dp+1;	// 1 / x0
+constexpr double _Expint_root_inverse_lo = 1.053875753284596820351e-16;
+constexpr double _Euler_gamma = 5.772156649015328606065e-01;
+
+template<size_t _Regions,
+	class _Ty,
+	class _Fn> inline
+	void _Expint_fit_lanes(const _Ty * const _Args, const _Ty * const _Var,
+		const _Ty * const _Coeff, const size_t _Degree, _Fn _Pick, _Ty * const _Num,
+		_Ty * const _Den, const size_t _Count)
+	{	// P(v) and Q(v) by Horner for each of _Count lanes, _Coeff holding P then Q for each
+		// of _Regions regions; every region's coefficient is loaded before _Pick(x, those)
+		// blends out the one for the lane, so that the region never decides a branch
+	const size_t _Stride = _Degree + 1;
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Num[_Lane] = 0;
+		_Den[_Lane] = 0;
+		}
+
+	for (size_t _Idx = _Stride; 0 < _Idx--; )
+		{
+		_Ty _Num_coeff[_Regions];
+		_Ty _Den_coeff[_Regions];
+		for (size_t _Region = 0; _Region < _Regions; ++_Region)
+			{
+			_Num_coeff[_Region] = _Coeff[2 * _Region * _Stride + _Idx];
+			_Den_coeff[_Region] = _Coeff[(2 * _Region + 1) * _Stride + _Idx];
+			}
+
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Num[_Lane] = _Num[_Lane] * _Var[_Lane] + _Pick(_Args[_Lane], _Num_coeff);
+			_Den[_Lane] = _Den[_Lane] * _Var[_Lane] + _Pick(_Args[_Lane], _Den_coeff);
+			}
+		}
+	}
+
+template<class _Ty> inline
+	void _Expint_log_lanes(const _Ty * const _Args, _Ty * const _Out, const size_t _Count,
+		const bool _Scaled)
+	{	// Ei(x), or e^-x Ei(x) if _Scaled, for each of _Count lanes, x nonzero and normal in
+		// [-1 / 2, 6]:
+		//	-1 / 2 <= x < 0:	log(-x) + gamma + x P/Q(x)
+		//	0 < x <= 6:	log(x / x0) + (x - x0) P/Q(x / 3 - 1), Ei(x0) = 0
+		// for x0 / 2 <= x <= 3 x0 / 2, x - x0 is exact and log(x / x0) = log(1 + q) takes
+		// 1 + q as an unevaluated sum, so that Ei keeps its relative accuracy near x0
+	using _Rational = _Expint_rational<_Ty>;
+	constexpr _Ty _Root_hi = static_cast<_Ty>(_Expint_root_hi);
+	constexpr _Ty _Root_lo = static_cast<_Ty>((_Expint_root_hi - _Root_hi) + _Expint_root_lo);
+	constexpr _Ty _Inverse_hi = static_cast<_Ty>(_Expint_root_inverse_hi);
+	constexpr _Ty _Inverse_lo = static_cast<_Ty>(
+		(_Expint_root_inverse_hi - _Inverse_hi) + _Expint_root_inverse_lo);
+	constexpr _Ty _Gamma = static_cast<_Ty>(_Euler_gamma);
+	constexpr _Ty _Third = static_cast<_Ty>(1.0 / 3);
+	_Ty _Var[_Batch_lanes];
+	_Ty _Scale[_Batch_lanes];
+	_Ty _Hi[_Batch_lanes];
+	_Ty _Lo[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const _Ty _Px = _Args[_Lane];
+		const _Ty _Offset = (_Px - _Root_hi) - _Root_lo;
+		const _Ty _Ratio = _Offset * _Inverse_hi + _Offset * _Inverse_lo;
+		const _Ty _Sum = 1 + _Ratio;
+		const bool _Near_root = _Lane_abs(_Ratio) <= static_cast<_Ty>(0.5);
+		const _Ty _Magnitude = -_Px;
+		const _Ty _Quotient = _Px * _Inverse_hi;
+		const _Ty _Shifted = _Px * _Third - 1;
+		_Var[_Lane] = _Px < 0 ? _Px : _Shifted;
+		_Scale[_Lane] = _Px < 0 ? _Px : _Offset;
+		const _Ty _Error = (1 - _Sum) + _Ratio;
+		const _Ty _Far = _Px < 0 ? _Magnitude : _Quotient;
+		_Hi[_Lane] = _Near_root ? _Sum : _Far;
+		_Lo[_Lane] = _Near_root ? _Error : _Ty{0};
+		}
+
+	_Ty _Num[_Batch_lanes];
+	_Ty _Den[_Batch_lanes];
+	_Expint_fit_lanes<2>(_Args, _Var, _Rational::_Log_coeff, _Rational::_Log_degree,
+		[](const _Ty _Px, const _Ty (&_By_region)[2]) {
+			const _Ty _Negative = _By_region[0];
+			const _Ty _Positive = _By_region[1];
+			return (_Px < 0 ? _Negative : _Positive);
+			},
+		_Num, _Den, _Count);
+	_Log_lanes(_Hi, _Lo, _Hi, _Count);
+	_Ty _Factor[_Batch_lanes];
+	if (_Scaled)
+		{
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Factor[_Lane] = -_Args[_Lane];
+			}
+
+		_Exp_lanes(_Factor, _Factor, _Count);
+		}
+	else
+		{
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Factor[_Lane] = 1;
+			}
+		}
+
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const _Ty _Shifted = _Hi[_Lane] + _Gamma;
+		const _Ty _Log = _Args[_Lane] < 0 ? _Shifted : _Hi[_Lane];
+		_Out[_Lane] = _Factor[_Lane] * (_Log + _Scale[_Lane] * _Num[_Lane] / _Den[_Lane]);
+		}
+	}
+
+template<class _Ty> inline
+	void _Expint_exp_lanes(const _Ty * const _Args, _Ty * const _Out, const size_t _Count,
+		const bool _Scaled)
+	{	// Ei(x) for each of _Count lanes, x < -1 / 2 or 6 < x within [_Lowest, _Highest]:
+		//	x < -1 / 2, 6 < x <= 22:	e^x / x P/Q(1 / x)
+		//	22 < x:			e^x / x (1 + P/Q(44 / x - 1) / x)
+		// with a single division for both P / Q and the 1 / x ahead of it; if _Scaled,
+		// e^-x Ei(x) for x < -1 / 2 or 6 < x up to 4 / epsilon, by leaving out the e^x
+	using _Rational = _Expint_rational<_Ty>;
+	_Ty _Inverse[_Batch_lanes];
+	_Ty _Var[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const _Ty _Inv = 1 / _Args[_Lane];
+		const _Ty _Shifted = 44 * _Inv - 1;
+		_Inverse[_Lane] = _Inv;
+		_Var[_Lane] = _Args[_Lane] <= 22 ? _Inv : _Shifted;
+		}
+
+	_Ty _Num[_Batch_lanes];
+	_Ty _Den[_Batch_lanes];
+	_Expint_fit_lanes<3>(_Args, _Var, _Rational::_Exp_coeff, _Rational::_Exp_degree,
+		[](const _Ty _Px, const _Ty (&_By_region)[3]) {
+			const _Ty _Negative = _By_region[0];
+			const _Ty _Middle = _By_region[1];
+			const _Ty _Large = _By_region[2];
+			const _Ty _Positive = _Px <= 22 ? _Middle : _Large;
+			return (_Px < 0 ? _Negative : _Positive);
+			},
+		_Num, _Den, _Count);
+	_Ty _Exp[_Batch_lanes];
+	if (_Scaled)
+		{
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Exp[_Lane] = 1;
+			}
+		}
+	else
+		{
+		_Exp_lanes(_Args, _Exp, _Count);
+		}
+
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const _Ty _Px = _Args[_Lane];
+		const _Ty _Corrected = _Den[_Lane] + _Num[_Lane] * _Inverse[_Lane];
+		const _Ty _Series = 22 < _Px ? _Corrected : _Num[_Lane];
+		_Out[_Lane] = _Exp[_Lane] * _Series / (_Den[_Lane] * _Px);
+		}
+	}
+
+template<class _Ty> inline
+	void _Expint_n_series_lanes(const unsigned _Pn, const _Ty * const _Args, _Ty * const _Out,
+		const size_t _Count)
+	{	// E_n(x) for each of _Count lanes, n positive and x normal in (0, 1), from
+		//	E_n(x) = (-x)^(n-1) / (n-1)! (psi(n) - log(x)) - sum_(k != n-1) (-x)^k / ((k-n+1) k!)
+		// to a fixed number of terms; past that many the logarithmic term is too small to
+		// register and is left out
+	constexpr unsigned _Terms = _Lane_single<_Ty> ? 15 : 25;
+	_Ty _Term[_Batch_lanes];	// (-x)^k / k!
+	_Ty _Sum[_Batch_lanes];
+	_Ty _Log_term[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Term[_Lane] = 1;
+		_Sum[_Lane] = 0;
+		_Log_term[_Lane] = 0;
+		}
+
+	for (unsigned _Kx = 0; _Kx < _Terms; ++_Kx)
+		{
+		if (_Kx + 1 == _Pn)
+			{
+			for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+				{
+				_Log_term[_Lane] = _Term[_Lane];
+				}
+			}
+		else
+			{
+			const _Ty _Divisor = static_cast<_Ty>(static_cast<double>(_Kx) + 1 - _Pn);
+			for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+				{
+				_Sum[_Lane] -= _Term[_Lane] / _Divisor;
+				}
+			}
+
+		const _Ty _Step = static_cast<_Ty>(-1.0 / (_Kx + 1));
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Term[_Lane] *= _Args[_Lane] * _Step;
+			}
+		}
+
+	if (_Terms < _Pn)
+		{
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Out[_Lane] = _Sum[_Lane];
+			}
+
+		return;
+		}
+
+	_Ty _Psi = static_cast<_Ty>(-_Euler_gamma);
+	for (unsigned _Ix = 1; _Ix < _Pn; ++_Ix)
+		{
+		_Psi += static_cast<_Ty>(1) / static_cast<_Ty>(_Ix);
+		}
+
+	_Ty _Zero[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Zero[_Lane] = 0;
+		}
+
+	_Ty _Log[_Batch_lanes];
+	_Log_lanes(_Args, _Zero, _Log, _Count);
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Out[_Lane] = _Log_term[_Lane] * (_Psi - _Log[_Lane]) + _Sum[_Lane];
+		}
+	}
+
+template<class _Ty> inline
+	void _Expint_n_fraction_lanes(const unsigned _Pn, const _Ty * const _Args, _Ty * const _Out,
+		const size_t _Count)
+	{	// e^x E_n(x) for each of _Count lanes, x in [1, _Highest] or n = 0, from
+		//	1 / (x + n - 1 n / (x + n + 2 - 2 (n + 1) / (x + n + 4 - ...)))
+		// evaluated from the tail up, which rounds once per term rather than letting the
+		// Lentz quotients accumulate; the error after k terms is near e^-4 sqrt(k x), so
+		// each lane's depth follows from its own x (for n = 0 the fraction ends at 1 / x).
+		// The block runs to the deepest lane, and a lane's tail stays 0 until the loop
+		// reaches its depth, so the result does not depend on the lane's neighbours
+	constexpr bool _Is_float = _Lane_single<_Ty>;
+	constexpr _Ty _Depth_scale = _Is_float ? 24 : 96;
+	constexpr _Ty _Depth_floor = _Is_float ? 6 : 12;
+	const _Ty _Order = static_cast<_Ty>(_Pn);
+	_Ty _Lane_depth[_Batch_lanes];
+	unsigned _Depth = _Pn == 0 ? 1 : 0;
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const unsigned _Own = _Pn == 0 ? 1
+			: static_cast<unsigned>(_Depth_scale / _Args[_Lane] + _Depth_floor);
+		_Lane_depth[_Lane] = static_cast<_Ty>(_Own);
+		_Depth = _Lane_max(_Depth, _Own);
+		}
+
+	_Ty _Tail[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Tail[_Lane] = 0;
+		}
+
+	for (unsigned _Ix = _Depth; 0 < _Ix; --_Ix)
+		{
+		const _Ty _Term = static_cast<_Ty>(_Ix);
+		const _Ty _An = -_Term * (_Order - 1 + _Term);
+		const _Ty _Bn = _Order + 2 * _Term;
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			const _Ty _Next = _An / (_Args[_Lane] + _Bn + _Tail[_Lane]);
+			_Tail[_Lane] = _Term <= _Lane_depth[_Lane] ? _Next : _Ty{0};
+			}
+		}
+
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Out[_Lane] = 1 / (_Args[_Lane] + _Order + _Tail[_Lane]);
+		}
+	}
+
+constexpr double _Zeta_laurent[] =
+	{	// zeta(1 + u) - 1 / u on |u| <= 1: the Stieltjes series economized to degree 13
+	5.7721566490153286030954e-01, 7.2815845483676724887013e-02, -4.8451815964361301397016e-03,
+	-3.4230573671722690080874e-04, 9.6890419394005288557883e-05, -6.6110318108007517840538e-06,
+	-3.3162408808311628581351e-07, 1.0462094559615696449870e-07, -8.7332260722292025771628e-09,
+	9.4783488265594807337629e-11, 5.6595896464414896631806e-11, -6.7697319767407273976665e-12,
+	3.4074195700436715032667e-13, 5.1685295542430947771737e-15,
+	};
+
+constexpr double _Zeta_cutoff = 8;	// the Euler-Maclaurin sum takes n^(-s) directly below N = 8
+
+constexpr double _Zeta_bernoulli[] =
+	{	// B(2j) / (2j)!, j = 1, 2, ..., 10: enough at N = 8 for every s >= 2
+	8.333333333333333333333e-02, -1.388888888888888888889e-03, 3.306878306878306878307e-05,
+	-8.267195767195767195767e-07, 2.087675698786809897921e-08, -5.284190138687493184848e-10,
+	1.338253653068467883283e-11, -3.389680296322582866830e-13, 8.586062056277844564136e-15,
+	-2.174868698558061873042e-16,
+	};
+
+void _Zeta_near_one_lanes(const double * const _Ux, double * const _Out, const size_t _Count)
+	{	// _Zeta_near_one for each of _Count lanes, one coefficient at a time
+	double _Usq[_Batch_lanes];
+	double _Even[_Batch_lanes];
+	double _Odd[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Usq[_Lane] = _Ux[_Lane] * _Ux[_Lane];
+		_Even[_Lane] = 0;
+		_Odd[_Lane] = 0;
+		}
+
+	for (size_t _Idx = sizeof(_Zeta_laurent) / sizeof(double); 0 < _Idx; _Idx -= 2)
+		{
+		const double _Odd_coeff = _Zeta_laurent[_Idx - 1];
+		const double _Even_coeff = _Zeta_laurent[_Idx - 2];
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Odd[_Lane] = _Odd[_Lane] * _Usq[_Lane] + _Odd_coeff;
+			_Even[_Lane] = _Even[_Lane] * _Usq[_Lane] + _Even_coeff;
+			}
+		}
+
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Out[_Lane] = 1 / _Ux[_Lane] + (_Even[_Lane] + _Ux[_Lane] * _Odd[_Lane]);
+		}
+	}
+
+template<class _Ty = double> inline
+	void _Zeta_series_lanes(const double * const _Sx, double * const _Out, const size_t _Count)
+	{	// zeta(s) for 2 < s <= 53 in each of _Count lanes by Euler-Maclaurin at N = 8:
+		// p^(-s) for the primes p < N from _Exp_lanes, the other n^(-s) as their products,
+		// then the tail N^(1-s) / (s - 1) + N^(-s) / 2 + sum B(2j) / (2j)! (s)_(2j-1)
+		// N^(1-s-2j), its rising factorials nested into the sum so that none is formed,
+		// added smallest first. A float result needs only j <= 4, the next term at most
+		// 6e-12 of zeta(s).
+	constexpr double _Log_prime[] =
+		{	// log(p), p = 2, 3, 5, 7
+		6.931471805599453094172e-01, 1.098612288668109691395e+00, 1.609437912434100374601e+00,
+		1.945910149055313305105e+00,
+		};
+
+	double _Power[sizeof(_Log_prime) / sizeof(double)][_Batch_lanes];
+	for (size_t _Prime = 0; _Prime < sizeof(_Log_prime) / sizeof(double); ++_Prime)
+		{
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Power[_Prime][_Lane] = -_Sx[_Lane] * _Log_prime[_Prime];
+			}
+
+		_Exp_lanes(_Power[_Prime], _Power[_Prime], _Count);
+		}
+
+	constexpr size_t _Terms = _Lane_single<_Ty>
+		? 4 : sizeof(_Zeta_bernoulli) / sizeof(double);
+	double _Remainder[_Batch_lanes];
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		_Remainder[_Lane] = _Zeta_bernoulli[_Terms - 1];
+		}
+
+	for (size_t _Idx = _Terms - 1; 0 < _Idx--; )
+		{	// (s)_(2j+1) = (s)_(2j-1) (s + 2j - 1) (s + 2j), j = _Idx + 1
+		const double _Coeff = _Zeta_bernoulli[_Idx];
+		const double _Rise = static_cast<double>(2 * _Idx);
+		for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+			{
+			_Remainder[_Lane] = _Coeff + _Remainder[_Lane]
+				* ((_Sx[_Lane] + (_Rise + 1)) * (_Sx[_Lane] + (_Rise + 2))
+					/ (_Zeta_cutoff * _Zeta_cutoff));
+			}
+		}
+
+	for (size_t _Lane = 0; _Lane < _Count; ++_Lane)
+		{
+		const double _Px = _Sx[_Lane];
+		const double _P2 = _Power[0][_Lane];
+		const double _P3 = _Power[1][_Lane];
+		const double _P4 = _P2 * _P2;
+		const double _P8 = _P4 * _P2;
+		const double _Tail = _P8 * (_Zeta_cutoff / (_Px - 1) + 0.5
+			+ _Px / _Zeta_cutoff * _Remainder[_Lane]);
+		_Out[_Lane] = 1 + (_P2 + (_P3 + (_P4 + (_Power[2][_Lane]
+			+ (_P2 * _P3 + (_Power[3][_Lane] + _Tail))))));
+		}
+	}
+
+template<class _Ty> constexpr
+	void _Fill_lane_kernels(_Lane_kernels<_Ty>& _Kernels) noexcept
+	{	// this build's kernels for _Ty
+	_Kernels._Exp = &_Exp_lanes;
+	_Kernels._Log = &_Log_lanes;
+	_Kernels._Expint_log = &_Expint_log_lanes<_Ty>;
+	_Kernels._Expint_exp = &_Expint_exp_lanes<_Ty>;
+	_Kernels._Expint_n_series = &_Expint_n_series_lanes<_Ty>;
+	_Kernels._Expint_n_fraction = &_Expint_n_fraction_lanes<_Ty>;
+	_Kernels._Carlson_converge[false][false] = &_Carlson_converge_lanes<false, false, _Ty>;
+	_Kernels._Carlson_converge[false][true] = &_Carlson_converge_lanes<false, true, _Ty>;
+	_Kernels._Carlson_converge[true][false] = &_Carlson_converge_lanes<true, false, _Ty>;
+	_Kernels._Carlson_converge[true][true] = &_Carlson_converge_lanes<true, true, _Ty>;
+	_Kernels._Zeta_series = &_Zeta_series_lanes<_Ty>;
+	}
+
+constexpr _Lane_table _Make_lane_table() noexcept
+	{
+	_Lane_table _Table{};
+#if defined(__AVX512F__)
+	_Table._Compiled_isa = 2;	// batch_isa::avx512
+#elif defined(__AVX2__)
+	_Table._Compiled_isa = 1;	// batch_isa::avx2
+#else /* defined(__AVX512F__) */
+	_Table._Compiled_isa = 0;	// batch_isa::scalar
+#endif /* defined(__AVX512F__) */
+	_Fill_lane_kernels<float>(_Table);
+	_Fill_lane_kernels<double>(_Table);
+	_Table._Hermite = &_Hermite_lanes;
+	_Table._Hermite_derivative = &_Hermite_derivative_lanes;
+	_Table._Laguerre = &_Laguerre_lanes;
+	_Table._Laguerre_derivative = &_Laguerre_derivative_lanes;
+	_Table._Legendre = &_Legendre_lanes;
+	_Table._Legendre_derivative = &_Legendre_derivative_lanes;
+	_Table._Hermite_function = &_Hermite_function_lanes;
+	_Table._Lanczos = &_Lanczos_lanes;
+	_Table._Lbeta = &_Lbeta_lanes;
+	_Table._Complete_elliptic_converge = &_Complete_elliptic_converge_lanes;
+	_Table._Complete_third = &_Complete_third_lanes;
+	_Table._Zeta_near_one = &_Zeta_near_one_lanes;
+	return (_Table);
+	}
+
+constexpr _Lane_table _Local_lane_table = _Make_lane_table();	// constant, so no guard or
+																// initialization order
+} // unnamed namespace
+#ifdef _SMF_BATCH_ISA
+
+const _Lane_table& _Isa_lane_table() noexcept
+	{	// this build's kernels, for the batch functions to call
+	return (_Local_lane_table);
+	}
+} // namespace _SMF_BATCH_ISA
+#endif /* _SMF_BATCH_ISA */
+_STD_END
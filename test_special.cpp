@@ -4,8 +4,11 @@
 
 #include <cerrno>
 #include <cmath>
+#include <complex>
 #include <limits>
+#include <thread>
 #include <utility>
+#include <vector>
 #include <boost/array.hpp>
 #include <boost/math/special_functions.hpp>
 #include <boost/math/tools/precision.hpp>
@@ -54,6 +57,189 @@ inline bool equal(Range1&& r1, Range2&& r2) {
     return std::equal(begin(r1), end(r1), begin(r2), end(r2));
 }
 
+template<class T>
+inline bool same_value(T const actual, T const expected) {
+    return actual == expected || (std::isnan(actual) && std::isnan(expected));
+}
+
+// The float forms of the complete and incomplete elliptic integrals, expintf, and
+// cyl_bessel_jf run kernels of their own, rather than rounding Boost's evaluation, and
+// agree with Boost's float result to a couple of ulps. Only their checks use this; every
+// other form and function compares to Boost with BOOST_CHECK_EQUAL.
+template<class T>
+inline bool matches_float_control(T const actual, T const control) {
+    return same_value(actual, control)
+        || (std::is_same_v<T, float> && std::fabs(actual - control) <= 2 * eps<T> * std::fabs(control));
+}
+
+// 203 evenly spaced arguments in [lo, hi] with a NaN among them, so that batch
+// functions see several full blocks, a partial block, and a NaN lane.
+template<class T>
+inline std::vector<T> batch_args(T const lo, T const hi) {
+    std::vector<T> args;
+    for (int i = 0; i <= 202; ++i) {
+        args.push_back(lo + (hi - lo) * i / 202);
+    }
+    args[67] = qNaN<T>;
+    return args;
+}
+
+#if _HAS_CXX20
+namespace array_forms {
+    // 3001 evenly spaced arguments in [lo, hi] with a NaN among them: several chunks of the
+    // array forms and a partial one
+    template<class T>
+    std::vector<T> array_args(T const lo, T const hi) {
+        std::vector<T> args;
+        for (int i = 0; i <= 3000; ++i) {
+            args.push_back(lo + (hi - lo) * i / 3000);
+        }
+        args[1234] = qNaN<T>;
+        return args;
+    }
+
+    template<class>
+    constexpr auto sph_legendre_fn = std::sph_legendrel;
+    template<>
+    constexpr auto sph_legendre_fn<float> = std::sph_legendref;
+    template<>
+    constexpr auto sph_legendre_fn<double> = static_cast<double (*)(unsigned, unsigned, double)>(std::sph_legendre);
+
+    // the array form under each policy and several thread counts against the expected values,
+    // which it must match exactly; the element past the shortest input is left alone
+    template<class T, class Fn>
+    void check_array_form(char const* const name, std::vector<T> const& expected, Fn fn) {
+        for (unsigned const threads : {1u, 3u, 8u}) {
+            std::set_parallel_threads(threads);
+            BOOST_CHECK_EQUAL(std::parallel_threads(), threads);
+            auto const run = [&](auto const& policy, char const* const policy_name) {
+                BOOST_TEST_CONTEXT(name << " under " << policy_name << " on " << threads << " threads") {
+                    std::vector<T> actual(expected.size() + 1, T(-1));
+                    auto const written = fn(policy, std::span<T>{actual});
+                    BOOST_CHECK(written.data() == actual.data());
+                    BOOST_REQUIRE_EQUAL(written.size(), expected.size());
+                    for (std::size_t i = 0; i < expected.size(); ++i) {
+                        BOOST_CHECK(same_value(actual[i], expected[i]));
+                    }
+                    BOOST_CHECK_EQUAL(actual.back(), T(-1));
+                }
+            };
+            run(std::execution::seq, "seq");
+            run(std::execution::unseq, "unseq");
+            run(std::execution::par, "par");
+            run(std::execution::par_unseq, "par_unseq");
+        }
+        std::set_parallel_threads(0);
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_array_forms, T, fptypes) {
+        auto const unit = array_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        auto const positive = array_args<T>(static_cast<T>(0.25), static_cast<T>(30));
+        auto const wide = array_args<T>(static_cast<T>(-20), static_cast<T>(20));
+        std::vector<T> const halves(unit.size(), T(0.5));
+        auto const n = unit.size();
+
+        std::vector<T> expected(n);
+        std::riemann_zeta_batch(wide.data(), wide.data() + n, expected.data());
+        check_array_form("riemann_zeta", expected, [&](auto const& policy, std::span<T> out) {
+            return std::riemann_zeta(policy, wide, out);
+        });
+
+        std::legendre_batch(9, unit.data(), unit.data() + n, expected.data());
+        check_array_form("legendre", expected, [&](auto const& policy, std::span<T> out) {
+            return std::legendre(policy, 9, unit, out);
+        });
+
+        std::carlson_rj_batch(positive.data(), positive.data() + n, halves.data(), positive.data(),
+            halves.data(), expected.data());
+        check_array_form("carlson_rj", expected, [&](auto const& policy, std::span<T> out) {
+            return std::carlson_rj(policy, positive, halves, positive, halves, out);
+        });
+
+        std::lbeta_batch(static_cast<T>(2.5), positive.data(), positive.data() + n, expected.data());
+        check_array_form("lbeta at one a", expected, [&](auto const& policy, std::span<T> out) {
+            return std::lbeta(policy, static_cast<T>(2.5), positive, out);
+        });
+
+        // K and E alone each come from comp_ellint_1_2_batch, the other kind left unstored
+        std::vector<T> second_kind(n);
+        std::comp_ellint_1_2_batch(unit.data(), unit.data() + n, expected.data(), second_kind.data());
+        check_array_form("comp_ellint_1", expected, [&](auto const& policy, std::span<T> out) {
+            return std::comp_ellint_1(policy, unit, out);
+        });
+        check_array_form("comp_ellint_2", second_kind, [&](auto const& policy, std::span<T> out) {
+            return std::comp_ellint_2(policy, unit, out);
+        });
+
+        // forms with no batch function run the scalar one
+        for (std::size_t i = 0; i < n; ++i) {
+            expected[i] = std::hypot(unit[i], positive[i], wide[i]);
+        }
+        check_array_form("hypot", expected, [&](auto const& policy, std::span<T> out) {
+            return std::hypot(policy, unit, positive, wide, out);
+        });
+
+        // a shorter input shortens the result
+        std::vector<T> const short_positive(positive.begin(), positive.begin() + 1500);
+        expected.resize(short_positive.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+            expected[i] = sph_legendre_fn<T>(4, 2, short_positive[i]);
+        }
+        check_array_form("sph_legendre", expected, [&](auto const& policy, std::span<T> out) {
+            return std::sph_legendre(policy, 4, 2, short_positive, out);
+        });
+    }
+
+    BOOST_AUTO_TEST_CASE(test_array_form_concurrent_calls) {
+        // calls from several threads at once share the pool or run alone, with the same results
+        auto const args = array_args<double>(-1, 1);
+        std::vector<double> expected(args.size());
+        std::legendre_batch(9, args.data(), args.data() + args.size(), expected.data());
+        std::set_parallel_threads(4);
+        std::vector<double> out[4];
+        std::vector<std::thread> callers;
+        for (auto& result : out) {
+            result.resize(args.size());
+            callers.emplace_back([&] {
+                for (int pass = 0; pass < 20; ++pass) {
+                    std::legendre(std::execution::par, 9, args, std::span{result});
+                }
+            });
+        }
+        for (auto& caller : callers) {
+            caller.join();
+        }
+        for (auto const& result : out) {
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                BOOST_CHECK(same_value(result[i], expected[i]));
+            }
+        }
+        std::set_parallel_threads(0);
+    }
+
+    BOOST_AUTO_TEST_CASE(test_array_form_errno) {
+        // errno comes back from whichever thread ran the failing chunk, and is otherwise left alone
+        auto args = array_args<double>(-1, 1);
+        args[1234] = 0.5;
+        std::vector<double> out(args.size());
+        for (unsigned const threads : {1u, 4u}) {
+            std::set_parallel_threads(threads);
+            errno = 0;
+            std::assoc_legendre(std::execution::par_unseq, 4, 2, args, std::span{out});
+            BOOST_CHECK(verify_not_domain_error());
+
+            args[2500] = 32;
+            std::assoc_legendre(std::execution::par_unseq, 4, 2, args, std::span{out});
+            BOOST_CHECK(verify_domain_error());
+            BOOST_CHECK(std::isnan(out[2500]));
+            args[2500] = 0.5;
+        }
+        std::set_parallel_threads(0);
+        BOOST_CHECK(std::parallel_threads() >= 1);
+    }
+} // namespace array_forms
+#endif /* _HAS_CXX20 */
+
 namespace assoc_laguerre {
     template<class>
     constexpr auto test_fn = [](unsigned, auto x) {
@@ -62,7 +248,7 @@ namespace assoc_laguerre {
     template<>
     constexpr auto test_fn<float> = std::assoc_laguerref;
     template<>
-    constexpr auto test_fn<double> = std::assoc_laguerre;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, unsigned, double)>(std::assoc_laguerre);
     template<>
     constexpr auto test_fn<long double> = std::assoc_laguerrel;
 
@@ -105,6 +291,206 @@ namespace assoc_laguerre {
         BOOST_CHECK(std::isnan(test_fn<T>(0u, 0u, qNaN<T>)));
         BOOST_CHECK(verify_not_domain_error());
     }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_assoc_laguerre_and_derivative, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(0), static_cast<T>(50));
+        std::vector<T> values(args.size());
+        std::vector<T> derivatives(args.size());
+        for (unsigned const m : {0u, 1u, 5u}) {
+            for (unsigned const n : {0u, 1u, 10u, 50u}) {
+                errno = 0;
+                std::assoc_laguerre_and_derivative_batch(n, m, args.data(), args.data() + args.size(),
+                    values.data(), derivatives.data());
+                BOOST_CHECK(verify_not_domain_error());
+                for (std::size_t i = 0; i < args.size(); ++i) {
+                    auto const scalar = std::assoc_laguerre_and_derivative(n, m, args[i]);
+                    BOOST_CHECK(same_value(scalar.value, test_fn<T>(n, m, args[i])));
+                    BOOST_CHECK(same_value(values[i], scalar.value));
+                    BOOST_CHECK(same_value(derivatives[i], scalar.derivative));
+                }
+            }
+        }
+
+        // d/dx L_n^m(x) = -L_{n-1}^{m+1}(x)
+        auto const tolerance = eps<T> * 100;
+        BOOST_CHECK_EQUAL(std::assoc_laguerre_and_derivative(0u, 3u, static_cast<T>(2)).derivative, static_cast<T>(0));
+        BOOST_CHECK_CLOSE_FRACTION(std::assoc_laguerre_and_derivative(4u, 5u, static_cast<T>(0.5L)).derivative,
+            -test_fn<T>(3, 6, static_cast<T>(0.5L)), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::assoc_laguerre_and_derivative(10u, 1u, static_cast<T>(4.5L)).derivative,
+            -test_fn<T>(9, 2, static_cast<T>(4.5L)), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::assoc_laguerre_and_derivative(10u, 6u, static_cast<T>(8.5L)).derivative,
+            -test_fn<T>(9, 7, static_cast<T>(8.5L)), tolerance);
+
+        auto const nan = std::assoc_laguerre_and_derivative(2u, 1u, qNaN<T>);
+        BOOST_CHECK(std::isnan(nan.value) && std::isnan(nan.derivative));
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
+    static_assert(std::assoc_laguerre<0, 3>(2.0) == 1.0);
+    static_assert(std::assoc_laguerre<1, 3>(2.0) == 2.0);
+    static_assert(std::assoc_laguerre<2, 1>(3) == -1.5);
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_fixed_assoc_laguerre, T, fptypes) {
+        auto const tolerance = eps<T> * 100;
+        BOOST_CHECK_CLOSE_FRACTION((std::assoc_laguerre<4, 5>(static_cast<T>(0.5L))),
+            static_cast<T>(88.31510416666666666666666666666666666667L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION((std::assoc_laguerre<10, 0>(static_cast<T>(2.5L))),
+            static_cast<T>(-0.8802526766660982969576719576719576719577L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION((std::assoc_laguerre<10, 1>(static_cast<T>(4.5L))),
+            static_cast<T>(1.564311458042689732142857142857142857143L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION((std::assoc_laguerre<10, 6>(static_cast<T>(8.5L))),
+            static_cast<T>(20.51596541066649098875661375661375661376L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION((std::assoc_laguerre<10, 12>(static_cast<T>(12.5L))),
+            static_cast<T>(-199.5560968456234671241181657848324514991L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION((std::assoc_laguerre<50, 40>(static_cast<T>(12.5L))),
+            static_cast<T>(-4.996769495006119488583146995907246595400e16L), tolerance);
+        BOOST_CHECK(std::isnan(std::assoc_laguerre<0, 0>(qNaN<T>)));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_assoc_laguerre_sequence, T, fptypes) {
+        std::vector<T> sequence(61);
+        std::vector<T> table(61 * 8);
+        for (T const x : {static_cast<T>(0), static_cast<T>(0.5L), static_cast<T>(3), static_cast<T>(12.5L),
+                 static_cast<T>(-2), static_cast<T>(80)}) {
+            errno = 0;
+            for (unsigned const m : {0u, 1u, 5u, 12u}) {
+                BOOST_CHECK(std::assoc_laguerre_sequence(60, m, x, sequence.data()) == sequence.data() + 61);
+                for (unsigned n = 0; n <= 60; ++n) {
+                    BOOST_CHECK(same_value(sequence[n], test_fn<T>(n, m, x)));
+                }
+            }
+
+            BOOST_CHECK(std::assoc_laguerre_table(60, 7, x, table.data()) == table.data() + table.size());
+            for (unsigned m = 0; m <= 7; ++m) {
+                for (unsigned n = 0; n <= 60; ++n) {
+                    BOOST_CHECK(same_value(table[m * 61 + n], test_fn<T>(n, m, x)));
+                }
+            }
+            BOOST_CHECK(verify_not_domain_error());
+        }
+
+        T single;
+        BOOST_CHECK(std::assoc_laguerre_sequence(0, 3, static_cast<T>(2), &single) == &single + 1);
+        BOOST_CHECK_EQUAL(single, static_cast<T>(1));
+        BOOST_CHECK(std::assoc_laguerre_table(0, 0, static_cast<T>(2), &single) == &single + 1);
+        BOOST_CHECK_EQUAL(single, static_cast<T>(1));
+
+        std::assoc_laguerre_table(3, 2, qNaN<T>, table.data());
+        for (int k = 0; k < 12; ++k) {
+            BOOST_CHECK(std::isnan(table[k]));
+        }
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
+    // R_p^m(r) from its definition, where the factorials and powers do not overflow
+    double laguerre_gauss_profile(unsigned const p, unsigned const m, double const w, double const r) {
+        double const pi = boost::math::constants::pi<double>();
+        double const u = 2 * r * r / (w * w);
+        return std::sqrt(2 * std::tgamma(p + 1.0) / (pi * std::tgamma(p + m + 1.0))) / w
+            * std::pow(std::sqrt(u), m) * std::assoc_laguerre(p, m, u) * std::exp(-u / 2);
+    }
+
+    BOOST_AUTO_TEST_CASE(test_laguerre_gauss_radial) {
+        double const w = 1.5;
+        std::vector<double> radii;
+        for (int k = 0; k <= 100; ++k) {
+            radii.push_back(0.05 * k);
+        }
+        for (unsigned const m : {0u, 1u, 4u, 9u}) {
+            std::vector<double> profiles(21 * radii.size());
+            BOOST_CHECK(std::laguerre_gauss_radial(20, m, w, radii.data(), radii.data() + radii.size(), profiles.data())
+                == profiles.data() + profiles.size());
+            for (unsigned p = 0; p <= 20; ++p) {
+                for (std::size_t k = 0; k < radii.size(); ++k) {
+                    BOOST_CHECK_SMALL(profiles[p * radii.size() + k] - laguerre_gauss_profile(p, m, w, radii[k]), 1e-13);
+                }
+            }
+        }
+
+        // unit power: 2 pi int R_p R_q r dr = delta_pq, which in u = 2r^2/w^2 is a
+        // Gauss-Laguerre sum with alpha = m once e^{-u} u^m is divided back out
+        unsigned const m = 3;
+        auto const rule = std::gauss_laguerre_rule(40, m);
+        std::vector<double> radii_at_nodes;
+        for (std::size_t i = 0; i < rule.size; ++i) {
+            radii_at_nodes.push_back(w * std::sqrt(rule.nodes[i] / 2));
+        }
+        std::vector<double> profiles(31 * rule.size);
+        std::laguerre_gauss_radial(30, m, w, radii_at_nodes.data(), radii_at_nodes.data() + rule.size, profiles.data());
+        for (unsigned p = 0; p <= 30; p += 5) {
+            for (unsigned q = p; q <= 30; q += 3) {
+                double sum = 0;
+                for (std::size_t i = 0; i < rule.size; ++i) {
+                    sum += rule.weights[i] * std::exp(rule.nodes[i]) / std::pow(rule.nodes[i], m)
+                        * profiles[p * rule.size + i] * profiles[q * rule.size + i];
+                }
+                BOOST_CHECK_SMALL(boost::math::constants::pi<double>() * w * w / 2 * sum - (p == q), 1e-13);
+            }
+        }
+
+        // e^{-r^2/w^2} underflows at r = 27w, but R_500 is O(1) out to r ~ 32w and only
+        // decays past it
+        double const far[] = {30.0, 40.0};
+        double deep[2 * 501];
+        std::laguerre_gauss_radial(500, 2, 1.0, far, far + 2, deep);
+        BOOST_CHECK_GT(std::abs(deep[2 * 500]), 1e-6);
+        BOOST_CHECK_LT(std::abs(deep[2 * 500]), 1.0);
+        BOOST_CHECK_LT(std::abs(deep[2 * 500 + 1]), 1e-100);
+        BOOST_CHECK_NE(deep[2 * 500 + 1], 0.0);
+    }
+
+    BOOST_AUTO_TEST_CASE(test_laguerre_gauss_modes) {
+        double const w = 2.0;
+        std::vector<double> xs;
+        for (int i = -20; i <= 20; ++i) {
+            xs.push_back(0.25 * i);
+        }
+        std::vector<double> const ys = {-3.0, -1.0, 0.0, 0.5, 1.0, 2.25, 3.0};
+        std::size_t const plane = xs.size() * ys.size();
+        for (int const l : {0, 1, -2, 5}) {
+            std::vector<std::complex<double>> modes(7 * plane);
+            std::laguerre_gauss_modes(6, l, w, xs.data(), xs.data() + xs.size(), ys.data(), ys.data() + ys.size(),
+                modes.data());
+            for (unsigned p = 0; p <= 6; ++p) {
+                for (std::size_t j = 0; j < ys.size(); ++j) {
+                    for (std::size_t i = 0; i < xs.size(); ++i) {
+                        double const r = std::sqrt(xs[i] * xs[i] + ys[j] * ys[j]);
+                        double const phi = std::atan2(ys[j], xs[i]);
+                        double const profile = laguerre_gauss_profile(p, std::abs(l), w, r);
+                        auto const actual = modes[p * plane + j * xs.size() + i];
+                        BOOST_CHECK_SMALL(actual.real() - profile * std::cos(l * phi), 1e-13);
+                        BOOST_CHECK_SMALL(actual.imag() - profile * std::sin(l * phi), 1e-13);
+                    }
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(test_laguerre_gauss_boundaries) {
+        double const radii[] = {1.0, -1.0, qNaN<double>};
+        double profiles[2 * 3];
+        errno = 0;
+        std::laguerre_gauss_radial(1, 1, 1.0, radii, radii + 3, profiles);
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isfinite(profiles[0]) && std::isnan(profiles[1]) && std::isnan(profiles[2]));
+        std::laguerre_gauss_radial(1, 1, 1.0, radii + 2, radii + 3, profiles);
+        BOOST_CHECK(verify_not_domain_error());
+        BOOST_CHECK(std::isnan(profiles[0]) && std::isnan(profiles[1]));
+        std::laguerre_gauss_radial(1, 1, 0.0, radii, radii + 1, profiles);
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(profiles[0]) && std::isnan(profiles[1]));
+
+        std::complex<double> modes[2];
+        std::laguerre_gauss_modes(0, 1, -1.0, radii, radii + 1, radii, radii + 2, modes);
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(modes[0].real()) && std::isnan(modes[1].imag()));
+
+        double const axis[] = {qNaN<double>, 1.0};
+        std::complex<double> grid[4];
+        std::laguerre_gauss_modes(0, 1, 1.0, axis, axis + 2, axis, axis + 2, grid);
+        BOOST_CHECK(std::isnan(grid[0].real()) && std::isnan(grid[1].real()) && std::isnan(grid[2].real()));
+        BOOST_CHECK(std::isfinite(grid[3].real()) && std::isfinite(grid[3].imag()));
+    }
 } // namespace assoc_laguerre
 
 namespace assoc_legendre {
@@ -115,7 +501,7 @@ namespace assoc_legendre {
     template<>
     constexpr auto test_fn<float> = std::assoc_legendref;
     template<>
-    constexpr auto test_fn<double> = std::assoc_legendre;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, unsigned, double)>(std::assoc_legendre);
     template<>
     constexpr auto test_fn<long double> = std::assoc_legendrel;
 
@@ -197,8 +583,143 @@ namespace assoc_legendre {
         BOOST_CHECK(std::isnan(test_fn<T>(4, 2, static_cast<T>(-32))));
         BOOST_CHECK(verify_domain_error());
     }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_assoc_legendre_and_derivative, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        std::vector<T> values(args.size());
+        std::vector<T> derivatives(args.size());
+        for (unsigned const m : {0u, 1u, 2u, 5u}) {
+            for (unsigned const l : {0u, 1u, 4u, 20u, static_cast<unsigned>(-8)}) {
+                errno = 0;
+                std::assoc_legendre_and_derivative_batch(l, m, args.data(), args.data() + args.size(),
+                    values.data(), derivatives.data());
+                BOOST_CHECK(verify_not_domain_error());
+                for (std::size_t i = 0; i < args.size(); ++i) {
+                    auto const scalar = std::assoc_legendre_and_derivative(l, m, args[i]);
+                    auto const expected = test_fn<T>(l, m, args[i]);
+                    if (!same_value(scalar.value, expected))
+                        BOOST_CHECK_SMALL(scalar.value - expected, 100 * eps<T> * (1 + std::abs(expected)));
+                    BOOST_CHECK(same_value(values[i], scalar.value));
+                    BOOST_CHECK(same_value(derivatives[i], scalar.derivative));
+                }
+            }
+        }
+
+        // P_4^2(x) = 15/2 (7x^2 - 1)(1 - x^2), P_4^{-2}(x) = P_4^2(x) / 360
+        auto const tolerance = eps<T> * 100;
+        BOOST_CHECK_CLOSE_FRACTION(std::assoc_legendre_and_derivative(4u, 2u, static_cast<T>(0.5L)).derivative,
+            static_cast<T>(33.75L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::assoc_legendre_and_derivative(4u, 2u, static_cast<T>(-0.5L)).derivative,
+            static_cast<T>(-33.75L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::assoc_legendre_and_derivative(4u, -2, static_cast<T>(0.5L)).derivative,
+            static_cast<T>(0.09375L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::assoc_legendre_and_derivative(4u, 2u, static_cast<T>(1)).derivative,
+            static_cast<T>(-90), tolerance);
+        BOOST_CHECK_EQUAL(std::assoc_legendre_and_derivative(2u, 5u, static_cast<T>(0.5L)).derivative, static_cast<T>(0));
+
+        // for m == 1 the slope is infinite at the ends of the interval
+        BOOST_CHECK_EQUAL(std::assoc_legendre_and_derivative(3u, 1u, static_cast<T>(1)).derivative,
+            std::numeric_limits<T>::infinity());
+        BOOST_CHECK_EQUAL(std::assoc_legendre_and_derivative(3u, 1u, static_cast<T>(-1)).derivative,
+            -std::numeric_limits<T>::infinity());
+        BOOST_CHECK(verify_not_domain_error());
+
+        // domain is |x| <= 1
+        auto const outside = std::assoc_legendre_and_derivative(4u, 2u, static_cast<T>(32));
+        BOOST_CHECK(std::isnan(outside.value) && std::isnan(outside.derivative));
+        BOOST_CHECK(verify_domain_error());
+    }
 } // namespace assoc_legendre
 
+namespace batch_isa {
+    // the results of one batch function under every instruction set this machine runs, each
+    // against the scalar build: /fp:precise contracts nothing into FMAs, so the wider vectors
+    // change only how many lanes run at once, and the results match exactly
+    template<class T, class Fn>
+    void check_every_isa(char const* const name, Fn fn) {
+        auto const initial = std::current_batch_isa();
+        BOOST_REQUIRE(std::set_batch_isa(std::batch_isa::scalar));
+        std::vector<T> expected;
+        fn(expected);
+        for (auto const isa : {std::batch_isa::avx2, std::batch_isa::avx512}) {
+            if (!std::batch_isa_available(isa)) {
+                BOOST_CHECK(!std::set_batch_isa(isa));
+                continue;
+            }
+
+            BOOST_TEST_CONTEXT(name << " under batch_isa " << static_cast<int>(isa)) {
+                BOOST_REQUIRE(std::set_batch_isa(isa));
+                BOOST_CHECK(std::current_batch_isa() == isa);
+                // a distinct build, not the baseline kernels again for want of the ISA flags
+                BOOST_CHECK(std::batch_isa_compiled(isa) == isa);
+                std::vector<T> actual;
+                fn(actual);
+                BOOST_REQUIRE_EQUAL(actual.size(), expected.size());
+                for (std::size_t i = 0; i < expected.size(); ++i) {
+                    BOOST_CHECK(same_value(actual[i], expected[i]));
+                }
+            }
+        }
+        BOOST_CHECK(std::set_batch_isa(initial));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_batch_isa, T, fptypes) {
+        BOOST_CHECK(std::batch_isa_available(std::batch_isa::scalar));
+        if (std::batch_isa_available(std::batch_isa::avx512)) {
+            BOOST_CHECK(std::batch_isa_available(std::batch_isa::avx2));
+        }
+
+        auto const unit = batch_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        auto const positive = batch_args<T>(static_cast<T>(0.25), static_cast<T>(30));
+        auto const wide = batch_args<T>(static_cast<T>(-20), static_cast<T>(20));
+        std::vector<T> const ones(unit.size(), T(1));
+        std::vector<T> const halves(unit.size(), T(0.5));
+        auto const n = unit.size();
+
+        check_every_isa<T>("carlson_rf_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::carlson_rf_batch(positive.data(), positive.data() + n, ones.data(), positive.data(), out.data());
+        });
+        check_every_isa<T>("carlson_rj_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::carlson_rj_batch(positive.data(), positive.data() + n, ones.data(), positive.data(), halves.data(),
+                out.data());
+        });
+        check_every_isa<T>("ellint_2_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::ellint_2_batch(unit.data(), unit.data() + n, wide.data(), out.data());
+        });
+        check_every_isa<T>("comp_ellint_1_2_batch", [&](std::vector<T>& out) {
+            out.resize(2 * n);
+            std::comp_ellint_1_2_batch(unit.data(), unit.data() + n, out.data(), out.data() + n);
+        });
+        check_every_isa<T>("legendre_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::legendre_batch(7, unit.data(), unit.data() + n, out.data());
+        });
+        check_every_isa<T>("hermite_function_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::hermite_function_batch(12, wide.data(), wide.data() + n, out.data());
+        });
+        check_every_isa<T>("laguerre_and_derivative_batch", [&](std::vector<T>& out) {
+            out.resize(2 * n);
+            std::laguerre_and_derivative_batch(5, positive.data(), positive.data() + n, out.data(), out.data() + n);
+        });
+        check_every_isa<T>("expint_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::expint_batch(wide.data(), wide.data() + n, out.data());
+        });
+        check_every_isa<T>("lbeta_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::lbeta_batch(positive.data(), positive.data() + n, halves.data(), out.data());
+        });
+        check_every_isa<T>("riemann_zeta_batch", [&](std::vector<T>& out) {
+            out.resize(n);
+            std::riemann_zeta_batch(wide.data(), wide.data() + n, out.data());
+        });
+    }
+} // namespace batch_isa
+
 namespace beta {
     template<class T>
     constexpr auto control_fn = [](T x, T y) {
@@ -212,7 +733,7 @@ namespace beta {
     template<>
     constexpr auto test_fn<float> = std::betaf;
     template<>
-    constexpr auto test_fn<double> = std::beta;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::beta);
     template<>
     constexpr auto test_fn<long double> = std::betal;
 
@@ -272,8 +793,219 @@ namespace beta {
             static_cast<T>(1.99999999999999999999999999999999999999967101e20L), tolerance);
         BOOST_CHECK(verify_not_domain_error());
     }
+
+    template<class T>
+    constexpr auto log_fn = [](auto x, T) {
+        static_assert(always_false<decltype(x)>);
+    };
+    template<>
+    constexpr auto log_fn<float> = std::lbetaf;
+    template<>
+    constexpr auto log_fn<double> = static_cast<double (*)(double, double)>(std::lbeta);
+    template<>
+    constexpr auto log_fn<long double> = std::lbetal;
+
+    // log B is near 0 along a curve through (1, 1), where only absolute accuracy is meaningful
+    template<class T>
+    inline T log_error(T const actual, T const expected) {
+        return std::abs(actual - expected) / std::max(std::abs(expected), static_cast<T>(1));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_lbeta_spots, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        BOOST_CHECK_EQUAL(log_fn<T>(static_cast<T>(1), static_cast<T>(1)), static_cast<T>(0));
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(4), static_cast<T>(20)),
+            static_cast<T>(-10.4750319113368245334092727293610459235777735L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(0.5L), static_cast<T>(0.5L)),
+            static_cast<T>(1.14472988584940017414342735135305871164729481L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(30), static_cast<T>(40)),
+            static_cast<T>(-48.3017490959161251959946825632252828707029429L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(20.5L), static_cast<T>(7.5L)),
+            static_cast<T>(-16.1916734157167999940168629306464260780191229L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(0.0125L), static_cast<T>(0.000023L)),
+            static_cast<T>(10.6818541826698837389811665292751002325178093L), 4 * tolerance);
+
+        // where B itself underflows or overflows
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(1000), static_cast<T>(1000)),
+            static_cast<T>(-1388.48260163590225029577311882040252087517418L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(1000), static_cast<T>(250)),
+            static_cast<T>(-627.232899572983327533542287359429962270643121L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(2.75L), static_cast<T>(1e10L)),
+            static_cast<T>(-62.8458753906619441801636156624265168603086397L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(1e30L), static_cast<T>(3)),
+            static_cast<T>(-206.539511188904166252201998800137602116023634L), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(1e-20L), static_cast<T>(1e-20L)),
+            static_cast<T>(46.7448490404408590446237897609358905724496778L), 4 * tolerance);
+        T const small = static_cast<T>(std::max(static_cast<double>(std::numeric_limits<T>::denorm_min()),
+            std::numeric_limits<double>::denorm_min()));
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(static_cast<T>(4), small), -std::log(small), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(log_fn<T>(small, small), std::log(static_cast<T>(2)) - std::log(small),
+            4 * tolerance);
+
+        // agrees with log B wherever B is representable
+        for (T const x : {static_cast<T>(0.25L), static_cast<T>(1.5L), static_cast<T>(7), static_cast<T>(33.3L)}) {
+            for (T const y : {static_cast<T>(0.001L), static_cast<T>(2), static_cast<T>(9.5L), static_cast<T>(120)}) {
+                BOOST_CHECK_SMALL(log_error(log_fn<T>(x, y), std::log(test_fn<T>(x, y))), 128 * tolerance);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_lbeta_boundaries, T, fptypes) {
+        errno = 0;
+        BOOST_CHECK(std::isnan(log_fn<T>(static_cast<T>(1), qNaN<T>)));
+        BOOST_CHECK(std::isnan(log_fn<T>(qNaN<T>, static_cast<T>(1))));
+        BOOST_CHECK(verify_not_domain_error());
+        BOOST_CHECK_EQUAL(log_fn<T>(inf<T>, static_cast<T>(2)), -inf<T>);
+        BOOST_CHECK_EQUAL(log_fn<T>(static_cast<T>(0.5L), inf<T>), -inf<T>);
+        BOOST_CHECK(verify_not_domain_error());
+
+        // domain is x > 0 && y > 0
+        BOOST_CHECK(std::isnan(log_fn<T>(static_cast<T>(1), static_cast<T>(0))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(log_fn<T>(static_cast<T>(-2), static_cast<T>(1))));
+        BOOST_CHECK(verify_domain_error());
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_lbeta_batch, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        // half-integers, which the table takes when their sum is also in it, interleaved with
+        // the Lanczos form, a pair for the scalar path, and a NaN lane
+        auto const halves = batch_args<T>(static_cast<T>(0.5L), static_cast<T>(101.5L));
+        auto const general = batch_args<T>(static_cast<T>(0.01L), static_cast<T>(250));
+        std::vector<T> as;
+        std::vector<T> bs;
+        for (std::size_t i = 0; i < halves.size(); ++i) {
+            as.push_back(halves[i]);
+            bs.push_back(halves[halves.size() - 1 - i]);
+            as.push_back(halves[i]);
+            bs.push_back(general[i]);
+            as.push_back(general[i]);
+            bs.push_back(static_cast<T>(i % 7 == 0 ? 0 : 1e-20L));
+        }
+        std::vector<T> actual(as.size());
+
+        errno = 0;
+        BOOST_CHECK(std::lbeta_batch(as.data(), as.data() + as.size(), bs.data(), actual.data())
+            == actual.data() + actual.size());
+        BOOST_CHECK(verify_domain_error());
+        for (std::size_t i = 0; i < as.size(); ++i) {
+            T const expected = log_fn<T>(as[i], bs[i]);
+            if (std::isfinite(expected)) {
+                BOOST_CHECK_SMALL(log_error(actual[i], expected), 8 * tolerance);
+            } else {    // NaN
+                BOOST_CHECK(same_value(actual[i], expected));
+            }
+        }
+
+        // the same b against one a, whose terms the batch evaluates once
+        for (T const a : {static_cast<T>(3), static_cast<T>(0.37L), static_cast<T>(0), qNaN<T>}) {
+            BOOST_CHECK(std::lbeta_batch(a, general.data(), general.data() + general.size(), actual.data())
+                == actual.data() + general.size());
+            for (std::size_t i = 0; i < general.size(); ++i) {
+                T const expected = log_fn<T>(a, general[i]);
+                if (std::isfinite(expected)) {
+                    BOOST_CHECK_SMALL(log_error(actual[i], expected), 8 * tolerance);
+                } else {
+                    BOOST_CHECK(same_value(actual[i], expected));
+                }
+            }
+        }
+    }
 } // namespace beta
 
+namespace carlson {
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_carlson, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        // Carlson's (1995) test values
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rf(T(1), T(2), T(0)), SC_(1.31102877714605990523242), 2 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rf(T(2), T(3), T(4)), SC_(0.5840828416771517066928492), 2 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rd(T(0), T(2), T(1)), SC_(1.797210352103388311159884), 2 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rd(T(2), T(3), T(4)), SC_(0.1651052729426105334867134), 2 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rj(T(0), T(1), T(2), T(3)), SC_(0.7768862377858233201419028), 2 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rj(T(2), T(3), T(4), T(5)), SC_(0.1429757966715675383323388), 2 * tolerance);
+        // a Cauchy principal value
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rj(T(2), T(3), T(4), T(-0.5)), SC_(0.247238197030515649016798), 4 * tolerance);
+
+        // R_F(x, y, y) = R_C(x, y), and R_D(x, x, x) = x^(-3/2)
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rf(T(0), T(1), T(1)), boost::math::constants::half_pi<T>(), 2 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rd(T(4), T(4), T(4)), T(0.125), 2 * tolerance);
+
+        for (T const x : {T(0), T(0.25), T(3)}) {
+            for (T const y : {T(0.5), T(7)}) {
+                for (T const z : {T(1e-6), T(1), T(40)}) {
+                    BOOST_CHECK_CLOSE_FRACTION(std::carlson_rf(x, y, z), boost::math::ellint_rf(x, y, z), 4 * tolerance);
+                    BOOST_CHECK_CLOSE_FRACTION(std::carlson_rd(x, y, z), boost::math::ellint_rd(x, y, z), 4 * tolerance);
+                    for (T const p : {T(1e-4), T(2), T(100)}) {
+                        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rj(x, y, z, p), boost::math::ellint_rj(x, y, z, p), 8 * tolerance);
+                    }
+                }
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_carlson_batch, T, fptypes) {
+        auto const x = batch_args<T>(static_cast<T>(0), static_cast<T>(5));
+        auto y = batch_args<T>(static_cast<T>(0.01), static_cast<T>(30));
+        std::reverse(y.begin(), y.end());
+        std::vector<T> const z(x.size(), static_cast<T>(2));
+        auto const p = batch_args<T>(static_cast<T>(0.001), static_cast<T>(9));
+        std::vector<T> out(x.size());
+
+        errno = 0;
+        BOOST_CHECK(std::carlson_rf_batch(x.data(), x.data() + x.size(), y.data(), z.data(), out.data()) == out.data() + out.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            BOOST_CHECK(same_value(out[i], std::carlson_rf(x[i], y[i], z[i])));
+        }
+        BOOST_CHECK(std::carlson_rd_batch(x.data(), x.data() + x.size(), y.data(), z.data(), out.data()) == out.data() + out.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            BOOST_CHECK(same_value(out[i], std::carlson_rd(x[i], y[i], z[i])));
+        }
+        BOOST_CHECK(std::carlson_rj_batch(x.data(), x.data() + x.size(), y.data(), z.data(), p.data(), out.data()) == out.data() + out.size());
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            BOOST_CHECK(same_value(out[i], std::carlson_rj(x[i], y[i], z[i], p[i])));
+        }
+        BOOST_CHECK(verify_not_domain_error());
+
+        T const bad[] = {T(1), T(-1)};
+        std::carlson_rf_batch(bad, bad + 2, z.data(), z.data(), out.data());
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(!std::isnan(out[0]) && std::isnan(out[1]));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_carlson_boundaries, T, fptypes) {
+        errno = 0;
+        BOOST_CHECK(std::isnan(std::carlson_rf(qNaN<T>, T(1), T(1))));
+        BOOST_CHECK(std::isnan(std::carlson_rd(T(1), qNaN<T>, T(1))));
+        BOOST_CHECK(std::isnan(std::carlson_rj(T(1), T(1), T(1), qNaN<T>)));
+        BOOST_CHECK(verify_not_domain_error());
+
+        // arguments are nonnegative, at most one of x, y, z is zero, and R_D needs z > 0
+        BOOST_CHECK(std::isnan(std::carlson_rf(T(-1), T(1), T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(std::carlson_rf(T(0), T(0), T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(std::carlson_rd(T(1), T(1), T(0))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(std::carlson_rd(T(0), T(0), T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(std::carlson_rj(T(1), T(1), T(1), T(0))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(std::carlson_rj(T(0), T(1), T(0), T(1))));
+        BOOST_CHECK(verify_domain_error());
+
+        // arguments far from 1 still give finite, homogeneous results
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+        BOOST_CHECK_CLOSE_FRACTION(std::carlson_rf(T(1e30), T(2e30), T(0)) * T(1e15), SC_(1.31102877714605990523242), 4 * tolerance);
+        BOOST_CHECK(verify_not_domain_error());
+    }
+} // namespace carlson
+
 namespace comp_ellint_1 {
     template<class T>
     constexpr auto control_fn = [](T k) {
@@ -287,7 +1019,7 @@ namespace comp_ellint_1 {
     template<>
     constexpr auto test_fn<float> = std::comp_ellint_1f;
     template<>
-    constexpr auto test_fn<double> = std::comp_ellint_1;
+    constexpr auto test_fn<double> = static_cast<double (*)(double)>(std::comp_ellint_1);
     template<>
     constexpr auto test_fn<long double> = std::comp_ellint_1l;
 
@@ -310,7 +1042,7 @@ namespace comp_ellint_1 {
         auto const tester = [](T tolerance) {
             return [tolerance](auto const& datum) {
                 auto const actual = test_fn<T>(datum[0]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[0]));
+                BOOST_CHECK(matches_float_control(actual, control_fn<T>(datum[0])));
                 BOOST_CHECK_CLOSE_FRACTION(actual, datum[1], tolerance);
             };
         };
@@ -352,7 +1084,7 @@ namespace comp_ellint_2 {
     template<>
     constexpr auto test_fn<float> = std::comp_ellint_2f;
     template<>
-    constexpr auto test_fn<double> = std::comp_ellint_2;
+    constexpr auto test_fn<double> = static_cast<double (*)(double)>(std::comp_ellint_2);
     template<>
     constexpr auto test_fn<long double> = std::comp_ellint_2l;
 
@@ -376,7 +1108,7 @@ namespace comp_ellint_2 {
         auto const tester = [](T tolerance) {
             return [tolerance](auto const& datum) {
                 auto const actual = test_fn<T>(datum[0]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[0]));
+                BOOST_CHECK(matches_float_control(actual, control_fn<T>(datum[0])));
                 BOOST_CHECK_CLOSE_FRACTION(actual, datum[1], tolerance);
             };
         };
@@ -405,6 +1137,79 @@ namespace comp_ellint_2 {
     }
 } // namespace comp_ellint_2
 
+namespace comp_ellint_1_2 {
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_comp_ellint_1_2, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        {
+#include "math/test/ellint_k_data.ipp"
+            ::for_each(ellint_k_data, [tolerance](auto const& datum) {
+                BOOST_CHECK_CLOSE_FRACTION(std::comp_ellint_1_2(datum[0]).first_kind, datum[1], tolerance);
+            });
+        }
+        {
+#include "math/test/ellint_e_data.ipp"
+            ::for_each(ellint_e_data, [tolerance](auto const& datum) {
+                BOOST_CHECK_CLOSE_FRACTION(std::comp_ellint_1_2(datum[0]).second_kind, datum[1], 2 * tolerance);
+            });
+        }
+
+        // From function test_spots in test_ellint_1.hpp and test_ellint_2.hpp:
+        auto const both = std::comp_ellint_1_2(SC_(-0.5));
+        BOOST_CHECK_CLOSE_FRACTION(both.first_kind, SC_(1.6857503548125960428712036577990769895008008941411), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(both.second_kind,
+            SC_(1.4674622093394271554597952669909161360253617523272), 2 * tolerance);
+
+        // Legendre's relation E K' + E' K - K K' = pi/2, out to where 1 - k^2 cancels
+        for (T const k : {static_cast<T>(0.5), static_cast<T>(0.999), 1 - 64 * tolerance}) {
+            auto const x = std::comp_ellint_1_2(k);
+            auto const y = std::comp_ellint_1_2(std::sqrt((1 - k) * (1 + k)));
+            T const lhs = x.second_kind * y.first_kind + y.second_kind * x.first_kind - x.first_kind * y.first_kind;
+            BOOST_CHECK_CLOSE_FRACTION(lhs, boost::math::constants::half_pi<T>(), 16 * tolerance);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_comp_ellint_1_2_batch, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        std::vector<T> first_kind(args.size());
+        std::vector<T> second_kind(args.size());
+
+        errno = 0;
+        std::comp_ellint_1_2_batch(args.data(), args.data() + args.size(), first_kind.data(), second_kind.data());
+        BOOST_CHECK(verify_not_domain_error());
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            auto const expected = std::comp_ellint_1_2(args[i]);
+            BOOST_CHECK(same_value(first_kind[i], expected.first_kind));
+            BOOST_CHECK(same_value(second_kind[i], expected.second_kind));
+        }
+
+        T const bad[] = {static_cast<T>(0.5), static_cast<T>(-2)};
+        std::comp_ellint_1_2_batch(bad, bad + 2, first_kind.data(), second_kind.data());
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(first_kind[1]) && std::isnan(second_kind[1]));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_comp_ellint_1_2_boundaries, T, fptypes) {
+        errno = 0;
+        BOOST_CHECK(std::isnan(std::comp_ellint_1_2(qNaN<T>).first_kind));
+        BOOST_CHECK(std::isnan(std::comp_ellint_1_2(qNaN<T>).second_kind));
+        BOOST_CHECK(verify_not_domain_error());
+
+        // domain is |k| <= 1
+        BOOST_CHECK(std::isnan(std::comp_ellint_1_2(static_cast<T>(2)).first_kind));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(std::comp_ellint_1_2(static_cast<T>(-2)).second_kind));
+        BOOST_CHECK(verify_domain_error());
+
+        BOOST_CHECK_EQUAL(std::comp_ellint_1_2(static_cast<T>(1)).first_kind, inf<T>);
+        BOOST_CHECK_EQUAL(std::comp_ellint_1_2(static_cast<T>(-1)).second_kind, static_cast<T>(1));
+        BOOST_CHECK(verify_not_domain_error());
+
+        BOOST_CHECK_EQUAL(std::comp_ellint_1_2(static_cast<T>(0)).first_kind, std::comp_ellint_1_2(static_cast<T>(0)).second_kind);
+    }
+} // namespace comp_ellint_1_2
+
 namespace comp_ellint_3 {
     template<class T>
     constexpr auto control_fn = [](T k, T nu) {
@@ -418,7 +1223,7 @@ namespace comp_ellint_3 {
     template<>
     constexpr auto test_fn<float> = std::comp_ellint_3f;
     template<>
-    constexpr auto test_fn<double> = std::comp_ellint_3;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::comp_ellint_3);
     template<>
     constexpr auto test_fn<long double> = std::comp_ellint_3l;
 
@@ -452,6 +1257,13 @@ namespace comp_ellint_3 {
                 auto const actual = test_fn<T>(datum[1], datum[0]);
                 BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[1], datum[0]));
                 BOOST_CHECK_CLOSE_FRACTION(actual, datum[2], tolerance);
+
+                // the sweep, evaluated in double for long double
+                T const nu = datum[0];
+                T swept;
+                std::comp_ellint_3_batch(static_cast<T>(datum[1]), &nu, &nu + 1, &swept);
+                BOOST_CHECK_CLOSE_FRACTION(swept, datum[2],
+                    4 * static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>)));
             };
         };
 
@@ -459,6 +1271,41 @@ namespace comp_ellint_3 {
         ::for_each(ellint_pi2_data, tester(3 * eps<T>));
     }
 
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_comp_ellint_3_batch, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        // characteristics up to and including 1, crowding toward it at the end
+        auto nu = batch_args<T>(static_cast<T>(-10), static_cast<T>(1));
+        for (int i = 1; i <= std::min(std::numeric_limits<T>::digits, std::numeric_limits<double>::digits); ++i) {
+            nu.insert(nu.end() - 1, 1 - std::ldexp(static_cast<T>(1), -i));
+        }
+        std::vector<T> actual(nu.size());
+
+        for (T const k : {static_cast<T>(0), static_cast<T>(0.5), static_cast<T>(-0.9)}) {
+            errno = 0;
+            BOOST_CHECK(std::comp_ellint_3_batch(k, nu.data(), nu.data() + nu.size() - 1, actual.data())
+                == actual.data() + actual.size() - 1);
+            BOOST_CHECK(verify_not_domain_error());
+            std::comp_ellint_3_batch(k, nu.data() + nu.size() - 1, nu.data() + nu.size(), &actual.back());
+            BOOST_CHECK(verify_domain_error());
+            for (std::size_t i = 0; i < nu.size(); ++i) {
+                if (std::isnan(nu[i]) || nu[i] == 1) {
+                    BOOST_CHECK(std::isnan(actual[i]));
+                } else {
+                    BOOST_CHECK_CLOSE_FRACTION(actual[i], control_fn<T>(k, nu[i]), 8 * tolerance);
+                }
+            }
+        }
+
+        T const bad[] = {static_cast<T>(0.5), static_cast<T>(2)};
+        std::comp_ellint_3_batch(static_cast<T>(1), bad, bad + 1, actual.data());
+        BOOST_CHECK(verify_domain_error());
+        std::comp_ellint_3_batch(static_cast<T>(0.5), bad, bad + 2, actual.data());
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(!std::isnan(actual[0]) && std::isnan(actual[1]));
+    }
+
     BOOST_AUTO_TEST_CASE_TEMPLATE(test_comp_ellint_3_boundaries, T, fptypes) {
         auto const tolerance = eps<T>;
 
@@ -501,7 +1348,7 @@ namespace cyl_bessel_i {
     template<>
     constexpr auto test_fn<float> = std::cyl_bessel_if;
     template<>
-    constexpr auto test_fn<double> = std::cyl_bessel_i;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::cyl_bessel_i);
     template<>
     constexpr auto test_fn<long double> = std::cyl_bessel_il;
 
@@ -600,6 +1447,14 @@ namespace cyl_bessel_i {
         BOOST_CHECK(verify_not_domain_error());
         BOOST_CHECK(std::isnan(test_fn<T>(qNaN<T>, static_cast<T>(1))));
         BOOST_CHECK(verify_not_domain_error());
+
+        // orders past INT_MAX, which Boost can only abandon by unwinding
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(-inf<T>, T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), qNaN<T>)));
+        BOOST_CHECK(verify_not_domain_error());
     }
 } // namespace cyl_bessel_i
 
@@ -616,7 +1471,7 @@ namespace cyl_bessel_j {
     template<>
     constexpr auto test_fn<float> = std::cyl_bessel_jf;
     template<>
-    constexpr auto test_fn<double> = std::cyl_bessel_j;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::cyl_bessel_j);
     template<>
     constexpr auto test_fn<long double> = std::cyl_bessel_jl;
 
@@ -724,7 +1579,7 @@ namespace cyl_bessel_j {
         auto const tester = [](T tolerance) {
             return [tolerance](auto const& datum) {
                 auto const actual = test_fn<T>(datum[0], datum[1]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[0], datum[1]));
+                BOOST_CHECK(matches_float_control(actual, control_fn<T>(datum[0], datum[1])));
                 if (!(actual == datum[2])) {
                     BOOST_CHECK_CLOSE_FRACTION(actual, datum[2], tolerance);
                 }
@@ -758,6 +1613,14 @@ namespace cyl_bessel_j {
         BOOST_CHECK(std::isnan(test_fn<T>(qNaN<T>, static_cast<T>(1))));
         BOOST_CHECK(verify_not_domain_error());
 
+        // orders past INT_MAX, which Boost can only abandon by unwinding
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(-inf<T>, T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), qNaN<T>)));
+        BOOST_CHECK(verify_not_domain_error());
+
         // domain is x >= 0
 
         //
@@ -785,7 +1648,7 @@ namespace cyl_bessel_k {
     template<>
     constexpr auto test_fn<float> = std::cyl_bessel_kf;
     template<>
-    constexpr auto test_fn<double> = std::cyl_bessel_k;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::cyl_bessel_k);
     template<>
     constexpr auto test_fn<long double> = std::cyl_bessel_kl;
 
@@ -877,6 +1740,14 @@ namespace cyl_bessel_k {
         BOOST_CHECK(std::isnan(test_fn<T>(qNaN<T>, static_cast<T>(1))));
         BOOST_CHECK(verify_not_domain_error());
 
+        // orders past INT_MAX, which Boost can only abandon by unwinding
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(-inf<T>, T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), qNaN<T>)));
+        BOOST_CHECK(verify_not_domain_error());
+
         // domain is x >= 0
 
         //
@@ -904,7 +1775,7 @@ namespace cyl_neumann {
     template<>
     constexpr auto test_fn<float> = std::cyl_neumannf;
     template<>
-    constexpr auto test_fn<double> = std::cyl_neumann;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::cyl_neumann);
     template<>
     constexpr auto test_fn<long double> = std::cyl_neumannl;
 
@@ -1002,6 +1873,14 @@ namespace cyl_neumann {
         BOOST_CHECK(std::isnan(test_fn<T>(qNaN<T>, static_cast<T>(1))));
         BOOST_CHECK(verify_not_domain_error());
 
+        // orders past INT_MAX, which Boost can only abandon by unwinding
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(-inf<T>, T(1))));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(test_fn<T>(T(3e9), qNaN<T>)));
+        BOOST_CHECK(verify_not_domain_error());
+
         // domain is x >= 0
 
         //
@@ -1029,7 +1908,7 @@ namespace ellint_1 {
     template<>
     constexpr auto test_fn<float> = std::ellint_1f;
     template<>
-    constexpr auto test_fn<double> = std::ellint_1;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::ellint_1);
     template<>
     constexpr auto test_fn<long double> = std::ellint_1l;
 
@@ -1062,7 +1941,7 @@ namespace ellint_1 {
         auto const tester = [](T tolerance) {
             return [tolerance](auto const& datum) {
                 auto const actual = test_fn<T>(datum[1], datum[0]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[1], datum[0]));
+                BOOST_CHECK(matches_float_control(actual, control_fn<T>(datum[1], datum[0])));
                 if (!(actual == datum[2])) // +/-inf is equal to, but not "close" to, +/-inf
                     BOOST_CHECK_CLOSE_FRACTION(actual, datum[2], tolerance);
             };
@@ -1108,7 +1987,7 @@ namespace ellint_2 {
     template<>
     constexpr auto test_fn<float> = std::ellint_2f;
     template<>
-    constexpr auto test_fn<double> = std::ellint_2;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double)>(std::ellint_2);
     template<>
     constexpr auto test_fn<long double> = std::ellint_2l;
 
@@ -1136,7 +2015,7 @@ namespace ellint_2 {
         auto const tester = [](T tolerance) {
             return [tolerance](auto const& datum) {
                 auto const actual = test_fn<T>(datum[1], datum[0]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[1], datum[0]));
+                BOOST_CHECK(matches_float_control(actual, control_fn<T>(datum[1], datum[0])));
                 if (!(actual == datum[2])) // +/-inf is equal to, but not "close" to, +/-inf
                     BOOST_CHECK_CLOSE_FRACTION(actual, datum[2], tolerance);
             };
@@ -1167,6 +2046,18 @@ namespace ellint_2 {
         BOOST_CHECK_CLOSE_FRACTION(test_fn<T>(static_cast<T>(0), static_cast<T>(1)),
             static_cast<T>(1L), tolerance);
         BOOST_CHECK(verify_not_domain_error());
+
+        // past pi/2, E(+/-1, phi) = 2n + sin r for phi = n pi + r in every form, where Boost
+        // gives sin phi
+        for (T const k : {static_cast<T>(1), static_cast<T>(-1)}) {
+            BOOST_CHECK_CLOSE_FRACTION(test_fn<T>(k, static_cast<T>(4)),
+                SC_(2.7568024953079282513726390945118290941359128873364), 2 * tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(test_fn<T>(k, static_cast<T>(-4)),
+                SC_(-2.7568024953079282513726390945118290941359128873364), 2 * tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(test_fn<T>(k, static_cast<T>(10)),
+                SC_(6.5440211108893698134047476618513772816836430129162), 2 * tolerance);
+        }
+        BOOST_CHECK(verify_not_domain_error());
     }
 } // namespace ellint_2
 
@@ -1183,7 +2074,7 @@ namespace ellint_3 {
     template<>
     constexpr auto test_fn<float> = std::ellint_3f;
     template<>
-    constexpr auto test_fn<double> = std::ellint_3;
+    constexpr auto test_fn<double> = static_cast<double (*)(double, double, double)>(std::ellint_3);
     template<>
     constexpr auto test_fn<long double> = std::ellint_3l;
 
@@ -1276,7 +2167,7 @@ namespace ellint_3 {
         auto const tester = [](T tolerance) {
             return [tolerance](auto const& datum) {
                 auto const actual = test_fn<T>(datum[2], datum[0], datum[1]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[2], datum[0], datum[1]));
+                BOOST_CHECK(matches_float_control(actual, control_fn<T>(datum[2], datum[0], datum[1])));
                 if (!(actual == datum[3])) // +/-inf is equal to, but not "close" to, +/-inf
                     BOOST_CHECK_CLOSE_FRACTION(actual, datum[3], tolerance);
             };
@@ -1318,33 +2209,313 @@ namespace ellint_3 {
     }
 } // namespace ellint_3
 
-namespace expint {
-    template<class T>
-    constexpr auto control_fn = [](T x) {
-        return boost::math::expint(x);
-    };
+namespace ellint_1_2_3 {
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_ellint_1_2_3, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        for (T const k : {T(0), T(0.3), T(-0.75), T(0.9)}) {
+            for (T const nu : {T(-4), T(0), T(0.5), T(0.9)}) {
+                for (T const phi : {T(-7.5), T(-1), T(1e-3), T(0.5), T(1.5), T(2), T(10), T(40)}) {
+                    auto const all = std::ellint_1_2_3(k, nu, phi);
+                    BOOST_CHECK_CLOSE_FRACTION(all.first_kind, std::ellint_1(k, phi), 8 * tolerance);
+                    BOOST_CHECK_CLOSE_FRACTION(all.second_kind, std::ellint_2(k, phi), 8 * tolerance);
+                    BOOST_CHECK_CLOSE_FRACTION(all.third_kind, std::ellint_3(k, nu, phi), 16 * tolerance);
+                }
+            }
+        }
 
-    template<class T>
-    constexpr auto test_fn = [](auto x) {
-        static_assert(always_false<decltype(x)>);
-    };
-    template<>
-    constexpr auto test_fn<float> = std::expintf;
-    template<>
-    constexpr auto test_fn<double> = std::expint;
-    template<>
-    constexpr auto test_fn<long double> = std::expintl;
+        // near phi = pi/2 the result is sensitive to phi as 1 / k', so k stays clear of 1
+        auto const half_pi = boost::math::constants::half_pi<T>();
+        for (T const k : {T(0.5), T(-0.9), T(0.999)}) {
+            auto const all = std::ellint_1_2_3(k, T(0), half_pi);
+            auto const complete = std::comp_ellint_1_2(k);
+            BOOST_CHECK_CLOSE_FRACTION(all.first_kind, complete.first_kind, 8 * tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(all.second_kind, complete.second_kind, 8 * tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(all.third_kind, complete.first_kind, 8 * tolerance);
+
+            // each period adds twice the complete integrals
+            auto const later = std::ellint_1_2_3(k, T(0), half_pi + 3 * boost::math::constants::pi<T>());
+            BOOST_CHECK_CLOSE_FRACTION(later.first_kind, 7 * complete.first_kind, 8 * tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(later.second_kind, 7 * complete.second_kind, 8 * tolerance);
+        }
+    }
 
-    BOOST_AUTO_TEST_CASE_TEMPLATE(test_expint, T, fptypes) {
-        auto const tester = [](T tolerance) {
-            return [tolerance](auto const& datum) {
-                auto const actual = test_fn<T>(datum[0]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[0]));
-                BOOST_CHECK_CLOSE_FRACTION(actual, datum[1], tolerance);
-            };
-        };
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_ellint_1_2_batch, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
 
-#include "math/test/expinti_data.ipp"
+        auto const k = batch_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        // amplitudes out to several periods, of both signs, and one NaN lane of its own
+        auto phi = batch_args<T>(static_cast<T>(-20), static_cast<T>(20));
+        std::reverse(phi.begin(), phi.end());
+        std::vector<T> first_kind(k.size());
+        std::vector<T> second_kind(k.size());
+
+        errno = 0;
+        BOOST_CHECK(std::ellint_1_batch(k.data(), k.data() + k.size(), phi.data(), first_kind.data())
+            == first_kind.data() + first_kind.size());
+        BOOST_CHECK(std::ellint_2_batch(k.data(), k.data() + k.size(), phi.data(), second_kind.data())
+            == second_kind.data() + second_kind.size());
+        BOOST_CHECK(verify_not_domain_error());
+        for (std::size_t i = 0; i < k.size(); ++i) {
+            auto const expected = std::ellint_1_2_3(k[i], T(0), phi[i]);
+            if (std::isnan(k[i]) || std::isnan(phi[i]) || std::fabs(k[i]) == 1) {
+                BOOST_CHECK(same_value(first_kind[i], expected.first_kind));
+                BOOST_CHECK(same_value(second_kind[i], expected.second_kind));
+            } else {
+                BOOST_CHECK_CLOSE_FRACTION(first_kind[i], expected.first_kind, 4 * tolerance);
+                BOOST_CHECK_CLOSE_FRACTION(second_kind[i], expected.second_kind, 4 * tolerance);
+                BOOST_CHECK_CLOSE_FRACTION(first_kind[i], std::ellint_1(k[i], phi[i]), 8 * tolerance);
+                BOOST_CHECK_CLOSE_FRACTION(second_kind[i], std::ellint_2(k[i], phi[i]), 8 * tolerance);
+            }
+        }
+
+        T const bad[] = {static_cast<T>(0.5), static_cast<T>(-2)};
+        std::ellint_1_batch(bad, bad + 2, phi.data(), first_kind.data());
+        BOOST_CHECK(verify_domain_error());
+        std::ellint_2_batch(bad, bad + 2, phi.data(), second_kind.data());
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(!std::isnan(first_kind[0]) && std::isnan(first_kind[1]) && std::isnan(second_kind[1]));
+    }
+
+    BOOST_AUTO_TEST_CASE(test_elliptic_plan) {
+        auto phi = batch_args<double>(-20, 20);
+        std::vector<double> first_kind(phi.size());
+        std::vector<double> second_kind(phi.size());
+        std::vector<double> third_kind(phi.size());
+        for (double const k : {0.0, 0.3, -0.9, 1.0}) {
+            for (double const nu : {0.0, 0.5, -3.0}) {
+                std::elliptic_plan const plan(k, nu);
+                BOOST_CHECK_EQUAL(plan.modulus(), k);
+                BOOST_CHECK_EQUAL(plan.characteristic(), nu);
+                if (k != 1) {
+                    BOOST_CHECK_CLOSE_FRACTION(plan.complete().first_kind, std::comp_ellint_1(k), 4 * eps<double>);
+                    BOOST_CHECK_CLOSE_FRACTION(plan.complete().second_kind, std::comp_ellint_2(k), 4 * eps<double>);
+                }
+
+                errno = 0;
+                plan.first_kind(phi.data(), phi.data() + phi.size(), first_kind.data());
+                plan.second_kind(phi.data(), phi.data() + phi.size(), second_kind.data());
+                BOOST_CHECK(plan.third_kind(phi.data(), phi.data() + phi.size(), third_kind.data())
+                    == third_kind.data() + third_kind.size());
+                for (std::size_t i = 0; i < phi.size(); ++i) {
+                    // the scalar form is ellint_1_2_3 with the complete integrals cached
+                    auto const all = plan(phi[i]);
+                    auto const expected = std::ellint_1_2_3(k, nu, phi[i]);
+                    BOOST_CHECK(same_value(all.first_kind, expected.first_kind));
+                    BOOST_CHECK(same_value(all.second_kind, expected.second_kind));
+                    BOOST_CHECK(same_value(all.third_kind, expected.third_kind));
+                    if (std::isnan(phi[i]) || (k == 1 && std::fabs(phi[i]) > 1.5)) {
+                        BOOST_CHECK(same_value(first_kind[i], all.first_kind));
+                        BOOST_CHECK(same_value(second_kind[i], all.second_kind));
+                        BOOST_CHECK(same_value(third_kind[i], all.third_kind));
+                    } else {
+                        BOOST_CHECK_CLOSE_FRACTION(first_kind[i], all.first_kind, 4 * eps<double>);
+                        BOOST_CHECK_CLOSE_FRACTION(second_kind[i], all.second_kind, 4 * eps<double>);
+                        BOOST_CHECK_CLOSE_FRACTION(third_kind[i], all.third_kind, 4 * eps<double>);
+                    }
+                }
+                if (k != 1) {
+                    // k = 1 leaves Pi beyond pi/2 to ellint_3, which reports it
+                    BOOST_CHECK(verify_not_domain_error());
+                }
+            }
+        }
+
+        // a modulus outside the domain reports a domain error at each evaluation
+        std::elliptic_plan const outside(1.5);
+        errno = 0;
+        BOOST_CHECK(std::isnan(outside(0.5).first_kind));
+        BOOST_CHECK(verify_domain_error());
+        outside.second_kind(phi.data(), phi.data() + 1, second_kind.data());
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(second_kind[0]));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_ellint_1_2_3_boundaries, T, fptypes) {
+        errno = 0;
+        auto const nan_k = std::ellint_1_2_3(qNaN<T>, T(0), T(1));
+        BOOST_CHECK(std::isnan(nan_k.first_kind) && std::isnan(nan_k.second_kind) && std::isnan(nan_k.third_kind));
+        auto const nan_phi = std::ellint_1_2_3(T(0.5), T(0), qNaN<T>);
+        BOOST_CHECK(std::isnan(nan_phi.first_kind) && std::isnan(nan_phi.second_kind) && std::isnan(nan_phi.third_kind));
+        // nu enters only the third kind
+        auto const nan_nu = std::ellint_1_2_3(T(0.5), qNaN<T>, T(1));
+        BOOST_CHECK_EQUAL(nan_nu.first_kind, std::ellint_1_2_3(T(0.5), T(0), T(1)).first_kind);
+        BOOST_CHECK(std::isnan(nan_nu.third_kind));
+        BOOST_CHECK(verify_not_domain_error());
+
+        // domain is |k| <= 1
+        BOOST_CHECK(std::isnan(std::ellint_1_2_3(T(1.0001), T(0), T(0)).first_kind));
+        BOOST_CHECK(verify_domain_error());
+        // beyond the singularity at nu sin^2 phi = 1, as for ellint_3
+        auto const past = std::ellint_1_2_3(T(0.5), T(20), T(1.5));
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(past.third_kind));
+        BOOST_CHECK_EQUAL(past.first_kind, std::ellint_1_2_3(T(0.5), T(0), T(1.5)).first_kind);
+
+        auto const zero = std::ellint_1_2_3(T(0.5), T(0.5), T(0));
+        BOOST_CHECK_EQUAL(zero.first_kind, T(0));
+        BOOST_CHECK_EQUAL(zero.second_kind, T(0));
+        BOOST_CHECK_EQUAL(zero.third_kind, T(0));
+        // E(1, phi) = sin phi
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+        BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_2_3(T(1), T(0), T(1)).second_kind, std::sin(T(1)), 2 * tolerance);
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
+    BOOST_AUTO_TEST_CASE(test_float_kernels) {
+        // the float forms stop the duplication, and take the complete integrals from a fit, at
+        // float accuracy; each stays within a couple of ulps of the double form, periods included
+        float const tolerance = 2 * eps<float>;
+        for (float const k : {0.0f, 0.3f, -0.75f, 0.9f, 0.999f}) {
+            BOOST_CHECK_CLOSE_FRACTION(std::comp_ellint_1f(k), static_cast<float>(std::comp_ellint_1(double{k})), tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(std::comp_ellint_2f(k), static_cast<float>(std::comp_ellint_2(double{k})), tolerance);
+            for (float const phi : {-7.5f, -1.0f, 1e-3f, 0.5f, 1.5f, 10.0f, 40.0f}) {
+                BOOST_CHECK_CLOSE_FRACTION(std::ellint_1f(k, phi),
+                    static_cast<float>(std::ellint_1(double{k}, double{phi})), tolerance);
+                BOOST_CHECK_CLOSE_FRACTION(std::ellint_2f(k, phi),
+                    static_cast<float>(std::ellint_2(double{k}, double{phi})), tolerance);
+                BOOST_CHECK_CLOSE_FRACTION(std::ellint_3f(k, 0.5f, phi),
+                    static_cast<float>(std::ellint_3(double{k}, 0.5, double{phi})), tolerance);
+            }
+        }
+
+        for (float const x : {1e-3f, 0.5f, 2.0f, 300.0f}) {
+            BOOST_CHECK_CLOSE_FRACTION(std::carlson_rf(x, 1.0f, 50.0f),
+                static_cast<float>(std::carlson_rf(double{x}, 1.0, 50.0)), tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(std::carlson_rd(x, 1.0f, 50.0f),
+                static_cast<float>(std::carlson_rd(double{x}, 1.0, 50.0)), tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(std::carlson_rj(x, 1.0f, 50.0f, 2.0f),
+                static_cast<float>(std::carlson_rj(double{x}, 1.0, 50.0, 2.0)), tolerance);
+        }
+    }
+} // namespace ellint_1_2_3
+
+namespace ellint_1_inverse {
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_ellint_1_inverse, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(T(0.5), T(0.5)), SC_(0.4950582811227364503137277), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(T(0.9), T(2)), SC_(1.447208206509323610382491), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(T(0.99), T(-7.5)), SC_(-3.859262842936830911571293), 4 * tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(T(0.3), T(20)), SC_(19.5482511317500619771626), 4 * tolerance);
+
+        // am(u, 0) = u, am(u, 1) = gd(u), and am(m K, k) = m pi / 2
+        for (T const u : {T(-3), T(0.25), T(7)}) {
+            BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(T(0), u), u, 4 * tolerance);
+            BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(T(1), u), std::atan(std::sinh(u)), 4 * tolerance);
+        }
+        for (T const k : {T(0.3), T(-0.9), T(0.999)}) {
+            T const quarter = std::comp_ellint_1_2(k).first_kind;
+            for (int m : {1, 2, -3}) {
+                BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(k, m * quarter),
+                    m * boost::math::constants::half_pi<T>(), 4 * tolerance);
+            }
+        }
+
+        // the inverse of F; phi moves with u at rate dn <= 1, so phi keeps u's relative accuracy
+        for (T const k : {T(0.2), T(0.8), T(-0.99)}) {
+            for (T const phi : {T(-9), T(-1.5), T(0.001), T(0.7), T(1.2), T(3), T(12)}) {
+                T const u = std::ellint_1_2_3(k, T(0), phi).first_kind;
+                BOOST_CHECK_CLOSE_FRACTION(std::ellint_1_inverse(k, u), phi, 8 * tolerance * std::max(T(1), std::fabs(u / phi)));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_ellint_1_inverse_batch, T, fptypes) {
+        auto const k = batch_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        auto u = batch_args<T>(static_cast<T>(-30), static_cast<T>(30));
+        std::reverse(u.begin(), u.end());
+        std::vector<T> out(k.size());
+
+        errno = 0;
+        BOOST_CHECK(std::ellint_1_inverse_batch(k.data(), k.data() + k.size(), u.data(), out.data())
+            == out.data() + out.size());
+        BOOST_CHECK(verify_not_domain_error());
+        for (std::size_t i = 0; i < k.size(); ++i) {
+            BOOST_CHECK(same_value(out[i], std::ellint_1_inverse(k[i], u[i])));
+        }
+
+        T const bad[] = {static_cast<T>(0.5), static_cast<T>(-2)};
+        std::ellint_1_inverse_batch(bad, bad + 2, u.data(), out.data());
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(!std::isnan(out[0]) && std::isnan(out[1]));
+    }
+
+    BOOST_AUTO_TEST_CASE(test_elliptic_plan_amplitude) {
+        auto const u = batch_args<double>(-30, 30);
+        std::vector<double> out(u.size());
+        errno = 0;
+        for (double const k : {0.0, 0.6, -0.95, 1.0}) {
+            std::elliptic_plan const plan(k, 0.5);
+            plan.amplitude(u.data(), u.data() + u.size(), out.data());
+            for (std::size_t i = 0; i < u.size(); ++i) {
+                BOOST_CHECK(same_value(out[i], plan.amplitude(u[i])));
+                if (std::isnan(u[i])) {
+                    BOOST_CHECK(std::isnan(out[i]));
+                } else {
+                    BOOST_CHECK_CLOSE_FRACTION(out[i], std::ellint_1_inverse(k, u[i]), 4 * eps<double>);
+                }
+            }
+        }
+        BOOST_CHECK(verify_not_domain_error());
+
+        BOOST_CHECK(std::isnan(std::elliptic_plan(2).amplitude(0.5)));
+        BOOST_CHECK(verify_domain_error());
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_ellint_1_inverse_boundaries, T, fptypes) {
+        errno = 0;
+        BOOST_CHECK(std::isnan(std::ellint_1_inverse(qNaN<T>, T(1))));
+        BOOST_CHECK(std::isnan(std::ellint_1_inverse(T(0.5), qNaN<T>)));
+        BOOST_CHECK_EQUAL(std::ellint_1_inverse(T(0.5), T(0)), T(0));
+        BOOST_CHECK_EQUAL(std::ellint_1_inverse(T(0.5), inf<T>), inf<T>);
+        BOOST_CHECK_EQUAL(std::ellint_1_inverse(T(0.5), -inf<T>), -inf<T>);
+        BOOST_CHECK(verify_not_domain_error());
+
+        // domain is |k| <= 1
+        BOOST_CHECK(std::isnan(std::ellint_1_inverse(T(1.5), T(1))));
+        BOOST_CHECK(verify_domain_error());
+    }
+} // namespace ellint_1_inverse
+
+namespace expint {
+    template<class T>
+    constexpr auto control_fn = [](T x) {
+        return boost::math::expint(x);
+    };
+
+    template<class T>
+    constexpr auto test_fn = [](auto x) {
+        static_assert(always_false<decltype(x)>);
+    };
+    template<>
+    constexpr auto test_fn<float> = std::expintf;
+    template<>
+    constexpr auto test_fn<double> = static_cast<double (*)(double)>(std::expint);
+    template<>
+    constexpr auto test_fn<long double> = std::expintl;
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_expint, T, fptypes) {
+        auto const tester = [](T tolerance) {
+            return [tolerance](auto const& datum) {
+                auto const actual = test_fn<T>(datum[0]);
+                BOOST_CHECK(matches_float_control(actual, control_fn<T>(datum[0])));
+                BOOST_CHECK_CLOSE_FRACTION(actual, datum[1], tolerance);
+
+                // the batch, whose rational forms give up a few ulps to the scalar path and
+                // which evaluates long double in double
+                T const x = datum[0];
+                T batched;
+                std::expint_batch(&x, &x + 1, &batched);
+                BOOST_CHECK_CLOSE_FRACTION(batched, datum[1],
+                    8 * tolerance * static_cast<T>(std::max(1.0, eps<double> / static_cast<double>(eps<T>))));
+            };
+        };
+
+#include "math/test/expinti_data.ipp"
 #include "math/test/expinti_data_double.ipp"
 
         ::for_each(expinti_data, tester(2 * eps<T>));
@@ -1367,6 +2538,123 @@ namespace expint {
         BOOST_CHECK_CLOSE_FRACTION(test_fn<T>(static_cast<T>(-50.5)), static_cast<T>(-2.27237132932219350440719707268817831250090574830769670186618e-24L), tolerance);
     }
 
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_expint_batch, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        // the exponential form below -1 / 2, the logarithmic forms either side of 0, and the
+        // exponential forms either side of 22, interleaved so that every block gathers lanes
+        // for each of them
+        auto const negative = batch_args<T>(static_cast<T>(-80), static_cast<T>(-0.5));
+        auto const near_zero = batch_args<T>(static_cast<T>(-0.5), static_cast<T>(6));
+        auto const positive = batch_args<T>(static_cast<T>(6), static_cast<T>(80));
+        std::vector<T> args;
+        for (std::size_t i = 0; i < negative.size(); ++i) {
+            args.push_back(negative[i]);
+            args.push_back(near_zero[i]);
+            args.push_back(positive[i]);
+        }
+        std::vector<T> actual(args.size());
+
+        errno = 0;
+        BOOST_CHECK(std::expint_batch(args.data(), args.data() + args.size(), actual.data())
+            == actual.data() + actual.size());
+        BOOST_CHECK(verify_not_domain_error());
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            T const expected = std::isnan(args[i]) ? args[i] : test_fn<T>(args[i]);
+            if (std::isfinite(expected)) {
+                BOOST_CHECK_CLOSE_FRACTION(actual[i], expected, 16 * tolerance);
+            } else {    // NaN
+                BOOST_CHECK(same_value(actual[i], expected));
+            }
+        }
+
+        // the root of Ei, where the batch keeps its relative accuracy; long double arguments
+        // there must be exact in double for the comparison to mean anything
+        using lane_type = std::conditional_t<std::is_same_v<T, float>, float, double>;
+        auto const root = static_cast<lane_type>(0.372507410781366634461991866580119133535689497771654051555657L);
+        T const near_root[] = {root, std::nextafter(root, lane_type{0}), std::nextafter(root, lane_type{1}),
+            root + static_cast<lane_type>(1) / 1024};
+        std::expint_batch(std::begin(near_root), std::end(near_root), actual.data());
+        for (std::size_t i = 0; i < std::size(near_root); ++i) {
+            BOOST_CHECK_CLOSE_FRACTION(actual[i], test_fn<T>(near_root[i]), 16 * tolerance);
+        }
+
+        // the arguments left to the scalar path
+        T const edges[] = {static_cast<T>(0), std::numeric_limits<T>::denorm_min(),
+            -std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::infinity(),
+            -std::numeric_limits<T>::infinity(), static_cast<T>(-701), static_cast<T>(701), qNaN<T>};
+        std::expint_batch(std::begin(edges), std::end(edges), actual.data());
+        for (std::size_t i = 0; i < std::size(edges); ++i) {
+            BOOST_CHECK(same_value(actual[i], std::isnan(edges[i]) ? edges[i] : test_fn<T>(edges[i])));
+        }
+    }
+
+    // the test data at the precision of T, for measuring the other types against long double
+    template<class T>
+    std::vector<boost::array<T, 2>> reference_data() {
+#include "math/test/expinti_data.ipp"
+#include "math/test/expinti_data_double.ipp"
+
+        std::vector<boost::array<T, 2>> data(expinti_data.begin(), expinti_data.end());
+        data.insert(data.end(), expinti_data_double.begin(), expinti_data_double.end());
+        return data;
+    }
+
+    // the largest and mean error in ulps of T over a set of values
+    template<class T>
+    struct ulp_error {
+        double max = 0;
+        double total = 0;
+        std::size_t count = 0;
+
+        void add(T const actual, long double const expected) {
+            long double const ulp = boost::math::ulp(static_cast<T>(expected));
+            double const error = static_cast<double>(std::fabs(actual - expected) / ulp);
+            max = std::max(max, error);
+            total += error;
+            ++count;
+        }
+
+        double mean() const {
+            return count == 0 ? 0 : total / count;
+        }
+    };
+
+    // The error of the scalar form and the batch over the test data, against its long double
+    // values where the argument is exact in T and Boost's long double Ei where it is not.
+    // Run with --log_level=message to see the figures.
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_expint_ulps, T, fptypes) {
+        std::vector<T> args;
+        std::vector<long double> expected;
+        for (auto const& datum : reference_data<long double>()) {
+            T const x = static_cast<T>(datum[0]);
+            long double const value = x == datum[0] ? datum[1] : boost::math::expint(static_cast<long double>(x));
+            if (std::isfinite(static_cast<T>(value))) {    // float overflows past 88
+                args.push_back(x);
+                expected.push_back(value);
+            }
+        }
+
+        std::vector<T> batched(args.size());
+        std::expint_batch(args.data(), args.data() + args.size(), batched.data());
+        ulp_error<T> scalar;
+        ulp_error<T> batch;
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            scalar.add(test_fn<T>(args[i]), expected[i]);
+            batch.add(batched[i], expected[i]);
+        }
+
+        BOOST_TEST_MESSAGE("expint, " << std::numeric_limits<T>::digits << "-bit, " << args.size()
+            << " values: scalar max " << scalar.max << " ulp, mean " << scalar.mean()
+            << "; batch max " << batch.max << " ulp, mean " << batch.mean());
+
+        // the 2 eps and 16 eps test_expint allows, which are up to twice as many ulps; the
+        // batch evaluates long double in double
+        BOOST_CHECK_LE(scalar.max, 4.0);
+        BOOST_CHECK_LE(batch.max, 32 * std::max(1.0, eps<double> / static_cast<double>(eps<T>)));
+    }
+
     BOOST_AUTO_TEST_CASE_TEMPLATE(test_expint_boundaries, T, fptypes) {
         errno = 0;
         BOOST_CHECK(std::isnan(test_fn<T>(qNaN<T>)));
@@ -1375,8 +2663,382 @@ namespace expint {
         BOOST_CHECK_EQUAL(test_fn<T>(static_cast<T>(0)), -inf<T>);
         BOOST_CHECK(verify_not_domain_error());
     }
+
+    template<class T>
+    constexpr auto scaled_fn = [](auto x) {
+        static_assert(always_false<decltype(x)>);
+    };
+    template<>
+    constexpr auto scaled_fn<float> = std::expint_scaledf;
+    template<>
+    constexpr auto scaled_fn<double> = static_cast<double (*)(double)>(std::expint_scaled);
+    template<>
+    constexpr auto scaled_fn<long double> = std::expint_scaledl;
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_expint_scaled, T, fptypes) {
+        // the scalar form is computed in double, the batch in float for float
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+        T const batch_tolerance = std::max(eps<T>, static_cast<T>(eps<double>));
+
+        T const spot[][2] = {
+            {static_cast<T>(-650), static_cast<T>(-0.00153610192380738291863637292021874938758329427L)},
+            {static_cast<T>(-6), static_cast<T>(-0.145267629233886893806035404751780244230571807L)},
+            {static_cast<T>(-1), static_cast<T>(-0.59634736232319407434107849936927937607417786L)},
+            {static_cast<T>(-0.25), static_cast<T>(-1.34088544483139335263917678179112389567746544L)},
+            {static_cast<T>(0.25), static_cast<T>(-0.422533119368814873169653322415303608880456986L)},
+            {static_cast<T>(3), static_cast<T>(0.494576401348641235028769696756170917701693637L)},
+            {static_cast<T>(50), static_cast<T>(0.0204170455559439873335659940616104440299378903L)},
+            {static_cast<T>(650), static_cast<T>(0.00154083571884575330519434895253282448007262328L)}};
+        for (auto const& datum : spot) {
+            BOOST_CHECK_CLOSE_FRACTION(scaled_fn<T>(datum[0]), datum[1], 4 * tolerance);
+            T batched;
+            std::expint_scaled_batch(&datum[0], &datum[0] + 1, &batched);
+            BOOST_CHECK_CLOSE_FRACTION(batched, datum[1], 8 * batch_tolerance);
+        }
+
+        // far past the overflow of Ei, e^-x Ei(x) = (1 + 1/x + 2/x^2 + 6/x^3 + 24/x^4 + ...) / x
+        T const largest = static_cast<T>(std::min(static_cast<long double>(std::numeric_limits<T>::max()),
+            static_cast<long double>(std::numeric_limits<double>::max())));
+        for (T const x : {static_cast<T>(1e4), static_cast<T>(-1e4), static_cast<T>(3e7), static_cast<T>(-1e30),
+                static_cast<T>(1e38), largest, -largest}) {
+            T const expected = (1 + (1 + (2 + (6 + 24 / x) / x) / x) / x) / x;
+            BOOST_CHECK_CLOSE_FRACTION(scaled_fn<T>(x), expected, 4 * tolerance);
+            T batched;
+            std::expint_scaled_batch(&x, &x + 1, &batched);
+            BOOST_CHECK_CLOSE_FRACTION(batched, expected, 4 * batch_tolerance);
+        }
+
+        // across the switch from e^-x Ei(x) to the rational form
+        for (T const x : {static_cast<T>(700), static_cast<T>(-700)}) {
+            BOOST_CHECK_CLOSE_FRACTION(scaled_fn<T>(std::nextafter(x, 2 * x)), scaled_fn<T>(x), 8 * tolerance);
+        }
+
+        auto const args = batch_args<T>(static_cast<T>(-60), static_cast<T>(60));
+        std::vector<T> actual(args.size());
+        errno = 0;
+        BOOST_CHECK(std::expint_scaled_batch(args.data(), args.data() + args.size(), actual.data())
+            == actual.data() + actual.size());
+        BOOST_CHECK(verify_not_domain_error());
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            T const expected = scaled_fn<T>(args[i]);
+            if (std::isfinite(expected)) {
+                BOOST_CHECK_CLOSE_FRACTION(actual[i], expected, 16 * batch_tolerance);
+            } else {    // NaN, or the pole at 0
+                BOOST_CHECK(same_value(actual[i], expected));
+            }
+        }
+
+        T const edges[] = {static_cast<T>(0), std::numeric_limits<T>::denorm_min(),
+            std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), qNaN<T>};
+        std::expint_scaled_batch(std::begin(edges), std::end(edges), actual.data());
+        for (std::size_t i = 0; i < std::size(edges); ++i) {
+            BOOST_CHECK(same_value(actual[i], scaled_fn<T>(edges[i])));
+        }
+        BOOST_CHECK_EQUAL(actual[0], -inf<T>);
+        BOOST_CHECK_EQUAL(actual[2], static_cast<T>(0));
+        BOOST_CHECK(std::signbit(actual[3]) && actual[3] == 0);
+        BOOST_CHECK(std::isnan(actual[4]));
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_expint_n, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = std::max(eps<T>, static_cast<T>(eps<double>));
+
+        struct {
+            unsigned n;
+            T x;
+            T value;
+        } const spot[] = {
+            {1, static_cast<T>(0.5), static_cast<T>(0.55977359477616081174679593931508523522684689L)},
+            {2, static_cast<T>(0.96875), static_cast<T>(0.155534700206901308446565215487292595035602456L)},
+            {4, static_cast<T>(0.75), static_cast<T>(0.118763849399360666190721182695491336001090492L)},
+            {5, static_cast<T>(1.5), static_cast<T>(0.0385299244254951553959715381660557314569408317L)},
+            {10, static_cast<T>(0.25), static_cast<T>(0.0839219939386743007631612853162868916530565664L)},
+            {3, static_cast<T>(20), static_cast<T>(9.0091168133464015117540606309252873142479024e-11L)},
+            {50, static_cast<T>(3), static_cast<T>(0.000956364292750273198874603214799173579106137202L)},
+            {0, static_cast<T>(2), static_cast<T>(0.067667641618306345946999747486242201703815773L)}};
+        for (auto const& datum : spot) {
+            T batched;
+            std::expint_n_batch(datum.n, &datum.x, &datum.x + 1, &batched);
+            BOOST_CHECK_CLOSE_FRACTION(batched, datum.value, 16 * tolerance);
+            if (datum.n != 0) {
+                std::vector<T> sequence(datum.n);
+                BOOST_CHECK(std::expint_n_sequence(datum.n, datum.x, sequence.data()) == sequence.data() + datum.n);
+                BOOST_CHECK_CLOSE_FRACTION(sequence.back(), datum.value, 16 * tolerance);
+            }
+        }
+
+        // the series, the continued fraction, and their crossing, with n on either side of x
+        auto const args = batch_args<T>(static_cast<T>(0.015625), static_cast<T>(40));
+        std::vector<T> actual(args.size());
+        std::vector<T> sequence(40);
+        errno = 0;
+        for (unsigned const n : {1u, 2u, 7u, 39u}) {
+            BOOST_CHECK(std::expint_n_batch(n, args.data(), args.data() + args.size(), actual.data())
+                == actual.data() + actual.size());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                if (std::isnan(args[i])) {
+                    BOOST_CHECK(std::isnan(actual[i]));
+                    continue;
+                }
+
+                // a lane's result does not depend on its neighbours in the block
+                T alone;
+                std::expint_n_batch(n, &args[i], &args[i] + 1, &alone);
+                BOOST_CHECK_EQUAL(alone, actual[i]);
+
+                std::expint_n_sequence(40, args[i], sequence.data());
+                BOOST_CHECK_CLOSE_FRACTION(actual[i], sequence[n - 1], 32 * tolerance);
+                if (n == 1) {
+                    BOOST_CHECK_CLOSE_FRACTION(actual[i], -test_fn<T>(-args[i]), 16 * tolerance);
+                }
+            }
+        }
+        BOOST_CHECK(verify_not_domain_error());
+
+        // n E_(n+1)(x) + x E_n(x) = e^-x along each sequence
+        for (T const x : {static_cast<T>(0.125), static_cast<T>(0.875), static_cast<T>(1), static_cast<T>(9.5),
+                static_cast<T>(33)}) {
+            std::expint_n_sequence(40, x, sequence.data());
+            for (unsigned n = 1; n < 40; ++n) {
+                BOOST_CHECK_CLOSE_FRACTION(n * sequence[n] + x * sequence[n - 1], std::exp(-x), 16 * tolerance);
+            }
+        }
+
+        // the limits at 0 and infinity and the arguments outside the domain
+        T const zero = 0;
+        T const infinity = std::numeric_limits<T>::infinity();
+        std::expint_n_sequence(4, zero, sequence.data());
+        BOOST_CHECK_EQUAL(sequence[0], infinity);
+        BOOST_CHECK_EQUAL(sequence[1], static_cast<T>(1));
+        BOOST_CHECK_CLOSE_FRACTION(sequence[3], static_cast<T>(1) / 3, tolerance);
+        std::expint_n_sequence(4, infinity, sequence.data());
+        BOOST_CHECK_EQUAL(sequence[3], static_cast<T>(0));
+        std::expint_n_batch(0, &zero, &zero + 1, actual.data());
+        BOOST_CHECK_EQUAL(actual[0], infinity);
+        BOOST_CHECK(verify_not_domain_error());
+
+        BOOST_CHECK(std::expint_n_sequence(0, static_cast<T>(1), sequence.data()) == sequence.data());
+        std::expint_n_sequence(3, qNaN<T>, sequence.data());
+        BOOST_CHECK(std::isnan(sequence[2]));
+        BOOST_CHECK(verify_not_domain_error());
+
+        T const negative = -1;
+        std::expint_n_batch(2, &negative, &negative + 1, actual.data());
+        BOOST_CHECK(std::isnan(actual[0]));
+        BOOST_CHECK(verify_domain_error());
+    }
 } // namespace expint
 
+namespace gauss_hermite {
+    BOOST_AUTO_TEST_CASE(test_gauss_hermite_rule) {
+        double const root_pi = std::sqrt(boost::math::constants::pi<double>());
+        for (unsigned const n : {1u, 2u, 3u, 10u, 11u, 100u, 500u}) {
+            auto const rule = std::gauss_hermite_rule(n);
+            BOOST_REQUIRE_EQUAL(rule.size, n);
+            double m0 = 0;
+            double m2 = 0;
+            double m4 = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (i > 0) {
+                    BOOST_CHECK_LT(rule.nodes[i - 1], rule.nodes[i]);
+                }
+                BOOST_CHECK_EQUAL(rule.nodes[i], -rule.nodes[n - 1 - i]);
+                BOOST_CHECK_EQUAL(rule.weights[i], rule.weights[n - 1 - i]);
+                double const x2 = rule.nodes[i] * rule.nodes[i];
+                m0 += rule.weights[i];
+                m2 += rule.weights[i] * x2;
+                m4 += rule.weights[i] * x2 * x2;
+            }
+
+            // integrals of x^{2k} e^{-x^2}: sqrt(pi), sqrt(pi)/2, 3 sqrt(pi)/4
+            BOOST_CHECK_CLOSE_FRACTION(m0, root_pi, 16 * eps<double>);
+            if (n > 1) {
+                BOOST_CHECK_CLOSE_FRACTION(m2, root_pi / 2, 16 * eps<double>);
+            }
+            if (n > 2) {
+                BOOST_CHECK_CLOSE_FRACTION(m4, 3 * root_pi / 4, 16 * eps<double>);
+            }
+        }
+
+        // 3-point rule: nodes 0, +/-sqrt(3/2), weights 2 sqrt(pi)/3, sqrt(pi)/6
+        auto const rule = std::gauss_hermite_rule(3);
+        BOOST_CHECK_EQUAL(rule.nodes[1], 0.0);
+        BOOST_CHECK_CLOSE_FRACTION(rule.nodes[2], std::sqrt(1.5), 2 * eps<double>);
+        BOOST_CHECK_CLOSE_FRACTION(rule.weights[1], 2 * root_pi / 3, 2 * eps<double>);
+        BOOST_CHECK_CLOSE_FRACTION(rule.weights[2], root_pi / 6, 2 * eps<double>);
+
+        // H_n itself overflows double near its largest zeros for n this large
+        auto const big = std::gauss_hermite_rule(2000);
+        BOOST_CHECK(std::isfinite(big.nodes[1999]));
+        BOOST_CHECK_GE(big.weights[1999], 0.0);
+        BOOST_CHECK(std::gauss_hermite_rule(2000).nodes == big.nodes);
+    }
+} // namespace gauss_hermite
+
+namespace gauss_laguerre {
+    BOOST_AUTO_TEST_CASE(test_gauss_laguerre_rule) {
+        for (double const alpha : {-0.75, -0.5, 0.0, 0.5, 2.0, 30.0}) {
+            for (unsigned const n : {1u, 2u, 5u, 40u, 300u}) {
+                auto const rule = std::gauss_laguerre_rule(n, alpha);
+                BOOST_REQUIRE_EQUAL(rule.size, n);
+                double m0 = 0;
+                double m1 = 0;
+                double m2 = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    BOOST_CHECK_GT(rule.nodes[i], i > 0 ? rule.nodes[i - 1] : 0.0);
+                    m0 += rule.weights[i];
+                    m1 += rule.weights[i] * rule.nodes[i];
+                    m2 += rule.weights[i] * rule.nodes[i] * rule.nodes[i];
+                }
+
+                // integrals of x^k x^alpha e^{-x}: Gamma(alpha + k + 1)
+                double const gamma = std::tgamma(alpha + 1);
+                BOOST_CHECK_CLOSE_FRACTION(m0, gamma, 16 * eps<double>);
+                if (n > 1) {
+                    BOOST_CHECK_CLOSE_FRACTION(m1, (alpha + 1) * gamma, 16 * eps<double>);
+                    BOOST_CHECK_CLOSE_FRACTION(m2, (alpha + 2) * (alpha + 1) * gamma, 16 * eps<double>);
+                }
+            }
+        }
+
+        // 2-point rule: nodes 2 -/+ sqrt(2), weights (2 +/- sqrt(2))/4
+        auto const rule = std::gauss_laguerre_rule(2);
+        BOOST_CHECK_CLOSE_FRACTION(rule.nodes[0], 2 - std::sqrt(2.0), 4 * eps<double>);
+        BOOST_CHECK_CLOSE_FRACTION(rule.nodes[1], 2 + std::sqrt(2.0), 2 * eps<double>);
+        BOOST_CHECK_CLOSE_FRACTION(rule.weights[0], (2 + std::sqrt(2.0)) / 4, 2 * eps<double>);
+        BOOST_CHECK_CLOSE_FRACTION(rule.weights[1], (2 - std::sqrt(2.0)) / 4, 4 * eps<double>);
+    }
+
+    BOOST_AUTO_TEST_CASE(test_gauss_laguerre_rule_cache) {
+        // cached by (n, alpha)
+        BOOST_CHECK(std::gauss_laguerre_rule(20, 0.5).nodes == std::gauss_laguerre_rule(20, 0.5).nodes);
+        BOOST_CHECK(std::gauss_laguerre_rule(20, 0.5).nodes != std::gauss_laguerre_rule(20, 1.5).nodes);
+        BOOST_CHECK(std::gauss_laguerre_rule(20).nodes == std::gauss_laguerre_rule(20, 0.0).nodes);
+
+        std::quadrature_rule rules[4];
+        std::vector<std::thread> threads;
+        for (auto& rule : rules) {
+            threads.emplace_back([&rule] { rule = std::gauss_laguerre_rule(700, 2.5); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto const& rule : rules) {
+            BOOST_CHECK(rule.nodes == rules[0].nodes);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(test_gauss_laguerre_rule_boundaries) {
+        // the weight is integrable only for alpha > -1
+        errno = 0;
+        BOOST_CHECK_EQUAL(std::gauss_laguerre_rule(5, -1.0).size, 0u);
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK_EQUAL(std::gauss_laguerre_rule(5, qNaN<double>).size, 0u);
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK_EQUAL(std::gauss_laguerre_rule(5, -0.99).size, 5u);
+        BOOST_CHECK(verify_not_domain_error());
+    }
+} // namespace gauss_laguerre
+
+namespace gauss_legendre {
+    // integral of x^(2k) over [-1, 1]
+    inline double even_moment(unsigned const k) {
+        return 2.0 / (2 * k + 1);
+    }
+
+    inline double integrate_even_power(std::quadrature_rule const& rule, unsigned const k) {
+        double sum = 0;
+        for (std::size_t i = 0; i < rule.size; ++i) {
+            sum += rule.weights[i] * std::pow(rule.nodes[i], 2.0 * k);
+        }
+        return sum;
+    }
+
+    BOOST_AUTO_TEST_CASE(test_gauss_legendre_rule) {
+        // both sides of the switch from Newton iteration to the asymptotic expansion
+        for (unsigned const n : {1u, 2u, 5u, 40u, 99u, 100u, 101u, 150u, 1000u, 4001u}) {
+            auto const rule = std::gauss_legendre_rule(n);
+            BOOST_REQUIRE_EQUAL(rule.size, n);
+            for (std::size_t i = 0; i < n; ++i) {
+                if (i > 0) {
+                    BOOST_CHECK_LT(rule.nodes[i - 1], rule.nodes[i]);
+                }
+                BOOST_CHECK_EQUAL(rule.nodes[i], -rule.nodes[n - 1 - i]);
+                BOOST_CHECK_EQUAL(rule.weights[i], rule.weights[n - 1 - i]);
+
+                // each node is a root of P_n to within a Newton step of rounding error
+                auto const p = std::legendre_and_derivative(n, rule.nodes[i]);
+                BOOST_CHECK_SMALL(p.value / p.derivative, 8 * eps<double>);
+            }
+
+            // exact for polynomials of degree 2n - 1
+            for (unsigned const k : {0u, 1u, 5u, 20u}) {
+                if (2 * k < 2 * n) {
+                    BOOST_CHECK_CLOSE_FRACTION(integrate_even_power(rule, k), even_moment(k), 64 * eps<double>);
+                }
+            }
+        }
+
+        BOOST_CHECK_EQUAL(std::gauss_legendre_rule(0).size, 0u);
+    }
+
+    BOOST_AUTO_TEST_CASE(test_gauss_legendre_rule_spots) {
+        // 3-point rule: nodes 0, +/-sqrt(3/5), weights 8/9, 5/9
+        auto const rule = std::gauss_legendre_rule(3);
+        BOOST_CHECK_EQUAL(rule.nodes[1], 0.0);
+        BOOST_CHECK_CLOSE_FRACTION(rule.nodes[2], std::sqrt(0.6), 2 * eps<double>);
+        BOOST_CHECK_CLOSE_FRACTION(rule.weights[1], 8.0 / 9, 2 * eps<double>);
+        BOOST_CHECK_CLOSE_FRACTION(rule.weights[2], 5.0 / 9, 2 * eps<double>);
+
+        // the weight of the node nearest x = 1, where 1 - x^2 cancels (50-digit references)
+        struct endpoint {
+            unsigned n;
+            double node;
+            double weight;
+        };
+        for (auto const& e : {endpoint{20, 0.9931285991850949247861223884713202782226,
+                                  0.01761400713915211831186196235185281636214},
+                 endpoint{64, 0.9993050417357721394569056243456363119697,
+                     0.001783280721696432947296079144971933179959},
+                 endpoint{100, 0.9997137267734412336782284693423006767183,
+                     0.0007346344905056717304063206583303363906705},
+                 endpoint{101, 0.9997193395297702757683986050563611111204,
+                     0.0007202317064018637017655461330876396241826}}) {
+            auto const r = std::gauss_legendre_rule(e.n);
+            BOOST_CHECK_CLOSE_FRACTION(r.nodes[e.n - 1], e.node, 2 * eps<double>);
+            BOOST_CHECK_CLOSE_FRACTION(r.weights[e.n - 1], e.weight, 8 * eps<double>);
+            BOOST_CHECK_CLOSE_FRACTION(r.weights[0], e.weight, 8 * eps<double>);
+        }
+
+        // a large rule still integrates smooth functions to rounding error
+        auto const big = std::gauss_legendre_rule(100000);
+        double sum = 0;
+        for (std::size_t i = 0; i < big.size; ++i) {
+            sum += big.weights[i] * std::exp(big.nodes[i]);
+        }
+        BOOST_CHECK_CLOSE_FRACTION(sum, std::exp(1.0) - std::exp(-1.0), 1e-13);
+    }
+
+    BOOST_AUTO_TEST_CASE(test_gauss_legendre_rule_cache) {
+        // every caller, on any thread, sees the same cached rule
+        std::quadrature_rule rules[4];
+        std::vector<std::thread> threads;
+        for (auto& rule : rules) {
+            threads.emplace_back([&rule] { rule = std::gauss_legendre_rule(2500); });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        for (auto const& rule : rules) {
+            BOOST_CHECK(rule.nodes == rules[0].nodes);
+            BOOST_CHECK(rule.weights == rules[0].weights);
+        }
+        BOOST_CHECK(std::gauss_legendre_rule(2500).nodes == rules[0].nodes);
+    }
+} // namespace gauss_legendre
+
 namespace hermite {
     template<class>
     constexpr auto test_fn = [](unsigned, auto x) {
@@ -1385,7 +3047,7 @@ namespace hermite {
     template<>
     constexpr auto test_fn<float> = std::hermitef;
     template<>
-    constexpr auto test_fn<double> = std::hermite;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, double)>(std::hermite);
     template<>
     constexpr auto test_fn<long double> = std::hermitel;
 
@@ -1428,6 +3090,217 @@ namespace hermite {
         BOOST_CHECK(std::isnan(test_fn<T>(1u, qNaN<T>)));
         BOOST_CHECK(verify_not_domain_error());
     }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_hermite_batch, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(-10), static_cast<T>(10));
+        std::vector<T> actual(args.size());
+        for (unsigned const n : {0u, 1u, 2u, 10u, 50u, 100u}) {
+            errno = 0;
+            BOOST_CHECK(std::hermite_batch(n, args.data(), args.data() + args.size(), actual.data())
+                == actual.data() + actual.size());
+            BOOST_CHECK(verify_not_domain_error());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                BOOST_CHECK(same_value(actual[i], test_fn<T>(n, args[i])));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_hermite_and_derivative, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(-10), static_cast<T>(10));
+        std::vector<T> values(args.size());
+        std::vector<T> derivatives(args.size());
+        for (unsigned const n : {0u, 1u, 2u, 10u, 50u}) {
+            errno = 0;
+            std::hermite_and_derivative_batch(n, args.data(), args.data() + args.size(),
+                values.data(), derivatives.data());
+            BOOST_CHECK(verify_not_domain_error());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                auto const scalar = std::hermite_and_derivative(n, args[i]);
+                BOOST_CHECK(same_value(scalar.value, test_fn<T>(n, args[i])));
+                BOOST_CHECK(same_value(values[i], scalar.value));
+                BOOST_CHECK(same_value(derivatives[i], scalar.derivative));
+            }
+        }
+
+        // d/dx H_n(x) = 2n H_{n-1}(x)
+        auto const tolerance = 4 * eps<T>;
+        BOOST_CHECK_EQUAL(std::hermite_and_derivative(0u, static_cast<T>(3)).derivative, static_cast<T>(0));
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite_and_derivative(1u, static_cast<T>(3)).derivative,
+            static_cast<T>(2), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite_and_derivative(3u, static_cast<T>(-10)).derivative,
+            static_cast<T>(2388), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite_and_derivative(11u, static_cast<T>(10)).derivative,
+            22 * test_fn<T>(10, static_cast<T>(10)), tolerance);
+
+        auto const nan = std::hermite_and_derivative(3u, qNaN<T>);
+        BOOST_CHECK(std::isnan(nan.value) && std::isnan(nan.derivative));
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
+    static_assert(std::hermite<0>(3.0) == 1.0);
+    static_assert(std::hermite<3>(2.0) == 40.0);
+    static_assert(std::hermite<9>(1) == -10720.0);
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_fixed_hermite, T, fptypes) {
+        auto const tolerance = 4 * eps<T>;
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<0>(static_cast<T>(1)), static_cast<T>(1.L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<1>(static_cast<T>(1e6)), static_cast<T>(2e6), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<10>(static_cast<T>(30)), static_cast<T>(5.896624628001300E+17L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<10>(static_cast<T>(10)), static_cast<T>(8.093278209760000E+12L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<10>(static_cast<T>(-10)), static_cast<T>(8.093278209760000E+12L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<3>(static_cast<T>(-10)), static_cast<T>(-7.880000000000000E+3L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<3>(static_cast<T>(-1000)), static_cast<T>(-7.999988000000000E+9L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite<3>(static_cast<T>(-1000000)), static_cast<T>(-7.999999999988000E+18L), tolerance);
+        BOOST_CHECK(std::isnan(std::hermite<0>(qNaN<T>)));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_hermite_function, T, fptypes) {
+        // against H_n(x) e^{-x^2/2} / sqrt(2^n n! sqrt(pi)) where that does not overflow;
+        // |psi_n| <= pi^{-1/4}, so the tolerance is absolute; long double is evaluated in double
+        double const tolerance = 16 * std::max(static_cast<double>(eps<T>), eps<double>);
+        auto const args = batch_args<T>(static_cast<T>(-8), static_cast<T>(8));
+        std::vector<T> sequence(21);
+        std::vector<T> batch(args.size());
+        for (unsigned const n : {0u, 1u, 2u, 7u, 20u}) {
+            errno = 0;
+            BOOST_CHECK(std::hermite_function_batch(n, args.data(), args.data() + args.size(), batch.data())
+                == batch.data() + batch.size());
+            BOOST_CHECK(verify_not_domain_error());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                BOOST_CHECK(same_value(batch[i], std::hermite_function(n, args[i])));
+                if (std::isnan(args[i])) {
+                    continue;
+                }
+
+                double const x = static_cast<double>(args[i]);
+                double const expected = std::hermite(n, x) * std::exp(-x * x / 2)
+                    / std::sqrt(std::ldexp(std::tgamma(n + 1.0), n) * std::sqrt(boost::math::constants::pi<double>()));
+                BOOST_CHECK_SMALL(static_cast<double>(batch[i]) - expected, tolerance);
+                BOOST_CHECK(std::hermite_function_sequence(n, args[i], sequence.data()) == sequence.data() + n + 1);
+                BOOST_CHECK(same_value(sequence[n], batch[i]));
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(test_hermite_function_large_degree) {
+        double const bound = 0.75112554446494248; // pi^{-1/4}
+        std::vector<double> psi(5001);
+
+        // psi_2m(0) = (-1)^m pi^{-1/4} sqrt((2m)! / (2^m m!)^2), psi_2m+1(0) = 0
+        double ratio = 1;
+        for (unsigned j = 1; j <= 2500; ++j) {
+            ratio *= (2 * j - 1) / (2.0 * j);
+        }
+        BOOST_CHECK(std::hermite_function_sequence(5000, 0.0, psi.data()) == psi.data() + psi.size());
+        BOOST_CHECK_CLOSE_FRACTION(psi[5000], bound * std::sqrt(ratio), 1e-12);
+        BOOST_CHECK_CLOSE_FRACTION(psi[4998], -bound * std::sqrt(ratio * 5000 / 4999), 1e-12);
+        BOOST_CHECK_EQUAL(psi[4999], 0.0);
+
+        // e^{-x^2/2} underflows from x = 38.6, but psi_n does not until past sqrt(2n + 1) = 100
+        for (double const x : {1.5, 37.0, 60.0, 99.0, 101.0, 110.0}) {
+            std::hermite_function_sequence(5000, x, psi.data());
+            for (double const value : psi) {
+                BOOST_CHECK_LE(std::abs(value), bound);
+            }
+            BOOST_CHECK(same_value(psi[5000], std::hermite_function(5000u, x)));
+        }
+        BOOST_CHECK_GT(std::abs(std::hermite_function(5000u, 99.0)), 1e-3);
+        BOOST_CHECK_LT(std::abs(std::hermite_function(5000u, 110.0)), 1e-30);
+
+        // psi_100(40) ~ 1e-251 from logarithms, although e^{-800} itself underflows
+        double const log_magnitude = std::log(std::hermite(100, 40.0)) - 800
+            - (100 * std::log(2.0) + std::lgamma(101.0) + std::log(boost::math::constants::pi<double>()) / 2) / 2;
+        BOOST_CHECK_CLOSE_FRACTION(std::hermite_function(100u, 40.0), std::exp(log_magnitude), 1e-12);
+
+        double const args[] = {-100.5, 50.0, 99.0};
+        double batch[3];
+        std::hermite_function_batch(5000, args, args + 3, batch);
+        for (int i = 0; i < 3; ++i) {
+            BOOST_CHECK_CLOSE_FRACTION(batch[i], std::hermite_function(5000u, args[i]), 4 * eps<double>);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(test_hermite_function_orthonormality) {
+        // sum_i w_i e^{x_i^2} psi_m(x_i) psi_n(x_i) is exact for m + n < 2 * 120
+        auto const rule = std::gauss_hermite_rule(120);
+        std::vector<std::vector<double>> psi(rule.size, std::vector<double>(61));
+        for (std::size_t i = 0; i < rule.size; ++i) {
+            std::hermite_function_sequence(60, rule.nodes[i], psi[i].data());
+        }
+        for (unsigned m = 0; m <= 60; m += 3) {
+            for (unsigned n = m; n <= 60; n += 4) {
+                double sum = 0;
+                for (std::size_t i = 0; i < rule.size; ++i) {
+                    sum += rule.weights[i] * std::exp(rule.nodes[i] * rule.nodes[i]) * psi[i][m] * psi[i][n];
+                }
+                BOOST_CHECK_SMALL(sum - (m == n), 1e-13);
+            }
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE(test_hermite_transform) {
+        for (unsigned const size : {1u, 2u, 7u, 64u, 301u}) {
+            std::hermite_transform const plan(size);
+            BOOST_REQUIRE_EQUAL(plan.size(), size);
+            BOOST_CHECK(plan.nodes() == std::gauss_hermite_rule(size).nodes);
+
+            // psi_m sampled at the nodes transforms to the m-th unit vector
+            std::vector<double> values(size);
+            std::vector<double> coefficients(size);
+            for (unsigned const m : {0u, size / 2, size - 1}) {
+                for (unsigned i = 0; i < size; ++i) {
+                    values[i] = std::hermite_function(m, plan.nodes()[i]);
+                }
+                plan.forward(values.data(), coefficients.data());
+                for (unsigned n = 0; n < size; ++n) {
+                    BOOST_CHECK_SMALL(coefficients[n] - (m == n), 1e-13);
+                }
+            }
+
+            // many vectors at once, round trip
+            std::size_t const count = 37;
+            std::vector<double> original(count * size);
+            for (std::size_t k = 0; k < original.size(); ++k) {
+                original[k] = std::sin(k + 1.0);
+            }
+            std::vector<double> synthesized(original.size());
+            std::vector<double> analyzed(original.size());
+            plan.backward(original.data(), synthesized.data(), count);
+            plan.forward(synthesized.data(), analyzed.data(), count);
+            for (std::size_t k = 0; k < original.size(); ++k) {
+                BOOST_CHECK_SMALL(analyzed[k] - original[k], 1e-12);
+            }
+
+            // the result does not depend on how the product was divided among threads
+            for (std::size_t v = 0; v < count; v += 9) {
+                plan.backward(original.data() + v * size, values.data());
+                for (unsigned i = 0; i < size; ++i) {
+                    BOOST_CHECK_EQUAL(values[i], synthesized[v * size + i]);
+                }
+            }
+        }
+
+        // e^{-x^2/2} = pi^{1/4} psi_0
+        std::hermite_transform const plan(40);
+        std::vector<double> values(40);
+        std::vector<double> coefficients(40);
+        for (unsigned i = 0; i < 40; ++i) {
+            values[i] = std::exp(-plan.nodes()[i] * plan.nodes()[i] / 2);
+        }
+        plan.forward(values.data(), coefficients.data());
+        BOOST_CHECK_CLOSE_FRACTION(coefficients[0], std::pow(boost::math::constants::pi<double>(), 0.25), 1e-14);
+        for (unsigned n = 1; n < 40; ++n) {
+            BOOST_CHECK_SMALL(coefficients[n], 1e-14);
+        }
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_hermite_function_boundaries, T, fptypes) {
+        errno = 0;
+        BOOST_CHECK(std::isnan(std::hermite_function(3u, qNaN<T>)));
+        BOOST_CHECK_EQUAL(std::hermite_function(3u, inf<T>), static_cast<T>(0));
+        BOOST_CHECK_EQUAL(std::hermite_function(3u, -inf<T>), static_cast<T>(0));
+        BOOST_CHECK(verify_not_domain_error());
+    }
 } // namespace hermite
 
 namespace hypot_ {
@@ -1488,7 +3361,7 @@ namespace laguerre {
     template<>
     constexpr auto test_fn<float> = std::laguerref;
     template<>
-    constexpr auto test_fn<double> = std::laguerre;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, double)>(std::laguerre);
     template<>
     constexpr auto test_fn<long double> = std::laguerrel;
 
@@ -1550,6 +3423,89 @@ namespace laguerre {
         BOOST_CHECK(std::isnan(test_fn<T>(1u, qNaN<T>)));
         BOOST_CHECK(verify_not_domain_error());
     }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_laguerre_batch, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(0), static_cast<T>(50));
+        std::vector<T> actual(args.size());
+        for (unsigned const n : {0u, 1u, 2u, 10u, 50u, 100u}) {
+            errno = 0;
+            BOOST_CHECK(std::laguerre_batch(n, args.data(), args.data() + args.size(), actual.data())
+                == actual.data() + actual.size());
+            BOOST_CHECK(verify_not_domain_error());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                BOOST_CHECK(same_value(actual[i], test_fn<T>(n, args[i])));
+            }
+        }
+    }
+
+    static_assert(std::laguerre<0>(3.0) == 1.0);
+    static_assert(std::laguerre<1>(0.5) == 0.5);
+    static_assert(std::laguerre<2>(2) == -1.0);
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_fixed_laguerre, T, fptypes) {
+        auto const tolerance = eps<T> * 100;
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre<4>(static_cast<T>(0.5L)),
+            static_cast<T>(-0.3307291666666666666666666666666666666667L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre<7>(static_cast<T>(0.5L)),
+            static_cast<T>(-0.5183392237103174603174603174603174603175L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre<20>(static_cast<T>(0.5L)),
+            static_cast<T>(0.3120174870800154148915399248893113634676L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre<50>(static_cast<T>(-0.5L)),
+            static_cast<T>(2307.428631277506570629232863491518399720L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre<7>(static_cast<T>(4.5L)),
+            static_cast<T>(-1.036928013392857142857142857142857142857L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre<50>(static_cast<T>(4.5L)),
+            static_cast<T>(-0.7795068145562651416494321484050019245248L), tolerance);
+        BOOST_CHECK(std::isnan(std::laguerre<0>(qNaN<T>)));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_laguerre_sequence, T, fptypes) {
+        std::vector<T> sequence(101);
+        for (T const x : {static_cast<T>(0), static_cast<T>(0.25L), static_cast<T>(7), static_cast<T>(-3),
+                 static_cast<T>(150)}) {
+            errno = 0;
+            BOOST_CHECK(std::laguerre_sequence(100, x, sequence.data()) == sequence.data() + sequence.size());
+            BOOST_CHECK(verify_not_domain_error());
+            for (unsigned n = 0; n <= 100; ++n) {
+                BOOST_CHECK(same_value(sequence[n], test_fn<T>(n, x)));
+            }
+        }
+
+        std::laguerre_sequence(2, qNaN<T>, sequence.data());
+        BOOST_CHECK(std::isnan(sequence[0]) && std::isnan(sequence[1]) && std::isnan(sequence[2]));
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_laguerre_and_derivative, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(0), static_cast<T>(50));
+        std::vector<T> values(args.size());
+        std::vector<T> derivatives(args.size());
+        for (unsigned const n : {0u, 1u, 2u, 10u, 50u}) {
+            errno = 0;
+            std::laguerre_and_derivative_batch(n, args.data(), args.data() + args.size(),
+                values.data(), derivatives.data());
+            BOOST_CHECK(verify_not_domain_error());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                auto const scalar = std::laguerre_and_derivative(n, args[i]);
+                BOOST_CHECK(same_value(scalar.value, test_fn<T>(n, args[i])));
+                BOOST_CHECK(same_value(values[i], scalar.value));
+                BOOST_CHECK(same_value(derivatives[i], scalar.derivative));
+            }
+        }
+
+        // d/dx L_n(x) = -L_{n-1}^1(x)
+        auto const tolerance = eps<T> * 100;
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre_and_derivative(1u, static_cast<T>(3)).derivative,
+            static_cast<T>(-1), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre_and_derivative(2u, static_cast<T>(0.5L)).derivative,
+            static_cast<T>(-1.5L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::laguerre_and_derivative(10u, static_cast<T>(2.5L)).derivative,
+            -std::assoc_laguerre(9u, 1u, static_cast<T>(2.5L)), tolerance);
+
+        auto const nan = std::laguerre_and_derivative(3u, qNaN<T>);
+        BOOST_CHECK(std::isnan(nan.value) && std::isnan(nan.derivative));
+        BOOST_CHECK(verify_not_domain_error());
+    }
 } // namespace laguerre
 
 namespace legendre {
@@ -1560,7 +3516,7 @@ namespace legendre {
     template<>
     constexpr auto test_fn<float> = std::legendref;
     template<>
-    constexpr auto test_fn<double> = std::legendre;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, double)>(std::legendre);
     template<>
     constexpr auto test_fn<long double> = std::legendrel;
 
@@ -1622,6 +3578,86 @@ namespace legendre {
         BOOST_CHECK_CLOSE_FRACTION(test_fn<T>(0u, static_cast<T>(-1)), static_cast<T>(1), tolerance);
         BOOST_CHECK(verify_not_domain_error());
     }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_legendre_batch, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        std::vector<T> actual(args.size());
+        for (unsigned const n : {0u, 1u, 2u, 40u, 1000u, static_cast<unsigned>(-41)}) {
+            errno = 0;
+            BOOST_CHECK(std::legendre_batch(n, args.data(), args.data() + args.size(), actual.data())
+                == actual.data() + actual.size());
+            BOOST_CHECK(verify_not_domain_error());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                BOOST_CHECK(same_value(actual[i], test_fn<T>(n, args[i])));
+            }
+        }
+
+        // domain is |x| <= 1
+        T const mixed[] = {static_cast<T>(0.5L), static_cast<T>(2), static_cast<T>(-0.25L)};
+        T out[3];
+        errno = 0;
+        (void) std::legendre_batch(3u, mixed, mixed + 3, out);
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(out[1]));
+        BOOST_CHECK_EQUAL(out[0], test_fn<T>(3u, mixed[0]));
+        BOOST_CHECK_EQUAL(out[2], test_fn<T>(3u, mixed[2]));
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_legendre_and_derivative, T, fptypes) {
+        auto const args = batch_args<T>(static_cast<T>(-1), static_cast<T>(1));
+        std::vector<T> values(args.size());
+        std::vector<T> derivatives(args.size());
+        for (unsigned const n : {0u, 1u, 2u, 40u, 1000u, static_cast<unsigned>(-41)}) {
+            errno = 0;
+            std::legendre_and_derivative_batch(n, args.data(), args.data() + args.size(),
+                values.data(), derivatives.data());
+            BOOST_CHECK(verify_not_domain_error());
+            for (std::size_t i = 0; i < args.size(); ++i) {
+                auto const scalar = std::legendre_and_derivative(n, args[i]);
+                BOOST_CHECK(same_value(scalar.value, test_fn<T>(n, args[i])));
+                BOOST_CHECK(same_value(values[i], scalar.value));
+                BOOST_CHECK(same_value(derivatives[i], scalar.derivative));
+            }
+        }
+
+        // P_l'(1) = l(l+1)/2, P_l'(-1) = (-1)^{l+1} l(l+1)/2
+        auto const tolerance = eps<T> * 100;
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre_and_derivative(7u, static_cast<T>(1)).derivative,
+            static_cast<T>(28), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre_and_derivative(7u, static_cast<T>(-1)).derivative,
+            static_cast<T>(28), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre_and_derivative(4u, static_cast<T>(-1)).derivative,
+            static_cast<T>(-10), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre_and_derivative(40u, static_cast<T>(0.5L)).derivative,
+            boost::math::legendre_p_prime(40, static_cast<T>(0.5L)), tolerance);
+
+        // domain is |x| <= 1
+        T const mixed[] = {static_cast<T>(0.5L), static_cast<T>(2), static_cast<T>(-0.25L)};
+        T mixed_values[3];
+        T mixed_derivatives[3];
+        errno = 0;
+        std::legendre_and_derivative_batch(3u, mixed, mixed + 3, mixed_values, mixed_derivatives);
+        BOOST_CHECK(verify_domain_error());
+        BOOST_CHECK(std::isnan(mixed_values[1]) && std::isnan(mixed_derivatives[1]));
+        BOOST_CHECK_CLOSE_FRACTION(mixed_derivatives[0], static_cast<T>(0.375L), tolerance);
+    }
+
+    static_assert(std::legendre<0>(0.25) == 1.0);
+    static_assert(std::legendre<2>(0.5) == -0.125);
+    static_assert(std::legendre<3>(1) == 1.0);
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_fixed_legendre, T, fptypes) {
+        auto const tolerance = eps<T> * 100;
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre<1>(static_cast<T>(0.5L)),
+            static_cast<T>(0.5L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre<4>(static_cast<T>(0.5L)),
+            static_cast<T>(-0.2890625000000000000000000000000000000000L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre<7>(static_cast<T>(0.5L)),
+            static_cast<T>(0.2231445312500000000000000000000000000000L), tolerance);
+        BOOST_CHECK_CLOSE_FRACTION(std::legendre<40>(static_cast<T>(0.5L)),
+            static_cast<T>(-0.09542943523261546936538467572384923220258L), tolerance);
+        BOOST_CHECK(std::isnan(std::legendre<0>(qNaN<T>)));
+    }
 } // namespace legendre
 
 namespace riemann_zeta {
@@ -1637,16 +3673,24 @@ namespace riemann_zeta {
     template<>
     constexpr auto test_fn<float> = std::riemann_zetaf;
     template<>
-    constexpr auto test_fn<double> = std::riemann_zeta;
+    constexpr auto test_fn<double> = static_cast<double (*)(double)>(std::riemann_zeta);
     template<>
     constexpr auto test_fn<long double> = std::riemann_zetal;
 
     BOOST_AUTO_TEST_CASE_TEMPLATE(test_riemann_zeta, T, fptypes) {
         auto const tester = [](T tolerance) {
             return [tolerance](auto const& datum) {
+                // tables, the series at the pole, and reflection stand in for Boost below s = 2
                 auto const actual = test_fn<T>(datum[0]);
-                BOOST_CHECK_EQUAL(actual, control_fn<T>(datum[0]));
+                BOOST_CHECK_CLOSE_FRACTION(actual, control_fn<T>(datum[0]), tolerance);
                 BOOST_CHECK_CLOSE_FRACTION(actual, datum[1], tolerance);
+
+                // the batch, evaluated in double for long double
+                T const s = datum[0];
+                T batched;
+                std::riemann_zeta_batch(&s, &s + 1, &batched);
+                BOOST_CHECK_CLOSE_FRACTION(batched, datum[1],
+                    tolerance * static_cast<T>(std::max(1.0, eps<double> / static_cast<double>(eps<T>))));
             };
         };
 
@@ -1757,10 +3801,88 @@ namespace riemann_zeta {
 #endif
     }
 
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_riemann_zeta_tables, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        errno = 0;
+        for (int n = -40; n <= 60; ++n) {
+            for (T const half : {static_cast<T>(0), static_cast<T>(0.5)}) {
+                T const s = n + half;
+                if (s != 1) {   // Boost strays by up to 9 ulp just above 1
+                    BOOST_CHECK_CLOSE_FRACTION(test_fn<T>(s), control_fn<T>(s), 16 * tolerance);
+                }
+            }
+        }
+        BOOST_CHECK(verify_not_domain_error());
+
+        // the tables are correctly rounded
+        BOOST_CHECK_EQUAL(test_fn<T>(2), static_cast<T>(1.6449340668482264));
+        BOOST_CHECK_EQUAL(test_fn<T>(static_cast<T>(0.5)), static_cast<T>(-1.4603545088095868));
+        BOOST_CHECK_EQUAL(test_fn<T>(-1), static_cast<T>(-1.0 / 12));
+        BOOST_CHECK_EQUAL(test_fn<T>(53), static_cast<T>(1 + std::numeric_limits<double>::epsilon()));
+        BOOST_CHECK_EQUAL(test_fn<T>(static_cast<T>(53.5)), static_cast<T>(1));
+
+        // trivial zeros, and the largest negative odd integer that does not overflow double
+        BOOST_CHECK_EQUAL(test_fn<T>(-2), static_cast<T>(0));
+        BOOST_CHECK_EQUAL(test_fn<T>(-260), static_cast<T>(0));
+        BOOST_CHECK_EQUAL(test_fn<T>(-259), static_cast<T>(8.7601563446229211e+306));
+        BOOST_CHECK_EQUAL(test_fn<T>(-261), -std::numeric_limits<T>::infinity());
+        BOOST_CHECK_EQUAL(test_fn<T>(-263), std::numeric_limits<T>::infinity());
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
+    BOOST_AUTO_TEST_CASE_TEMPLATE(test_riemann_zeta_batch, T, fptypes) {
+        // long double is evaluated in double
+        T const tolerance = static_cast<T>(std::max(static_cast<double>(eps<T>), eps<double>));
+
+        // reflection, the series about the pole, the tables, and the Euler-Maclaurin sum,
+        // interleaved so that every block gathers lanes for each of them
+        auto const negative = batch_args<T>(static_cast<T>(-300), static_cast<T>(-1));
+        auto const middle = batch_args<T>(static_cast<T>(-1), static_cast<T>(2));
+        auto const positive = batch_args<T>(static_cast<T>(2), static_cast<T>(60));
+        std::vector<T> args;
+        for (std::size_t i = 0; i < negative.size(); ++i) {
+            args.push_back(negative[i]);
+            args.push_back(middle[i]);
+            args.push_back(positive[i]);
+        }
+        std::vector<T> actual(args.size());
+
+        errno = 0;
+        BOOST_CHECK(std::riemann_zeta_batch(args.data(), args.data() + args.size(), actual.data())
+            == actual.data() + actual.size());
+        BOOST_CHECK(verify_not_domain_error());
+        for (std::size_t i = 0; i < args.size(); ++i) {
+            T const expected = std::isnan(args[i]) ? args[i] : test_fn<T>(args[i]);
+            if (std::isfinite(expected)) {
+                BOOST_CHECK_CLOSE_FRACTION(actual[i], expected, 4 * tolerance);
+            } else {    // NaN, or past float's range
+                BOOST_CHECK(same_value(actual[i], expected));
+            }
+        }
+
+        T const edges[] = {static_cast<T>(0), -std::numeric_limits<T>::denorm_min(),
+            std::numeric_limits<T>::infinity(), -std::numeric_limits<T>::infinity(), static_cast<T>(-261)};
+        std::riemann_zeta_batch(std::begin(edges), std::end(edges), actual.data());
+        for (std::size_t i = 0; i < std::size(edges); ++i) {
+            BOOST_CHECK_EQUAL(actual[i], test_fn<T>(edges[i]));
+        }
+        BOOST_CHECK(verify_not_domain_error());
+    }
+
     BOOST_AUTO_TEST_CASE_TEMPLATE(test_riemann_zeta_boundaries, T, fptypes) {
         errno = 0;
         BOOST_CHECK(std::isnan(test_fn<T>(qNaN<T>)));
         BOOST_CHECK(verify_not_domain_error());
+
+        BOOST_CHECK_EQUAL(test_fn<T>(std::numeric_limits<T>::infinity()), static_cast<T>(1));
+        BOOST_CHECK_EQUAL(test_fn<T>(-std::numeric_limits<T>::infinity()), static_cast<T>(0));
+        BOOST_CHECK(verify_not_domain_error());
+
+        // either side of 0, past the reach of the series
+        BOOST_CHECK_EQUAL(test_fn<T>(std::numeric_limits<T>::denorm_min()), static_cast<T>(-0.5));
+        BOOST_CHECK_EQUAL(test_fn<T>(-std::numeric_limits<T>::denorm_min()), static_cast<T>(-0.5));
     }
 } // namespace riemann_zeta
 
@@ -1777,7 +3899,7 @@ namespace sph_bessel {
     template<>
     constexpr auto test_fn<float> = std::sph_besself;
     template<>
-    constexpr auto test_fn<double> = std::sph_bessel;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, double)>(std::sph_bessel);
     template<>
     constexpr auto test_fn<long double> = std::sph_bessell;
 
@@ -1831,7 +3953,7 @@ namespace sph_legendre {
     template<>
     constexpr auto test_fn<float> = std::sph_legendref;
     template<>
-    constexpr auto test_fn<double> = std::sph_legendre;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, unsigned, double)>(std::sph_legendre);
     template<>
     constexpr auto test_fn<long double> = std::sph_legendrel;
 
@@ -1881,7 +4003,7 @@ namespace sph_neumann {
     template<>
     constexpr auto test_fn<float> = std::sph_neumannf;
     template<>
-    constexpr auto test_fn<double> = std::sph_neumann;
+    constexpr auto test_fn<double> = static_cast<double (*)(unsigned, double)>(std::sph_neumann);
     template<>
     constexpr auto test_fn<long double> = std::sph_neumannl;
 